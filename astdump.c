@@ -0,0 +1,206 @@
+/* astdump: TurkC kaynağını ayrıştırıp sözdizim ağacını yazar.
+ *
+ *   ./astdump test2.tc                      (girintili ağaç)
+ *   ./astdump --stats --quiet big.tc        (sadece token/düğüm sayısı ve hız)
+ *
+ * --backend=flex token'ları flex lexer'ından (turkc_lexer.h), simd
+ * (varsayılan) turkc_fastlex'ten alır. --stats ayrıştırma süresini
+ * (lexer dahil, dosya okuma hariç) ve ağacın boyunu stderr'e yazar.
+ * --lex-only ayrıştırmadan sadece token'ları çeker (karşılaştırma için).
+ * --cache=DIZIN token'ları ve ağacı disk cache'inden alır (turkc_cache.h);
+ * isabette süre kaydın yüklenmesidir.
+ */
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "turkc_ast.h"
+#include "turkc_cache.h"
+#include "turkc_fastlex.h"
+#include "turkc_lexer.h"
+#include "turkc_mmap.h"
+#include "turkc_parse.h"
+#include "turkc_time.h"
+
+/* Token'ları sayan kaynak: asıl kaynağı sarar */
+struct counting {
+    const struct turkc_token_source *src;
+    unsigned long tokens;
+};
+
+static int counting_next(void *lexer, struct turkc_token *tok)
+{
+    struct counting *c = lexer;
+    int kind = c->src->next(c->src->lexer, tok);
+
+    if (kind > 0)
+        c->tokens++;
+    return kind;
+}
+
+static const char *counting_error(void *lexer)
+{
+    struct counting *c = lexer;
+
+    return c->src->error(c->src->lexer);
+}
+
+static int flex_next(void *lexer, struct turkc_token *tok)
+{
+    return turkc_lexer_next(lexer, tok);
+}
+
+static const char *flex_error(void *lexer)
+{
+    return turkc_lexer_error(lexer);
+}
+
+static int fastlex_next(void *lexer, struct turkc_token *tok)
+{
+    return turkc_fastlex_next(lexer, tok);
+}
+
+static const char *fastlex_error(void *lexer)
+{
+    return ((struct turkc_fastlex *)lexer)->error;
+}
+
+int main(int argc, char **argv)
+{
+    struct turkc_file file = { NULL, 0, { NULL, 0, 0 }, NULL };
+    struct turkc_fastlex fl;
+    struct turkc_token_source src;
+    struct counting counter;
+    struct turkc_token_source counted = { counting_next, counting_error, &counter };
+    struct turkc_parse_error err;
+    struct turkc_cache cache;
+    struct turkc_ast *ast;
+    turkc_lexer *lx = NULL;
+    const char *path = NULL, *cache_dir = NULL, *data;
+    size_t len = 0;
+    struct turkc_token tok;
+    int use_flex = 0, stats = 0, quiet = 0, lex_only = 0, status = 1, fd, rc, i;
+    double start, elapsed;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--backend=flex") == 0) {
+            use_flex = 1;
+        } else if (strcmp(argv[i], "--backend=simd") == 0) {
+            use_flex = 0;
+        } else if (strcmp(argv[i], "--stats") == 0) {
+            stats = 1;
+        } else if (strcmp(argv[i], "--quiet") == 0) {
+            quiet = 1;
+        } else if (strcmp(argv[i], "--lex-only") == 0) {
+            lex_only = quiet = 1;
+        } else if (strncmp(argv[i], "--cache=", 8) == 0 && argv[i][8]) {
+            cache_dir = argv[i] + 8;
+        } else if (argv[i][0] == '-' || path) {
+            fprintf(stderr, "kullanim: %s [--backend=flex|simd] [--stats] [--quiet] [--lex-only] [--cache=DIZIN] [dosya.tc]\n", argv[0]);
+            return 2;
+        } else {
+            path = argv[i];
+        }
+    }
+    if (cache_dir && (use_flex || lex_only)) {
+        fprintf(stderr, "astdump: --cache --backend=flex ve --lex-only ile kullanilamaz\n");
+        return 2;
+    }
+
+    if (use_flex) {
+        fd = path ? open(path, O_RDONLY) : fileno(stdin);
+        if (fd < 0) {
+            fprintf(stderr, "astdump: %s acilamadi\n", path);
+            return 1;
+        }
+        lx = turkc_lexer_open_fd(fd);
+        if (path)
+            close(fd);
+        src.next = flex_next;
+        src.error = flex_error;
+        src.lexer = lx;
+        data = lx ? turkc_lexer_source(lx, &len) : NULL;
+    } else {
+        if (turkc_load_file(path, &file) == -1) {
+            fprintf(stderr, "astdump: %s acilamadi\n", path);
+            return 1;
+        }
+        if (cache_dir && turkc_cache_open(&cache, cache_dir) != 0) {
+            fprintf(stderr, "astdump: onbellek %s acilamadi\n", cache_dir);
+            turkc_unload_file(&file);
+            return 1;
+        }
+        data = file.data;
+        len = file.size;
+        if (data)
+            turkc_fastlex_init(&fl, data, len, TURKC_SIMD_AUTO);
+        src.next = fastlex_next;
+        src.error = fastlex_error;
+        src.lexer = &fl;
+    }
+    ast = turkc_ast_new();
+    if (!ast || (use_flex ? !lx : !data)) {
+        fprintf(stderr, "astdump: bellek yetersiz\n");
+        goto done;
+    }
+
+    counter.src = &src;
+    counter.tokens = 0;
+    start = turkc_now();
+    if (lex_only) {
+        while ((rc = counting_next(&counter, &tok)) > 0)
+            ;
+        if (rc < 0) {
+            snprintf(err.message, sizeof(err.message), "%s", counting_error(&counter));
+            err.line = tok.line;
+            err.column = tok.column;
+        }
+    } else if (cache_dir) {
+        rc = turkc_cache_parse(&cache, ast, data, len, &err);
+        counter.tokens = cache.ntokens;
+    } else {
+        rc = turkc_parse(ast, &counted, &err);
+    }
+    elapsed = turkc_now() - start;
+    if (rc != 0) {
+        fprintf(stderr, "astdump: satir %lu, sutun %lu: %s\n", err.line, err.column, err.message);
+        goto done;
+    }
+
+    if (!quiet)
+        turkc_ast_dump(ast, stdout);
+    if (stats) {
+        /* flex stream okumada kaynak boyu bilinmez */
+        fprintf(stderr, "token: %lu\n", counter.tokens);
+        if (cache_dir)
+            fprintf(stderr, "onbellek: %s\n", cache.hit ? "isabet" : "iska");
+        fprintf(stderr, "dugum: %lu (%lu byte), sembol: %lu\n",
+                (unsigned long)ast->count - 1,
+                (unsigned long)(ast->count * sizeof(struct turkc_node)),
+                (unsigned long)turkc_intern_count(ast->syms));
+        fprintf(stderr, "sure: %.3f sn, %.1f M token/s", elapsed,
+                counter.tokens / elapsed / 1e6);
+        if (data)
+            fprintf(stderr, ", %.1f MB/s", len / elapsed / 1048576);
+        fputc('\n', stderr);
+    }
+    status = 0;
+
+done:
+    /* hatalı çalıştırmanın aramaları da stats'a yazılsın diye her çıkış buradan */
+    if (cache_dir) {
+        turkc_cache_free_ast(&cache, ast);
+        turkc_cache_close(&cache);
+    } else {
+        turkc_ast_free(ast);
+    }
+    turkc_lexer_close(lx);
+    turkc_unload_file(&file);
+    return status;
+}
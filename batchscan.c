@@ -0,0 +1,313 @@
+/* batchscan: çok sayıda TurkC dosyasını tek process'te paralel tarar.
+ *
+ *   ./batchscan src/ test1.tc                (özet, girişteki sırayla)
+ *   ./batchscan -l dosyalar.txt -j 8         (satır başına bir yol, - = stdin)
+ *   ./batchscan -o tok/ src/                 (dosya başına binary token akışı)
+ *
+ * Dizinler recursive gezilir ve içlerindeki .tc dosyaları isme göre sıralanır.
+ * Dosyalar work-stealing pool'a (turkc_pool.h) dağıtılır; sonuçlar dosya
+ * indeksine yazıldığı için çıktı thread sayısından bağımsız olarak aynıdır.
+ */
+#include <dirent.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <direct.h>
+#define mkdir(path, mode)  _mkdir(path)
+#endif
+
+#include "turkc_lexer.h"
+#include "turkc_pool.h"
+#include "turkc_token.h"
+#include "turkc_tokstream.h"
+
+#define CATEGORY_COUNT 7    /* KEYWORD ... UNKNOWN, bkz. category_index */
+
+static const char *category_names[CATEGORY_COUNT] = {
+    "KEYWORD", "IDENTIFIER", "NUMBER", "STRING", "OPERATOR", "PUNCTUATION", "UNKNOWN"
+};
+
+struct file_result {
+    unsigned long tokens, lines, bytes;
+    unsigned long categories[CATEGORY_COUNT];
+    const char *error;              /* NULL: başarılı */
+    unsigned long error_line;       /* 0: konumsuz hata */
+    int error_no;                   /* error yoksa: açılamadıysa errno */
+};
+
+struct batch {
+    char **paths;
+    size_t count, cap;
+    struct file_result *results;
+    const char *out_dir;            /* NULL: sadece özet */
+};
+
+static void *xrealloc(void *p, size_t size)
+{
+    p = realloc(p, size);
+    if (!p) {
+        fprintf(stderr, "batchscan: bellek yetersiz\n");
+        exit(1);
+    }
+    return p;
+}
+
+static char *xstrdup(const char *s)
+{
+    size_t len = strlen(s) + 1;
+
+    return memcpy(xrealloc(NULL, len), s, len);
+}
+
+static void add_path(struct batch *b, const char *path)
+{
+    if (b->count == b->cap) {
+        b->cap = b->cap ? b->cap * 2 : 64;
+        b->paths = xrealloc(b->paths, b->cap * sizeof(*b->paths));
+    }
+    b->paths[b->count++] = xstrdup(path);
+}
+
+static int has_tc_suffix(const char *name)
+{
+    size_t len = strlen(name);
+
+    return len > 3 && strcmp(name + len - 3, ".tc") == 0;
+}
+
+static int compare_names(const void *a, const void *b)
+{
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+/* Dizin içeriği isme göre sıralanır, sıra dosya sisteminden bağımsızdır */
+static int add_dir(struct batch *b, const char *dir)
+{
+    DIR *d = opendir(dir);
+    struct dirent *e;
+    struct stat st;
+    char **names = NULL, *path;
+    size_t n = 0, cap = 0, i;
+    int rc = 0;
+
+    if (!d) {
+        fprintf(stderr, "batchscan: %s: %s\n", dir, strerror(errno));
+        return -1;
+    }
+    while ((e = readdir(d)) != NULL) {
+        if (strcmp(e->d_name, ".") == 0 || strcmp(e->d_name, "..") == 0)
+            continue;
+        if (n == cap) {
+            cap = cap ? cap * 2 : 32;
+            names = xrealloc(names, cap * sizeof(*names));
+        }
+        names[n++] = xstrdup(e->d_name);
+    }
+    closedir(d);
+    qsort(names, n, sizeof(*names), compare_names);
+
+    for (i = 0; i < n; i++) {
+        path = xrealloc(NULL, strlen(dir) + strlen(names[i]) + 2);
+        sprintf(path, "%s/%s", dir, names[i]);
+        if (stat(path, &st) == 0 && S_ISDIR(st.st_mode)) {
+            if (add_dir(b, path) != 0)
+                rc = -1;
+        } else if (has_tc_suffix(names[i])) {
+            add_path(b, path);
+        }
+        free(path);
+        free(names[i]);
+    }
+    free(names);
+    return rc;
+}
+
+static int add_arg(struct batch *b, const char *arg)
+{
+    struct stat st;
+
+    if (stat(arg, &st) == 0 && S_ISDIR(st.st_mode))
+        return add_dir(b, arg);
+    add_path(b, arg);           /* açılamıyorsa hata taramada raporlanır */
+    return 0;
+}
+
+static int add_list(struct batch *b, const char *list)
+{
+    FILE *f = strcmp(list, "-") == 0 ? stdin : fopen(list, "r");
+    char line[4096];
+    size_t len;
+    int rc = 0;
+
+    if (!f) {
+        fprintf(stderr, "batchscan: %s: %s\n", list, strerror(errno));
+        return -1;
+    }
+    while (fgets(line, sizeof(line), f)) {
+        len = strcspn(line, "\r\n");
+        line[len] = '\0';
+        if (len > 0 && add_arg(b, line) != 0)
+            rc = -1;
+    }
+    if (f != stdin)
+        fclose(f);
+    return rc;
+}
+
+static int category_index(int kind)
+{
+    switch (kind) {
+    case TK_IDENTIFIER: return 1;
+    case TK_NUMBER:     return 2;
+    case TK_STRING:     return 3;
+    case TK_UNKNOWN:    return 6;
+    }
+    if (kind >= TK_EGER && kind <= TK_VOID)
+        return 0;
+    if (kind >= TK_PLUS && kind <= TK_ASSIGN)
+        return 4;
+    return 5;
+}
+
+/* "a/../b.tc" -> out_dir/a/__/b.tc.tok; ara dizinler oluşturulur */
+static FILE *open_output(const char *out_dir, const char *path)
+{
+    char *out, *p;
+    FILE *f;
+
+    while (*path == '/')
+        path++;
+    out = xrealloc(NULL, strlen(out_dir) + strlen(path) * 2 + 8);
+    sprintf(out, "%s/%s.tok", out_dir, path);
+    for (p = out + strlen(out_dir) + 1; (p = strstr(p, "..")) != NULL; p += 2)
+        p[0] = p[1] = '_';
+    for (p = out + strlen(out_dir) + 1; (p = strchr(p, '/')) != NULL; p++) {
+        *p = '\0';
+        mkdir(out, 0777);
+        *p = '/';
+    }
+    f = fopen(out, "wb");
+    free(out);
+    return f;
+}
+
+static void scan_file(void *ctx, size_t task, int worker)
+{
+    struct batch *b = ctx;
+    struct file_result *r = &b->results[task];
+    struct turkc_tokstream_writer *w = NULL;
+    FILE *out = NULL;
+    turkc_lexer *lx;
+    struct turkc_token tok;
+    int kind;
+
+    (void)worker;
+    lx = turkc_lexer_open_path(b->paths[task]);
+    if (!lx) {
+        r->error_no = errno ? errno : ENOMEM;
+        return;
+    }
+    if (b->out_dir) {
+        out = open_output(b->out_dir, b->paths[task]);
+        if (!out || !(w = turkc_tokstream_writer_open(out))) {
+            r->error = "cikti dosyasi acilamadi";
+            goto done;
+        }
+    }
+
+    while ((kind = turkc_lexer_next(lx, &tok)) > 0) {
+        r->tokens++;
+        r->categories[category_index(kind)]++;
+        if (w && turkc_tokstream_put(w, kind, tok.offset, tok.length, tok.line) != 0) {
+            r->error = "binary akis 4 GiB'tan buyuk dosyayi tasiyamaz";
+            r->error_line = tok.line;
+            goto done;
+        }
+    }
+    if (kind < 0) {
+        r->error = turkc_lexer_error(lx);
+        r->error_line = tok.line;
+    } else {
+        r->lines = tok.line;
+        r->bytes = tok.offset;
+    }
+
+done:
+    if (w && turkc_tokstream_writer_close(w) != 0 && !r->error)
+        r->error = "cikti yazilamadi";
+    if (out)
+        fclose(out);
+    turkc_lexer_close(lx);
+}
+
+int main(int argc, char **argv)
+{
+    struct batch b;
+    struct file_result total;
+    size_t i, scanned = 0;
+    int j, c, nworkers = 0, rc = 0;
+
+    memset(&b, 0, sizeof(b));
+    for (j = 1; j < argc; j++) {
+        if (strcmp(argv[j], "-j") == 0 && j + 1 < argc) {
+            nworkers = atoi(argv[++j]);
+        } else if (strcmp(argv[j], "-l") == 0 && j + 1 < argc) {
+            if (add_list(&b, argv[++j]) != 0)
+                rc = 1;
+        } else if (strcmp(argv[j], "-o") == 0 && j + 1 < argc) {
+            b.out_dir = argv[++j];
+        } else if (argv[j][0] != '-') {
+            if (add_arg(&b, argv[j]) != 0)
+                rc = 1;
+        } else {
+            fprintf(stderr, "kullanim: %s [-j N] [-o dizin] [-l liste] dosya|dizin...\n", argv[0]);
+            return 2;
+        }
+    }
+    if (b.out_dir)
+        mkdir(b.out_dir, 0777);
+
+    b.results = xrealloc(NULL, (b.count ? b.count : 1) * sizeof(*b.results));
+    memset(b.results, 0, (b.count ? b.count : 1) * sizeof(*b.results));
+    if (turkc_pool_run(b.count, nworkers, scan_file, &b) != 0)
+        fprintf(stderr, "batchscan: thread acilamadi, daha az worker ile devam edildi\n");
+
+    /* Sonuçlar girişteki sırayla */
+    memset(&total, 0, sizeof(total));
+    printf("# dosya\ttoken\tsatir\tbyte\n");
+    for (i = 0; i < b.count; i++) {
+        struct file_result *r = &b.results[i];
+
+        if (r->error && r->error_line) {
+            fprintf(stderr, "batchscan: %s: satir %lu: %s\n", b.paths[i], r->error_line, r->error);
+            rc = 1;
+            continue;
+        }
+        if (r->error || r->error_no) {
+            fprintf(stderr, "batchscan: %s: %s\n", b.paths[i],
+                    r->error ? r->error : strerror(r->error_no));
+            rc = 1;
+            continue;
+        }
+        scanned++;
+        printf("%s\t%lu\t%lu\t%lu\n", b.paths[i], r->tokens, r->lines, r->bytes);
+        total.tokens += r->tokens;
+        total.lines += r->lines;
+        total.bytes += r->bytes;
+        for (c = 0; c < CATEGORY_COUNT; c++)
+            total.categories[c] += r->categories[c];
+    }
+    printf("# toplam: %lu dosya\t%lu\t%lu\t%lu\n",
+           (unsigned long)scanned, total.tokens, total.lines, total.bytes);
+    for (c = 0; c < CATEGORY_COUNT; c++)
+        printf("# %s: %lu\n", category_names[c], total.categories[c]);
+
+    for (i = 0; i < b.count; i++)
+        free(b.paths[i]);
+    free(b.paths);
+    free(b.results);
+    return rc;
+}
@@ -0,0 +1,105 @@
+#!/bin/sh
+# Kapanmayan yorum/string ve uzun '*' dizileri üzerinde tarama süresi ve
+# bellek.
+#
+#   ./bench_adversarial.sh [boyut_MB]         varsayılan: 1024 MB
+#
+# Her durum boyut/4, boyut/2 ve boyut MB'lık girişle ölçülür: süre girişle
+# doğru orantılıysa MB/s sabit kalır. Tepe bellek (VmHWM) çalışma sırasında
+# /proc'tan örneklenir; çok kısa süren çalışmalarda "-" yazılır. mmap'li
+# modlarda dosyanın okunan sayfaları da bu sayıya girer.
+# Girişler bench_adv_*.tc olarak üretilir ve ölçümden sonra silinir.
+#
+# BASELINE verilirse (örn. start condition'sız önceki scanner) "/* " ile
+# dolu kapanmayan küçük bir yorumda iki scanner karşılaştırılır; eski
+# kuralda her "/*" dosya sonuna kadar tarandığı için süre karesel artar.
+set -e
+
+SIZE_MB=${1:-1024}
+SCANNER=${SCANNER:-./scanner}
+BASELINE=${BASELINE:-}
+
+now() { date +%s.%N; }
+
+# $1: dosya, $2: başlangıç, $3: 1 MB'lık tekrar bloğu (printf), $4: MB
+make_input() {
+    block=$(mktemp)
+    printf "$3" > "$block"
+    while [ "$(wc -c < "$block")" -lt 1048576 ]; do cat "$block" "$block" > "$block.2"; mv "$block.2" "$block"; done
+    head -c 1048576 "$block" > "$block.2"
+    printf "$2" > "$1"
+    i=0
+    while [ $i -lt "$4" ]; do cat "$block.2"; i=$((i + 1)); done >> "$1"
+    rm -f "$block" "$block.2"
+}
+
+# $1: giriş, sonrası komut; "-" girişi stdin'den verir (stream okuma).
+# "sn tepe_KB" yazar. Scanner'ın hata vermesi beklenir, çıkış kodu yok sayılır.
+measure() {
+    file=$1
+    stdin=$2
+    shift 2
+    start=$(now)
+    if [ "$stdin" = - ]; then
+        "$@" < "$file" > /dev/null 2>&1 &
+    else
+        "$@" "$file" > /dev/null 2>&1 &
+    fi
+    pid=$!
+    hwm=0
+    while kill -0 $pid 2>/dev/null; do
+        h=$(awk '/^VmHWM/ { print $2 }' /proc/$pid/status 2>/dev/null || true)
+        [ -n "$h" ] && hwm=$h
+        sleep 0.01
+    done
+    wait $pid || true
+    end=$(now)
+    awk -v s="$start" -v e="$end" -v m="$hwm" 'BEGIN { printf "%.3f %d\n", e - s, m }'
+}
+
+# $1: etiket, $2: giriş, $3: "-" veya "", sonrası komut
+row() {
+    label=$1
+    file=$2
+    shift 2
+    set -- $(measure "$file" "$@")
+    awk -v n="$label" -v t="$1" -v m="$2" -v b="$(wc -c < "$file")" \
+        'BEGIN { size = b < 1048576 ? sprintf("%.0f KB", b / 1024) : sprintf("%.0f MB", b / 1048576)
+                 printf "%-16s %11s %8.3f sn %8.1f MB/s %10s\n", n, size, t,
+                     b / (t > 0 ? t : 0.001) / 1048576, (m > 0 ? sprintf("%.1f MB", m / 1024) : "-") }'
+}
+
+printf '%-16s %11s %11s %13s %10s\n' "" giris sure hiz bellek
+
+# $1: durum adı, $2: başlangıç, $3: tekrar eden içerik
+bench_case() {
+    echo "== $1"
+    for mb in $((SIZE_MB / 4)) $((SIZE_MB / 2)) "$SIZE_MB"; do
+        [ "$mb" -gt 0 ] || continue
+        f=bench_adv_$1.tc
+        make_input "$f" "$2" "$3" "$mb"
+        row "flex mmap" "$f" "" "$SCANNER" --format=binary --backend=flex
+        row "flex stream" "$f" - "$SCANNER" --format=binary --backend=flex --no-mmap
+        row "simd" "$f" "" "$SCANNER" --format=binary --backend=simd
+        row "--jobs" "$f" "" "$SCANNER" --format=binary --jobs=0
+        rm -f "$f"
+    done
+}
+
+# Yorumun içinde "/*" açılışları ve satırlar; kapanış yok
+bench_case yorum '/*' 'int x = 1; /* yorum * / \n'
+# Milyonlarca '*', arada '/' yok
+bench_case yildiz '/*' '****************'
+# Kapanmayan string (stream'de metin birikir, bkz. README)
+bench_case string '"' 'metin /* * / \n'
+
+if [ -n "$BASELINE" ]; then
+    echo "== baseline: kapanmayan yorum, \"/* \" tekrarı"
+    for kb in 8 16 32; do
+        f=bench_adv_baseline.tc
+        awk -v n=$((kb * 1024 / 3)) 'BEGIN { for (i = 0; i < n; i++) printf "/* " }' > "$f"
+        row "baseline" "$f" - "$BASELINE"
+        row "scanner" "$f" - "$SCANNER" --no-mmap
+        rm -f "$f"
+    done
+fi
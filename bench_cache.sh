@@ -0,0 +1,46 @@
+#!/bin/sh
+# Disk cache'inin (turkc_cache, tccache) soğuk ve sıcak ayrıştırma süreleri.
+#
+#   ./bench_cache.sh [dosya] [satir]          varsayılan: 100 dosya, 5000 satır
+#
+# Geçici bir dizine bench_lsp.sh'daki biçimde dosyalar üretilir ve tccache
+# dört kez çalıştırılır: cache'siz (-n), boş cache'le (hepsi ıska ve
+# kayıt), dolu cache'le (hepsi isabet) ve bir dosya değiştikten sonra (bir
+# ıska). Her çalıştırmanın toplam süresi ve cache istatistikleri yazılır.
+set -e
+
+FILES=${1:-100}
+LINES=${2:-5000}
+TCCACHE=${TCCACHE:-./tccache}
+
+dir=$(mktemp -d)
+trap 'rm -rf "$dir"' EXIT
+mkdir "$dir/src"
+
+i=1
+while [ $i -le "$FILES" ]; do
+    awk -v n=$((LINES / 10)) -v m=$i 'BEGIN {
+        for (k = 1; k <= n; k++) {
+            printf "/* m%d_f%d: 0..n-1 toplaminin %d kati */\n", m, k, k
+            printf "int m%d_f%d(int n) {\n    int s = 0;\n", m, k
+            printf "    icin (int i = 0; i < n; i = i + 1) {\n        s = s + i * %d;\n    }\n", k
+            printf "    yaz(\"m%d_f%d bitti\");\n    dondur s;\n}\n\n", m, k
+        }
+        printf "int ana() {\n    dondur m%d_f1(3);\n}\n", m
+    }' > "$dir/src/m$i.tc"
+    i=$((i + 1))
+done
+echo "giris: $FILES dosya, $(cat "$dir"/src/*.tc | wc -c) byte"
+
+run() {
+    echo
+    echo "$1:"
+    shift
+    "$TCCACHE" -d "$dir/cache" "$@" "$dir"/src/*.tc | grep ' dosya,\|bu calistirma' | sed 's/^/  /'
+}
+
+run "cache'siz" -n
+run "bos cache"
+run "dolu cache"
+echo "/* degisti */" >> "$dir/src/m1.tc"
+run "bir dosya degisti"
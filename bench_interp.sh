@@ -0,0 +1,162 @@
+#!/bin/sh
+# Yorumlayıcı mikro benchmark'ları: döngü, özyineleme, aritmetik.
+#
+#   ./bench_interp.sh [ölçek]                 varsayılan: 1
+#   ENGINES="tree vm" ./bench_interp.sh       karşılaştırılan motorlar
+#   TCRUN_SWITCH=./tcrun-switch ./bench_interp.sh
+#                                             switch dağıtımlı VM de ölçülür
+#
+# Motorlar: tree, vm (tcrun --engine=...) ve native (tcasm + cc ile
+# derlenmiş program). Her program son satırda yaptığı iş miktarını (op)
+# yazar: döngü turu, çağrı veya operatör sayısı. Süre tcrun --stats'ın
+# çalıştırma süresidir (ayrıştırma ve bytecode derleme hariç); native'de
+# sürecin tamamıdır (başlatma dahil, derleme hariç). 3 çalıştırmanın en
+# kısası. Programlar ölçekle büyür. Hız katı ilk motora göredir; sonuçlar
+# motorlar arasında farklıysa FARKLI yazılır.
+set -e
+
+SCALE=${1:-1}
+TCRUN=${TCRUN:-./tcrun}
+TCASM=${TCASM:-./tcasm}
+CC=${CC:-cc}
+
+# $1: ad, $2: N; program stdin'den, N yerine $2 yazılır
+program() {
+    sed "s/\bN\b/$2/g" > "bench_interp_$1.tc"
+}
+
+program dongu $((10000000 * SCALE)) <<'TC'
+int ana() {
+    int s = 0;
+    icin (int i = 0; i < N; i = i + 1) {
+        s = s + i % 7;
+    }
+    yaz(s);
+    yaz(N);
+    dondur 0;
+}
+TC
+
+program iken $((10000000 * SCALE)) <<'TC'
+int ana() {
+    int n = N;
+    int a = 0;
+    iken (n > 0) {
+        a = a + 3;
+        n = n - 1;
+    }
+    yaz(a);
+    yaz(N);
+    dondur 0;
+}
+TC
+
+# fib(32) 7049155 çağrı yapar; ölçek 2'de fib(33)...
+program fib $((31 + SCALE)) <<'TC'
+int cagri = 0;
+
+int fib(int n) {
+    cagri = cagri + 1;
+    eger (n < 2)
+        dondur n;
+    dondur fib(n - 1) + fib(n - 2);
+}
+
+int ana() {
+    yaz(fib(N));
+    yaz(cagri);
+    dondur 0;
+}
+TC
+
+# tur başına 14 ikili operatör
+program aritmetik $((3000000 * SCALE)) <<'TC'
+int ana() {
+    int x = 1;
+    int y = 7;
+    int z = 0;
+    icin (int i = 0; i < N; i = i + 1) {
+        x = (x * 31 + i) % 65521;
+        y = y + x / 3 - i % 5;
+        z = z + (x < y) + (x == y) * 2;
+    }
+    yaz(x + y + z);
+    yaz(N * 14);
+    dondur 0;
+}
+TC
+
+# iç içe döngü: bölen deneyerek asal sayma, op = iç döngü turu
+program asal $((300000 * SCALE)) <<'TC'
+int ana() {
+    int sayi = 0;
+    int adim = 0;
+    icin (int n = 2; n < N; n = n + 1) {
+        int asal = 1;
+        icin (int d = 2; d <= n / d; d = d + 1) {
+            adim = adim + 1;
+            eger (n % d == 0) {
+                asal = 0;
+                d = n;
+            }
+        }
+        sayi = sayi + asal;
+    }
+    yaz(sayi);
+    yaz(adim);
+    dondur 0;
+}
+TC
+
+ENGINES=${ENGINES:-tree vm native}
+
+# ns cinsinden saat
+now() {
+    date +%s%N
+}
+
+# $1: program, $2: etiket, $3: tcrun (native'de yok), sonrası seçenekler
+run() {
+    name=$1
+    label=$2
+    bin=$3
+    shift 3
+    best=
+    if [ "$label" = native ]; then
+        "$TCASM" "bench_interp_$name.tc" -o "bench_interp_$name.s"
+        "$CC" "bench_interp_$name.s" -o "bench_interp_$name"
+    fi
+    for rep in 1 2 3; do
+        if [ "$label" = native ]; then
+            s=$(now)
+            out=$(./"bench_interp_$name" 2>&1)
+            e=$(now)
+            t=$(awk -v s="$s" -v e="$e" 'BEGIN { printf "%.3f", (e - s) / 1e9 }')
+        else
+            out=$("$bin" --stats "$@" "bench_interp_$name.tc" 2>&1)
+            t=$(echo "$out" | awk '/^calistirma:/ { print $2 }')
+        fi
+        best=$(awk -v t="$t" -v b="$best" \
+            'BEGIN { if (b != "" && b < t) t = b; printf "%.3f", t }')
+    done
+    result=$(echo "$out" | sed -n 1p)
+    ops=$(echo "$out" | sed -n 2p)
+    [ -n "$base" ] || base=$best
+    [ -n "$first" ] || first=$result
+    note=
+    [ "$result" = "$first" ] || note="  FARKLI"
+    awk -v n="$name" -v e="$label" -v t="$best" -v b="$base" -v o="$ops" -v r="$result" -v x="$note" \
+        'BEGIN { printf "%-10s %-7s %8.3f sn %10.1f M op/s %6.2fx   (sonuc %s, %s op)%s\n", n, e, t, o / t / 1e6, b / t, r, o, x }'
+}
+
+for p in dongu iken fib aritmetik asal; do
+    base=
+    first=
+    for e in $ENGINES; do
+        run $p $e "$TCRUN" --engine=$e
+    done
+    if [ -n "$TCRUN_SWITCH" ]; then
+        run $p vm-sw "$TCRUN_SWITCH" --engine=vm
+    fi
+    rm -f "bench_interp_$p.tc" "bench_interp_$p.s" "bench_interp_$p"
+done
@@ -0,0 +1,150 @@
+#!/bin/sh
+# JIT benchmark'ı: aynı küçük fonksiyonların tekrar tekrar çağrıldığı
+# döngüler.
+#
+#   ./bench_jit.sh [ölçek]                    varsayılan: 1
+#   ENGINES="vm jit" ./bench_jit.sh           karşılaştırılan motorlar
+#   THRESHOLD=1000 ./bench_jit.sh             JIT çağrı eşiği
+#
+# Her program son satırda yaptığı iş miktarını (op) yazar. Süre tcrun
+# --stats'ın çalıştırma süresidir (JIT derlemesi dahil), 3 çalıştırmanın en
+# kısası. Hız katı ilk motora göredir. jit satırlarının altında derlenen
+# her fonksiyonun komut sayısı, makine kodu boyu ve derleme süresi yazılır.
+set -e
+
+SCALE=${1:-1}
+TCRUN=${TCRUN:-./tcrun}
+ENGINES=${ENGINES:-tree vm jit}
+THRESHOLD=${THRESHOLD:-100}
+
+# $1: ad, $2: N; program stdin'den, N yerine $2 yazılır
+program() {
+    sed "s/\bN\b/$2/g" > "bench_jit_$1.tc"
+}
+
+# op = iç döngü turu
+program topla $((2000 * SCALE)) <<'TC'
+int topla(int n) {
+    int s = 0;
+    icin (int i = 0; i < n; i = i + 1) {
+        s = s + i % 7;
+    }
+    dondur s;
+}
+
+int ana() {
+    int t = 0;
+    icin (int k = 0; k < N; k = k + 1) {
+        t = t + topla(10000);
+    }
+    yaz(t);
+    yaz(N * 10000);
+    dondur 0;
+}
+TC
+
+# op = bölen denemesi
+program asal $((300000 * SCALE)) <<'TC'
+int adim = 0;
+
+int asal_mi(int n) {
+    icin (int d = 2; d <= n / d; d = d + 1) {
+        adim = adim + 1;
+        eger (n % d == 0)
+            dondur 0;
+    }
+    dondur 1;
+}
+
+int ana() {
+    int sayi = 0;
+    icin (int n = 2; n < N; n = n + 1) {
+        sayi = sayi + asal_mi(n);
+    }
+    yaz(sayi);
+    yaz(adim);
+    dondur 0;
+}
+TC
+
+# op = Collatz adımı; 100000'in altında değerler int'e sığar
+program collatz 100000 <<'TC'
+int adimlar(int n) {
+    int k = 0;
+    iken (n != 1) {
+        eger (n % 2 == 0)
+            n = n / 2;
+        degilse
+            n = 3 * n + 1;
+        k = k + 1;
+    }
+    dondur k;
+}
+
+int ana() {
+    int toplam = 0;
+    icin (int n = 1; n < N; n = n + 1) {
+        toplam = toplam + adimlar(n);
+    }
+    yaz(toplam);
+    yaz(toplam);
+    dondur 0;
+}
+TC
+
+# op = çağrı; fib kendini doğrudan çağırır
+program fib $((28 + SCALE)) <<'TC'
+int cagri = 0;
+
+int fib(int n) {
+    cagri = cagri + 1;
+    eger (n < 2)
+        dondur n;
+    dondur fib(n - 1) + fib(n - 2);
+}
+
+int ana() {
+    int s = 0;
+    icin (int k = 0; k < 4; k = k + 1) {
+        s = s + fib(N);
+    }
+    yaz(s);
+    yaz(cagri);
+    dondur 0;
+}
+TC
+
+# $1: program, $2: motor
+run() {
+    name=$1
+    engine=$2
+    best=
+    for rep in 1 2 3; do
+        if [ "$engine" = jit ]; then
+            out=$("$TCRUN" --stats --jit-threshold="$THRESHOLD" "bench_jit_$name.tc" 2>&1)
+        else
+            out=$("$TCRUN" --stats --engine="$engine" "bench_jit_$name.tc" 2>&1)
+        fi
+        t=$(echo "$out" | awk '/^calistirma:/ { print $2 }')
+        best=$(awk -v t="$t" -v b="$best" \
+            'BEGIN { if (b != "" && b < t) t = b; printf "%.3f", t }')
+    done
+    result=$(echo "$out" | sed -n 1p)
+    ops=$(echo "$out" | sed -n 2p)
+    [ -n "$base" ] || base=$best
+    [ -n "$first" ] || first=$result
+    note=
+    [ "$result" = "$first" ] || note="  FARKLI"
+    awk -v n="$name" -v e="$engine" -v t="$best" -v b="$base" -v o="$ops" -v r="$result" -v x="$note" \
+        'BEGIN { printf "%-8s %-5s %8.3f sn %8.1f M op/s %6.2fx   (sonuc %s, %s op)%s\n", n, e, t, o / t / 1e6, b / t, r, o, x }'
+    echo "$out" | sed -n 's/^jit: /                 /p'
+}
+
+for p in topla asal collatz fib; do
+    base=
+    first=
+    for e in $ENGINES; do
+        run $p $e
+    done
+    rm -f "bench_jit_$p.tc"
+done
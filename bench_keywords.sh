@@ -0,0 +1,71 @@
+#!/bin/sh
+# Anahtar kelime sınıflandırma benchmark'ı (turkc_keywords.h, bkz. gen_keywords.c).
+#
+#   ./bench_keywords.sh [boyut_MB]            varsayılan: 64 MB
+#
+# İki giriş üretilir: anahtar kelime ağırlıklı (token'ların çoğu eger, icin,
+# dondur...) ve identifier ağırlıklı (anahtar kelimelerle aynı önek, aynı
+# uzunluk ya da aynı ilk/son harfi paylaşan isimler, hash'in en kötü hali).
+# Her giriş flex ve simd backend'iyle binary modda taranır. BASELINE başka bir
+# scanner (örn. anahtar kelimeleri ayrı flex kuralları olan eski sürüm)
+# verilirse o da ölçülür.
+set -e
+
+SIZE_MB=${1:-64}
+SCANNER=${SCANNER:-./scanner}
+BASELINE=${BASELINE:-}
+
+now() { date +%s.%N; }
+
+# $1: dosya, $2: tohum metni
+make_input() {
+    if [ -f "$1" ] && [ "$(wc -c < "$1")" -ge $((SIZE_MB * 1048576)) ]; then
+        return
+    fi
+    block=$(mktemp)
+    while [ "$(wc -c < "$block")" -lt 1048576 ]; do printf '%s' "$2" >> "$block"; done
+    : > "$1"
+    i=0
+    while [ $i -lt "$SIZE_MB" ]; do cat "$block"; i=$((i + 1)); done >> "$1"
+    rm -f "$block"
+}
+
+make_input bench_kw_keyword.tc 'eger degilse icin iken dondur int void
+int f ( int a ) { eger ( a ) { dondur a ; } degilse { dondur 0 ; } }
+void g ( ) { icin ( i ) { iken ( j ) { dondur ; } } }
+'
+make_input bench_kw_ident.tc 'egerx degil icinde ikenler dondurme integer voidx
+iken_ ici ike dondu in vo egr dgilse ivin iran dolar ilk vaat ekler
+deger x1 sayac toplam _tmp adim uzunluk sonuc veri
+'
+
+# 3 çalıştırmanın en kısası (sn)
+run() {
+    best=
+    for rep in 1 2 3; do
+        start=$(now)
+        "$@" > /dev/null
+        end=$(now)
+        best=$(awk -v s="$start" -v e="$end" -v b="$best" \
+            'BEGIN { t = e - s; if (b != "" && b < t) t = b; printf "%.3f", t }')
+    done
+    echo "$best"
+}
+
+printf '%-10s %-16s %8s %10s %12s\n' giris scanner sn MB/s token/s
+for input in bench_kw_keyword.tc bench_kw_ident.tc; do
+    bytes=$(wc -c < "$input")
+    tokens=$("$SCANNER" "$input" | wc -l)
+    name=${input#bench_kw_}
+    name=${name%.tc}
+    for backend in flex simd; do
+        t=$(run "$SCANNER" --format=binary --backend=$backend "$input")
+        awk -v n="$name" -v s="$backend" -v t="$t" -v b="$bytes" -v k="$tokens" \
+            'BEGIN { printf "%-10s %-16s %8.3f %10.1f %12.0f\n", n, s, t, b / t / 1048576, k / t }'
+    done
+    if [ -n "$BASELINE" ]; then
+        t=$(run "$BASELINE" --format=binary "$input")
+        awk -v n="$name" -v t="$t" -v b="$bytes" -v k="$tokens" \
+            'BEGIN { printf "%-10s %-16s %8.3f %10.1f %12.0f\n", n, "baseline", t, b / t / 1048576, k / t }'
+    fi
+done
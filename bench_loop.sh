@@ -0,0 +1,134 @@
+#!/bin/sh
+# Döngü optimizasyonu benchmark'ı: döngü çekirdeklerini tcir ile döngü
+# geçişleri olmadan ve licm, ivsr, unroll ile yorumlar.
+#
+#   ./bench_loop.sh [ölçek]                   varsayılan: 1
+#   UNROLLS="1 4 16" ./bench_loop.sh          denenen açma katları
+#
+# temel satırı döngü geçişleri olmayan simplify,sccp,dce,simplify'dır;
+# unroll=N satırları araya licm,ivsr,unroll=N ekler (unroll=1 açmaz). Her
+# satır çalıştırılan IR komutu sayısını, çalıştırma süresini (3
+# çalıştırmanın en kısası) ve temele göre hız katını yazar. Çıktı veya
+# ana()'nın değeri değişirse FARKLI yazılır.
+set -e
+
+SCALE=${1:-1}
+TCIR=${TCIR:-./tcir}
+UNROLLS=${UNROLLS:-1 2 4 8}
+BASE=simplify,sccp,dce,simplify
+
+# $1: ad; program stdin'den, N yerine dış döngü tur sayısı yazılır
+program() {
+    sed "s/\bN\b/$((2000 * SCALE))/g" > "bench_loop_$1.tc"
+}
+
+# icin'in kendisi: sayaç, karşılaştırma, toplama
+program topla <<'TC'
+int ana() {
+    int s = 0;
+    icin (int k = 0; k < N; k = k + 1) {
+        icin (int i = 0; i < 1000; i = i + 1) {
+            s = s + i;
+        }
+    }
+    yaz(s);
+    dondur 0;
+}
+TC
+
+# i * sabit: ivsr çarpmayı toplamaya çevirir
+program carpim <<'TC'
+int ana() {
+    int s = 0;
+    icin (int k = 0; k < N; k = k + 1) {
+        icin (int i = 0; i < 1000; i = i + 1) {
+            s = s + i * 12 - i * 5;
+        }
+    }
+    yaz(s);
+    dondur 0;
+}
+TC
+
+# parametrelerden ve globalden hesaplanan değişmez: licm dışarı taşır
+program degismez <<'TC'
+int taban = 7;
+
+int hesap(int a, int b) {
+    int s = 0;
+    icin (int i = 0; i < 1000; i = i + 1) {
+        s = s + (a * b + taban) % 13 + (a - b) * taban + i;
+    }
+    dondur s;
+}
+
+int ana() {
+    int s = 0;
+    icin (int k = 0; k < N; k = k + 1) {
+        s = s + hesap(k, 3);
+    }
+    yaz(s);
+    dondur 0;
+}
+TC
+
+# iç içe: i'ye bağlı ifadeler iç döngüde değişmez, i * j ivsr'ye girer
+program icice <<'TC'
+int ana() {
+    int s = 0;
+    icin (int k = 0; k < N; k = k + 1) {
+        icin (int i = 0; i < 40; i = i + 1) {
+            icin (int j = 0; j < 25; j = j + 1) {
+                s = s + i * j + (i + 3) * 5;
+            }
+        }
+    }
+    yaz(s);
+    dondur 0;
+}
+TC
+
+# geriye sayan iken
+program iken <<'TC'
+int ana() {
+    int s = 0;
+    icin (int k = 0; k < N; k = k + 1) {
+        int w = 1000;
+        iken (w > 0) {
+            w = w - 1;
+            s = s + w % 3;
+        }
+    }
+    yaz(s);
+    dondur 0;
+}
+TC
+
+# $1: program, $2: geçişler; en kısa süre, komut sayısı, sonuç
+measure() {
+    best=
+    for rep in 1 2 3; do
+        "$TCIR" --passes="$2" --run --stats "bench_loop_$1.tc" > bench_loop.out 2> bench_loop.err || true
+        t=$(awk '/^calistirma:/ { print $2 }' bench_loop.err)
+        best=$(awk -v t="$t" -v b="$best" \
+            'BEGIN { if (b != "" && b < t) t = b; printf "%.3f", t }')
+    done
+    dynamic=$(awk '/^calistirma:/ { print $4 }' bench_loop.err)
+    result=$(cat bench_loop.out bench_loop.err | sed '/^ir:/d; s/^calistirma:.*ana = //' | cksum)
+}
+
+printf "%-9s %-9s %13s %9s %7s\n" program gecisler "calisan komut" "sure (sn)" hiz
+for p in topla carpim degismez icice iken; do
+    measure $p $BASE
+    t0=$best r0=$result
+    printf "%-9s %-9s %13d %9.3f %6.2fx\n" $p temel "$dynamic" "$best" 1
+    for u in $UNROLLS; do
+        measure $p "simplify,sccp,dce,licm,ivsr,unroll=$u,sccp,dce,simplify"
+        note=
+        [ "$result" = "$r0" ] || note="  FARKLI"
+        awk -v n="$p" -v u="unroll=$u" -v d="$dynamic" -v t0="$t0" -v t="$best" -v x="$note" \
+            'BEGIN { printf "%-9s %-9s %13d %9.3f %6.2fx%s\n", n, u, d, t, t0 / t, x }'
+    done
+    rm -f "bench_loop_$p.tc"
+done
+rm -f bench_loop.out bench_loop.err
@@ -0,0 +1,72 @@
+#!/bin/sh
+# Dil sunucusunun (tclsp) 10000 satırlık bir dosyadaki istek süreleri.
+#
+#   ./bench_lsp.sh [satir]                    varsayılan: 10000 satır
+#
+# bench_relex.sh'daki dosya üretilir ve lspclient'la bir oturum çalıştırılır:
+# açma, semantik token'lar, tanıma gitme ve dosyanın ortasında düzenlemeler
+# (gövdeye karakter ekleme, yorum açıp kapama, '}' silip geri koyma, yeni
+# fonksiyon). lspclient gidiş-dönüş süresini yazar; tclsp --trace ile
+# sunucunun mesajı işleme süresi ve yeniden ayrıştırılan birim sayısı da
+# görünür. Her değişiklik --check'le tam ayrıştırmayla karşılaştırılabilir:
+# CHECK=1 ./bench_lsp.sh
+set -e
+
+LINES=${1:-10000}
+TCLSP=${TCLSP:-./tclsp}
+LSPCLIENT=${LSPCLIENT:-./lspclient}
+INPUT=${INPUT:-bench_lsp_input.tc}
+REPEAT=${REPEAT:-200}
+
+awk -v n=$((LINES / 10)) 'BEGIN {
+    for (k = 1; k <= n; k++) {
+        printf "/* f%d: 0..n-1 toplaminin %d kati */\n", k, k
+        printf "int f%d(int n) {\n    int s = 0;\n", k
+        printf "    icin (int i = 0; i < n; i = i + 1) {\n        s = s + i * %d;\n    }\n", k
+        printf "    yaz(\"f%d bitti\");\n    dondur s;\n}\n\n", k
+    }
+    printf "int ana() {\n    dondur f1(3);\n}\n"
+}' > "$INPUT"
+echo "giris: $INPUT, $(wc -l < "$INPUT") satir, $(wc -c < "$INPUT") byte"
+
+# ortadaki fonksiyon: yorum satırı (0'dan) ve gövdenin "s = s + i * k" satırı
+mid=$(( (LINES / 20) * 10 ))
+body=$((mid + 4))
+uri=file:///bench.tc
+doc="{\"textDocument\":{\"uri\":\"$uri\"}}"
+
+script=$(mktemp)
+trace=$(mktemp)
+trap 'rm -f "$script" "$trace"' EXIT
+
+cat > "$script" <<END
+request initialize {"capabilities":{}}
+notify initialized {}
+open $uri $INPUT
+repeat $REPEAT request textDocument/semanticTokens/full $doc
+repeat $REPEAT request textDocument/definition {"textDocument":{"uri":"$uri"},"position":{"line":$body,"character":12}}
+edit $uri $body 8 $body 8 t
+edit $uri $body 8 $body 9
+edit $uri $mid 0 $mid 0 /*
+edit $uri $mid 0 $mid 2
+edit $uri $((mid + 8)) 0 $((mid + 8)) 1
+edit $uri $((mid + 8)) 0 $((mid + 8)) 0 }
+edit $uri $mid 0 $mid 0 int yeni(int a) {\n    dondur a + 1;\n}\n
+repeat $REPEAT request textDocument/semanticTokens/full $doc
+END
+
+if [ -n "$CHECK" ]; then
+    "$LSPCLIENT" -q "$script" "$TCLSP" --trace --check 2> "$trace"
+else
+    "$LSPCLIENT" -q "$script" "$TCLSP" --trace 2> "$trace"
+fi
+echo
+echo "sunucu (tclsp --trace):"
+grep -v 'semanticTokens\|definition' "$trace" | sed 's/^tclsp: /  /'
+# istek başına işleme süresi: en az, ortanca, en çok
+for m in semanticTokens/full definition; do
+    grep "textDocument/$m " "$trace" | awk '{ print $3 }' | sort -n |
+        awk -v m="$m" '{ t[NR] = $1 } END {
+            printf "  %s: %d istek, en az %.3f ms, ortanca %.3f ms, en cok %.3f ms\n",
+                m, NR, t[1], t[int((NR + 1) / 2)], t[NR] }'
+done
@@ -0,0 +1,94 @@
+#!/bin/sh
+# Optimizasyon benchmark'ı: tcir ile IR'ı geçişsiz ve -O ile (sccp, dce,
+# simplify) kurup yorumlar.
+#
+#   ./bench_opt.sh [ölçek]                    varsayılan: 1
+#   PASSES=sccp,dce ./bench_opt.sh            -O yerine bu geçişler
+#
+# test2.tc'nin yanında üretilen programlar: ayar (sabit bayraklara bağlı
+# eger/degilse dalları), sabit (döngüde sabit ifadeler), olu (kullanılmayan
+# ara değerler) ve karisik (üçü birlikte). Her satır canlı IR komut
+# sayısını (statik), çalıştırılan IR komutu sayısını (dinamik) ve
+# çalıştırma süresini (3 çalıştırmanın en kısası) önce -> sonra yazar.
+# Çıktı veya ana()'nın değeri değişirse FARKLI yazılır.
+set -e
+
+SCALE=${1:-1}
+TCIR=${TCIR:-./tcir}
+if [ -n "$PASSES" ]; then
+    OPT="--passes=$PASSES"
+else
+    OPT=-O
+fi
+
+# $1: ad, $2: gövde satırı sayısı, $3: tür (ayar, sabit, olu, karisik)
+generate() {
+    awk -v n="$2" -v kind="$3" -v seed="$2" 'BEGIN {
+        srand(seed)
+        print "int ana() {"
+        for (k = 0; k < 8; k++)
+            printf "    int bayrak%d = %d;\n", k, k % 3 == 0
+        print "    int seviye = 2;"
+        print "    int s = 0;"
+        print "    icin (int i = 0; i < 20000; i = i + 1) {"
+        for (k = 0; k < n; k++) {
+            t = kind
+            if (t == "karisik")
+                t = k % 3 == 0 ? "ayar" : k % 3 == 1 ? "sabit" : "olu"
+            a = int(rand() * 50) + 1
+            b = int(rand() * 9) + 1
+            if (t == "ayar") {
+                printf "        eger (bayrak%d * (seviye > %d)) {\n", k % 8, k % 4
+                printf "            s = s + i %% %d;\n", b + 1
+                print  "        } degilse {"
+                printf "            s = s - (i * %d + %d) / %d;\n", a, k, b
+                print  "        }"
+            } else if (t == "sabit") {
+                printf "        s = s + (%d * %d + %d / %d) %% %d - i %% %d;\n", a, b, a * 7, b, b + 3, b + 1
+            } else {
+                printf "        int t%d = i * %d + s / %d;\n", k, a, b
+                printf "        int u%d = t%d * t%d - %d;\n", k, k, k, a
+                printf "        s = s + i %% %d;\n", b + 1
+            }
+        }
+        print "    }"
+        print "    yaz(s);"
+        print "    dondur 0;"
+        print "}"
+    }' > "bench_opt_$1.tc"
+}
+
+generate ayar $((40 * SCALE)) ayar
+generate sabit $((60 * SCALE)) sabit
+generate olu $((40 * SCALE)) olu
+generate karisik $((60 * SCALE)) karisik
+cp test2.tc bench_opt_test2.tc
+
+# $1: program, $2: tcir seçenekleri; komut sayıları ve en kısa süre
+measure() {
+    best=
+    for rep in 1 2 3; do
+        "$TCIR" $2 --run --stats "bench_opt_$1.tc" > bench_opt.out 2> bench_opt.err || true
+        t=$(awk '/^calistirma:/ { print $2 }' bench_opt.err)
+        best=$(awk -v t="$t" -v b="$best" \
+            'BEGIN { if (b != "" && b < t) t = b; printf "%.3f", t }')
+    done
+    static=$(awk '/^ir:/ { print $4 }' bench_opt.err)
+    dynamic=$(awk '/^calistirma:/ { print $4 }' bench_opt.err)
+    result=$(cat bench_opt.out bench_opt.err | sed '/^ir:/d; s/^calistirma:.*ana = //' | cksum)
+}
+
+printf "%-8s %21s %27s %19s\n" program "statik komut" "calisan komut" "sure (sn)"
+for p in test2 ayar sabit olu karisik; do
+    measure $p ""
+    s0=$static d0=$dynamic t0=$best r0=$result
+    measure $p "$OPT"
+    note=
+    [ "$result" = "$r0" ] || note="  FARKLI"
+    awk -v n="$p" -v s0="$s0" -v s1="$static" -v d0="$d0" -v d1="$dynamic" \
+        -v t0="$t0" -v t1="$best" -v x="$note" \
+        'BEGIN { printf "%-8s %6d -> %6d %4.0f%% %9d -> %9d %4.0f%% %6.3f -> %6.3f%s\n",
+                 n, s0, s1, 100 * (s0 - s1) / s0, d0, d1, 100 * (d0 - d1) / d0, t0, t1, x }'
+    rm -f "bench_opt_$p.tc"
+done
+rm -f bench_opt.out bench_opt.err
@@ -0,0 +1,84 @@
+#!/bin/sh
+# Ayrıştırıcı hızı: test2.tc'nin büyütülmüş hali.
+#
+#   ./bench_parse.sh [boyut_MB] [n]          varsayılan: 64 MB, n = 1000000
+#
+# Her kopyada fonksiyon adı değişir (ana_1, ana_2, ...), interning tablosu
+# da büyür. Önce sadece lexing (--lex-only), sonra lexing + ayrıştırma
+# ölçülür; fark ayrıştırıcının ve ağacın maliyetidir.
+#
+# Sonra n operatörlük tek ifadeler: uzun zincir, iç içe parantez, iç içe
+# çağrı, tekli eksi ve atama zinciri. Süre n ile doğrusal olmalı.
+set -e
+
+SIZE_MB=${1:-64}
+N=${2:-1000000}
+ASTDUMP=${ASTDUMP:-./astdump}
+INPUT=${INPUT:-bench_parse_input.tc}
+
+if [ ! -f "$INPUT" ] || [ "$(wc -c < "$INPUT")" -lt $((SIZE_MB * 1048576)) ]; then
+    echo "giris uretiliyor: $INPUT ($SIZE_MB MB)"
+    tr -d '\r' < test2.tc | awk -v size=$((SIZE_MB * 1048576)) '
+        { body = body $0 "\n" }
+        END {
+            for (i = 1; n < size; i++) {
+                s = body
+                sub(/ana/, "ana_" i, s)
+                printf "%s\n", s
+                n += length(s) + 1
+            }
+        }' > "$INPUT"
+fi
+bytes=$(wc -c < "$INPUT")
+echo "giris: $INPUT, $bytes byte"
+
+# 5 çalıştırmanın en kısası; $ASTDUMP --stats satırlarından süre alınır
+run() {
+    best=
+    for rep in 1 2 3 4 5; do
+        out=$("$ASTDUMP" --stats --quiet "$@" "$INPUT" 2>&1 > /dev/null)
+        t=$(echo "$out" | awk '/^sure:/ { print $2 }')
+        best=$(awk -v t="$t" -v b="$best" \
+            'BEGIN { if (b != "" && b < t) t = b; printf "%.3f", t }')
+    done
+    tokens=$(echo "$out" | awk '/^token:/ { print $2 }')
+    echo "$best $tokens"
+}
+
+# $1: etiket, sonrası astdump seçenekleri
+row() {
+    label=$1
+    shift
+    set -- $(run "$@")
+    awk -v n="$label" -v t="$1" -v k="$2" -v b="$bytes" \
+        'BEGIN { printf "%-24s %8.3f sn %8.1f MB/s %8.1f M token/s\n", n, t, b / t / 1048576, k / t / 1e6 }'
+}
+
+row "lex simd" --backend=simd --lex-only
+row "lex flex" --backend=flex --lex-only
+row "lex + parse simd" --backend=simd
+row "lex + parse flex" --backend=flex
+"$ASTDUMP" --stats --quiet "$INPUT" 2>&1 > /dev/null | grep '^dugum:'
+
+# $1: ad, $2: ön ek, $3: tekrarlanan parça, $4: orta, $5: kapanış parçası
+shape() {
+    f=bench_parse_$1.tc
+    awk -v n="$N" -v pre="$2" -v rep="$3" -v mid="$4" -v post="$5" 'BEGIN {
+        printf "int ana() { %s", pre
+        for (i = 0; i < n; i++) printf "%s", rep
+        printf "%s", mid
+        for (i = 0; i < n; i++) printf "%s", post
+        printf "; }\n"
+    }' > "$f"
+    out=$("$ASTDUMP" --stats --quiet "$f" 2>&1 > /dev/null) || { echo "$1: $out"; return; }
+    echo "$out" | awk -v n="$1" '/^sure:/ { printf "%-24s %8.3f sn %8.1f M token/s\n", n, $2, $4 }'
+    rm -f "$f"
+}
+
+echo "ifadeler: n = $N"
+shape zincir "i = i" " + 1" "" ""
+shape parantez "dondur " "(" "1" ")"
+shape sag_ic_ice "dondur " "1 + (" "1" ")"
+shape cagri "dondur " "f(" "1" ")"
+shape eksi "dondur " "-" "1" ""
+shape atama "" "a = " "1" ""
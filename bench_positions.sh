@@ -0,0 +1,66 @@
+#!/bin/sh
+# Satır/sütun takibinin maliyeti.
+#
+#   ./bench_positions.sh [boyut_MB]           varsayılan: 64 MB
+#
+# Satır ve sütun her token için hep hesaplanır; maliyeti görmek için
+# BASELINE'a sütun takibi olmayan bir scanner (örn. önceki sürüm) verilir.
+# Binary modda flex ve simd backend'leri, text modda --positions ölçülür.
+set -e
+
+SIZE_MB=${1:-64}
+SCANNER=${SCANNER:-./scanner}
+BASELINE=${BASELINE:-}
+INPUT=${INPUT:-bench_positions_input.tc}
+
+now() { date +%s.%N; }
+
+if [ ! -f "$INPUT" ] || [ "$(wc -c < "$INPUT")" -lt $((SIZE_MB * 1048576)) ]; then
+    echo "giris uretiliyor: $INPUT ($SIZE_MB MB)"
+    seed=$(mktemp)
+    {
+        cat test2.tc
+        printf '/* cok satirlik\n   yorum */ int a = 1;\n'
+        printf '        x = "iki\nsatir" ; y = x ;\n'
+        cat test1.tc
+    } > "$seed"
+    block=$(mktemp)
+    while [ "$(wc -c < "$block")" -lt 1048576 ]; do cat "$seed" >> "$block"; done
+    : > "$INPUT"
+    i=0
+    while [ $i -lt "$SIZE_MB" ]; do cat "$block"; i=$((i + 1)); done >> "$INPUT"
+    rm -f "$seed" "$block"
+fi
+bytes=$(wc -c < "$INPUT")
+echo "giris: $INPUT, $bytes byte"
+
+# 5 çalıştırmanın en kısası (sn); fark birkaç yüzde, gürültüden ayırmak için
+run() {
+    best=
+    for rep in 1 2 3 4 5; do
+        start=$(now)
+        "$@" "$INPUT" > /dev/null
+        end=$(now)
+        best=$(awk -v s="$start" -v e="$end" -v b="$best" \
+            'BEGIN { t = e - s; if (b != "" && b < t) t = b; printf "%.3f", t }')
+    done
+    echo "$best"
+}
+
+# $1: etiket, sonrası komut
+row() {
+    label=$1
+    shift
+    t=$(run "$@")
+    awk -v n="$label" -v t="$t" -v b="$bytes" \
+        'BEGIN { printf "%-34s %8.3f sn %8.1f MB/s\n", n, t, b / t / 1048576 }'
+}
+
+row "binary flex" "$SCANNER" --format=binary --backend=flex
+row "binary simd" "$SCANNER" --format=binary --backend=simd
+if [ -n "$BASELINE" ]; then
+    row "binary flex (baseline)" "$BASELINE" --format=binary --backend=flex
+    row "binary simd (baseline)" "$BASELINE" --format=binary --backend=simd
+fi
+row "text" "$SCANNER" --format=text
+row "text --positions" "$SCANNER" --format=text --positions
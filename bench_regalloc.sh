@@ -0,0 +1,143 @@
+#!/bin/sh
+# Yazmaç ataması benchmark'ı: döngü ağırlıklı programları tcasm ile üç
+# yoldan derleyip çalıştırır.
+#
+#   ./bench_regalloc.sh [ölçek]               varsayılan: 1
+#   ACCS="4 8 16" ./bench_regalloc.sh         baski programlarının toplayıcı sayıları
+#
+# agac ağaçtan üretilen koddur (her yerel çerçevede); yigin IR'dan -O
+# --regs=0 ile, yani her değer yığın yuvasında (temel); yazmac -O ile
+# doğrusal tarama. Her satır yığına düşen değer sayısını, üretilen koddaki
+# yığın yuvası işlenenlerini, çalıştırma süresini (3 çalıştırmanın en
+# kısası) ve yigin'a göre hız katını yazar. Çıktı veya çıkış kodu
+# değişirse FARKLI yazılır. baskiK programları iç döngüde K toplayıcıyı
+# aynı anda canlı tutar; K yazmaç sayısını aşınca yığına düşen değerler
+# başlar ve icin sayaçları yazmaçta kalır.
+set -e
+
+SCALE=${1:-1}
+TCASM=${TCASM:-./tcasm}
+CC=${CC:-cc}
+ACCS=${ACCS:-4 8 16}
+
+# $1: ad; program stdin'den, N yerine dış döngü tur sayısı yazılır
+program() {
+    sed "s/\bN\b/$((200000 * SCALE))/g" > "bench_regalloc_$1.tc"
+}
+
+program topla <<'TC'
+int ana() {
+    int s = 0;
+    icin (int k = 0; k < N; k = k + 1) {
+        icin (int i = 0; i < 1000; i = i + 1) {
+            s = s * 3 + i;
+        }
+    }
+    yaz(s);
+    dondur 0;
+}
+TC
+
+program icice <<'TC'
+int ana() {
+    int s = 0;
+    icin (int k = 0; k < N; k = k + 1) {
+        icin (int i = 0; i < 40; i = i + 1) {
+            icin (int j = 0; j < 25; j = j + 1) {
+                s = s * 5 + i * j - k;
+            }
+        }
+    }
+    yaz(s);
+    dondur 0;
+}
+TC
+
+# iç döngüdeki çağrı: çağrıdan geçen değerler korunan yazmaçlara
+program cagri <<'TC'
+int karistir(int a, int b) {
+    dondur (a * 31 + b) % 1009;
+}
+
+int ana() {
+    int s = 0;
+    int t = 1;
+    icin (int k = 0; k < N; k = k + 1) {
+        icin (int i = 0; i < 100; i = i + 1) {
+            s = karistir(s, i) + t;
+            t = t + s % 3;
+        }
+    }
+    yaz(s);
+    yaz(t);
+    dondur 0;
+}
+TC
+
+# $1: toplayıcı sayısı
+baski() {
+    k=$1
+    {
+        echo "int ana() {"
+        i=0
+        while [ $i -lt "$k" ]; do echo "    int a$i = $i;"; i=$((i + 1)); done
+        echo "    icin (int k = 0; k < N; k = k + 1) {"
+        echo "        icin (int i = 0; i < 100; i = i + 1) {"
+        i=0
+        while [ $i -lt "$k" ]; do
+            echo "            a$i = a$i * 3 + a$(( (i + 1) % k )) - i;"
+            i=$((i + 1))
+        done
+        echo "        }"
+        echo "    }"
+        i=0
+        while [ $i -lt "$k" ]; do echo "    yaz(a$i);"; i=$((i + 1)); done
+        echo "    dondur 0;"
+        echo "}"
+    } | program "baski$k"
+}
+
+for k in $ACCS; do
+    baski "$k"
+done
+
+# $1: program, $2...: tcasm seçenekleri; en kısa süre, istatistik, sonuç
+measure() {
+    p=$1
+    shift
+    "$TCASM" "$@" "bench_regalloc_$p.tc" -o bench_regalloc.s 2> bench_regalloc.err
+    "$CC" bench_regalloc.s -o bench_regalloc.bin
+    spilled=$(awk '/yigina dustu/ { print $6 }' bench_regalloc.err)
+    refs=$(awk '/yigin isleneni/ { print $(NF - 2) }' bench_regalloc.err)
+    [ -n "$spilled" ] || spilled=- refs=-
+    best=
+    for rep in 1 2 3; do
+        start=$(date +%s.%N)
+        rc=0
+        ./bench_regalloc.bin > bench_regalloc.out || rc=$?
+        stop=$(date +%s.%N)
+        best=$(awk -v a="$start" -v b="$stop" -v m="$best" \
+            'BEGIN { t = b - a; if (m != "" && m < t) t = m; printf "%.3f", t }')
+    done
+    result=$( (cat bench_regalloc.out; echo "$rc") | cksum)
+}
+
+printf "%-9s %-7s %13s %15s %9s %7s\n" program yol "yigina dusen" "yigin isleneni" "sure (sn)" hiz
+for p in topla icice cagri $(for k in $ACCS; do printf 'baski%s ' "$k"; done); do
+    measure "$p" -O --regs=0 --stats
+    t0=$best r0=$result s0=$spilled f0=$refs
+    for mode in agac yigin yazmac; do
+        case $mode in
+        agac)   measure "$p" ;;
+        yigin)  best=$t0 result=$r0 spilled=$s0 refs=$f0 ;;
+        yazmac) measure "$p" -O --stats ;;
+        esac
+        note=
+        [ "$result" = "$r0" ] || note="  FARKLI"
+        awk -v n="$p" -v m="$mode" -v s="$spilled" -v r="$refs" -v t0="$t0" -v t="$best" \
+            -v x="$note" 'BEGIN { printf "%-9s %-7s %13s %15s %9.3f %6.2fx%s\n",
+                                  n, m, s, r, t, t0 / t, x }'
+    done
+    rm -f "bench_regalloc_$p.tc"
+done
+rm -f bench_regalloc.s bench_regalloc.bin bench_regalloc.out bench_regalloc.err
@@ -0,0 +1,52 @@
+#!/bin/sh
+# Artımlı taramanın (turkc_relex.h) düzenleme başına maliyeti.
+#
+#   ./bench_relex.sh [satir]                  varsayılan: 10000 satır
+#
+# Her fonksiyonun önünde bir yorum, içinde bir string olan bir dosya
+# üretilir. Önce rastgele düzenlemeler (relexdiff, her biri tam taramayla
+# doğrulanır), sonra tek tek: satır ortasına bir karakter, dosyanın
+# ortasında yorum açma/kapama ve string açma. Tek '"' sonraki bütün
+# string'lerin içini dışına çevirir, tarama dosya sonuna gider.
+set -e
+
+LINES=${1:-10000}
+RELEXDIFF=${RELEXDIFF:-./relexdiff}
+INPUT=${INPUT:-bench_relex_input.tc}
+EDITS=${EDITS:-2000}
+
+awk -v n=$((LINES / 10)) 'BEGIN {
+    for (k = 1; k <= n; k++) {
+        printf "/* f%d: 0..n-1 toplaminin %d kati */\n", k, k
+        printf "int f%d(int n) {\n    int s = 0;\n", k
+        printf "    icin (int i = 0; i < n; i = i + 1) {\n        s = s + i * %d;\n    }\n", k
+        printf "    yaz(\"f%d bitti\");\n    dondur s;\n}\n\n", k
+    }
+    printf "int ana() {\n    dondur f1(3);\n}\n"
+}' > "$INPUT"
+bytes=$(wc -c < "$INPUT")
+echo "giris: $INPUT, $(wc -l < "$INPUT") satir, $bytes byte"
+
+# dosyanın ortasındaki fonksiyonun yorum sonu ve gövdesinin ilk satırı
+mid=$(( (LINES / 20) * 10 ))
+comment=$(head -n $((mid + 1)) "$INPUT" | wc -c)
+body=$(head -n $((mid + 2)) "$INPUT" | wc -c)
+body=$((body + 8))
+
+echo
+echo "rastgele ($EDITS duzenleme):"
+"$RELEXDIFF" -n "$EDITS" "$INPUT"
+
+# $1: etiket, sonrası düzenlemeler
+case_() {
+    label=$1
+    shift
+    echo
+    echo "$label:"
+    "$RELEXDIFF" "$@" "$INPUT" | sed "s|^$INPUT: ||"
+}
+
+case_ "karakter ekle/sil" -e "$body,0,t" -e "$body,1,"
+case_ "yorum ac/kapat" -e "$body,0,/*" -e "$body,2,"
+case_ "yorum sonunu sil/geri koy" -e "$((comment - 3)),2," -e "$((comment - 3)),0,*/"
+case_ "string ac/kapat" -e "$body,0,\"" -e "$body,1,"
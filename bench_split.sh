@@ -0,0 +1,62 @@
+#!/bin/sh
+# Dosya içi paralel tarama benchmark'ı (scanner --jobs, bkz. turkc_split.h).
+#
+#   ./bench_split.sh [boyut_MB] [jobs]        varsayılan: 2048 MB, çekirdek sayısı
+#
+# Sentetik girişte çok satırlık yorumlar ve string'ler bulunur, böylece chunk
+# sınırlarının bir kısmı token ortasına düşer. Önce çıktıların sıralı
+# taramayla aynı olduğu kontrol edilir, sonra binary modda süreler ölçülür.
+set -e
+
+SIZE_MB=${1:-2048}
+JOBS=${2:-0}
+SCANNER=${SCANNER:-./scanner}
+INPUT=${INPUT:-bench_split_input.tc}
+
+now() { date +%s.%N; }
+
+if [ ! -f "$INPUT" ] || [ "$(wc -c < "$INPUT")" -lt $((SIZE_MB * 1048576)) ]; then
+    echo "giris uretiliyor: $INPUT ($SIZE_MB MB)"
+    seed=$(mktemp)
+    {
+        cat test2.tc
+        printf '/* cok satirlik\n   yorum: eger (x) { dondur "y"; }\n*/\n'
+        printf 'int s = "satir\nasan string";\n'
+        printf '// tek satir yorum /* kapanmayan\n'
+        cat test1.tc
+    } > "$seed"
+    # seed'i 1 MB'a, sonra istenen boyuta katlayarak büyüt
+    block=$(mktemp)
+    while [ "$(wc -c < "$block")" -lt 1048576 ]; do cat "$seed" >> "$block"; done
+    : > "$INPUT"
+    i=0
+    while [ $i -lt "$SIZE_MB" ]; do cat "$block"; i=$((i + 1)); done >> "$INPUT"
+    rm -f "$seed" "$block"
+fi
+
+bytes=$(wc -c < "$INPUT")
+echo "giris: $INPUT, $bytes byte"
+
+echo "dogrulama..."
+seq_sum=$("$SCANNER" --format=binary "$INPUT" | cksum)
+par_sum=$("$SCANNER" --format=binary --jobs="$JOBS" "$INPUT" | cksum)
+if [ "$seq_sum" != "$par_sum" ]; then
+    echo "HATA: --jobs=$JOBS ciktisi sirali taramadan farkli" >&2
+    exit 1
+fi
+
+# süre (sn)
+run() {
+    start=$(now)
+    "$SCANNER" --format=binary "$@" "$INPUT" > /dev/null
+    end=$(now)
+    awk -v s="$start" -v e="$end" 'BEGIN { printf "%.3f", e - s }'
+}
+
+t_seq=$(run --jobs=1)
+t_par=$(run --jobs="$JOBS")
+awk -v b="$bytes" -v ts="$t_seq" -v tp="$t_par" -v j="$JOBS" 'BEGIN {
+    printf "sirali       %8.2f sn %8.1f MB/s\n", ts, b / ts / 1048576
+    printf "--jobs=%-5s %8.2f sn %8.1f MB/s\n", j, tp, b / tp / 1048576
+    printf "hizlanma     %8.2fx\n", ts / tp
+}'
@@ -0,0 +1,72 @@
+#!/bin/sh
+# flex tablo sıkıştırma modlarının karşılaştırması (bkz. Makefile).
+#
+#   make tables && ./bench_tables.sh [boyut_MB]     varsayılan: 64 MB
+#
+# Her scanner-<mod> için binary modda tarama hızı (3 çalıştırmanın en
+# iyisi), dosya boyu, text+data boyu ve flex tablolarının (yy_* sabit
+# dizileri) kapladığı bellek yazdırılır. Önce tüm modların çıktısının
+# scanner-Cem ile aynı olduğu kontrol edilir.
+set -e
+
+SIZE_MB=${1:-64}
+MODES=${MODES:-"Cem Ce Cm C Cfe CFe Cf CF"}
+INPUT=${INPUT:-bench_tables_input.tc}
+
+now() { date +%s.%N; }
+
+if [ ! -f "$INPUT" ] || [ "$(wc -c < "$INPUT")" -lt $((SIZE_MB * 1048576)) ]; then
+    echo "giris uretiliyor: $INPUT ($SIZE_MB MB)"
+    block=$(mktemp)
+    while [ "$(wc -c < "$block")" -lt 1048576 ]; do cat test1.tc test2.tc >> "$block"; done
+    : > "$INPUT"
+    i=0
+    while [ $i -lt "$SIZE_MB" ]; do cat "$block"; i=$((i + 1)); done >> "$INPUT"
+    rm -f "$block"
+fi
+bytes=$(wc -c < "$INPUT")
+echo "giris: $INPUT, $bytes byte"
+
+# flex tablolarının toplam boyu (byte): nm -S ile yy_* salt okunur/veri dizileri
+table_bytes() {
+    nm -S "$1" | {
+        total=0
+        while read -r addr size type name; do
+            case "$type" in [rRdD]) ;; *) continue ;; esac
+            case "$name" in yy_*) total=$((total + 0x$size)) ;; esac
+        done
+        echo $total
+    }
+}
+
+# 3 çalıştırmanın en kısası (sn)
+run() {
+    best=
+    for rep in 1 2 3; do
+        start=$(now)
+        "$1" --format=binary "$INPUT" > /dev/null
+        end=$(now)
+        best=$(awk -v s="$start" -v e="$end" -v b="$best" \
+            'BEGIN { t = e - s; if (b != "" && b < t) t = b; printf "%.3f", t }')
+    done
+    echo "$best"
+}
+
+echo "dogrulama..."
+ref=$(./scanner-Cem --format=binary "$INPUT" | cksum)
+for m in $MODES; do
+    if [ "$(./scanner-$m --format=binary "$INPUT" | cksum)" != "$ref" ]; then
+        echo "HATA: scanner-$m ciktisi scanner-Cem'den farkli" >&2
+        exit 1
+    fi
+done
+
+printf '%-6s %8s %10s %10s %10s %10s\n' mod sn MB/s dosya text+data tablo
+for m in $MODES; do
+    t=$(run "./scanner-$m")
+    file=$(wc -c < "scanner-$m")
+    mem=$(size "scanner-$m" | awk 'NR == 2 { print $1 + $2 }')
+    tab=$(table_bytes "scanner-$m")
+    awk -v m="$m" -v t="$t" -v b="$bytes" -v f="$file" -v s="$mem" -v k="$tab" \
+        'BEGIN { printf "%-6s %8.3f %10.1f %10d %10d %10d\n", m, t, b / t / 1048576, f, s, k }'
+done
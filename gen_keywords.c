@@ -0,0 +1,148 @@
+/* Anahtar kelime tablosu üreticisi.
+ *
+ * scanner.l'de anahtar kelimeler ayrı kurallar değildir: her identifier
+ * tek kuralla eşleşir, sonra turkc_keyword() ile sınıflandırılır. Bu
+ * program anahtar kelime listesi için çakışmasız (perfect) bir hash arar
+ * ve tabloyu turkc_keywords.h olarak yazar:
+ *
+ *   gcc gen_keywords.c -o gen_keywords && ./gen_keywords > turkc_keywords.h
+ *
+ * Yeni anahtar kelime: turkc_token.h'ye türü, turkc_token.c'ye yazımı,
+ * aşağıdaki listeye de satırı eklenip tablo yeniden üretilir. DFA büyümez.
+ */
+#include <stdio.h>
+#include <string.h>
+
+static const struct {
+    const char *text, *kind;
+} keywords[] = {
+    { "eger",    "TK_EGER" },
+    { "degilse", "TK_DEGILSE" },
+    { "icin",    "TK_ICIN" },
+    { "iken",    "TK_IKEN" },
+    { "dondur",  "TK_DONDUR" },
+    { "int",     "TK_INT" },
+    { "void",    "TK_VOID" },
+};
+
+#define NKEYWORDS   (sizeof(keywords) / sizeof(keywords[0]))
+#define MAX_SIZE    1024
+#define MAX_MUL     64
+
+/* turkc_keywords.h'deki hash'in aynısı */
+static unsigned hash(const char *s, size_t len, unsigned a, unsigned b, unsigned mask)
+{
+    return ((unsigned char)s[0] * a + (unsigned char)s[1] * b +
+            (unsigned char)s[len - 1] + (unsigned)len) & mask;
+}
+
+static int try_params(unsigned a, unsigned b, unsigned mask)
+{
+    static unsigned char used[MAX_SIZE];
+    size_t i, len;
+    unsigned h;
+
+    memset(used, 0, mask + 1);
+    for (i = 0; i < NKEYWORDS; i++) {
+        len = strlen(keywords[i].text);
+        h = hash(keywords[i].text, len, a, b, mask);
+        if (used[h])
+            return 0;
+        used[h] = 1;
+    }
+    return 1;
+}
+
+int main(void)
+{
+    size_t i, len, min_len = (size_t)-1, max_len = 0;
+    const char *slot[MAX_SIZE];
+    unsigned size, a = 0, b = 0, h;
+
+    for (i = 0; i < NKEYWORDS; i++) {
+        len = strlen(keywords[i].text);
+        if (len < 2) {
+            fprintf(stderr, "gen_keywords: %s: en az 2 karakter olmali\n", keywords[i].text);
+            return 1;
+        }
+        if (len < min_len)
+            min_len = len;
+        if (len > max_len)
+            max_len = len;
+    }
+
+    /* En küçük 2'nin kuvveti tablo, en küçük çarpanlar */
+    for (size = 1; size < NKEYWORDS; size *= 2)
+        ;
+    for (; size <= MAX_SIZE; size *= 2) {
+        for (a = 1; a < MAX_MUL; a++)
+            for (b = 0; b < MAX_MUL; b++)
+                if (try_params(a, b, size - 1))
+                    goto found;
+    }
+    fprintf(stderr, "gen_keywords: perfect hash bulunamadi\n");
+    return 1;
+
+found:
+    memset(slot, 0, sizeof(slot));
+    for (i = 0; i < NKEYWORDS; i++) {
+        len = strlen(keywords[i].text);
+        slot[hash(keywords[i].text, len, a, b, size - 1)] = keywords[i].kind;
+    }
+
+    printf("/* Bu dosya gen_keywords.c tarafından üretilir, elle değiştirmeyin. */\n"
+           "#ifndef TURKC_KEYWORDS_H\n"
+           "#define TURKC_KEYWORDS_H\n"
+           "\n"
+           "#include <stddef.h>\n"
+           "#include <string.h>\n"
+           "\n"
+           "#include \"turkc_token.h\"\n"
+           "\n"
+           "#define TURKC_KEYWORD_MIN_LEN %lu\n"
+           "#define TURKC_KEYWORD_MAX_LEN %lu\n"
+           "\n"
+           "/* Metin tabloda durur: hash'ten sonra tek bir cache satırı okunur */\n"
+           "static const struct {\n"
+           "    char text[%lu];\n"
+           "    unsigned char length, kind;\n"
+           "} turkc_keyword_table[%u] = {\n",
+           (unsigned long)min_len, (unsigned long)max_len, (unsigned long)max_len, size);
+    for (h = 0; h < size; h++) {
+        for (i = 0; i < NKEYWORDS && slot[h] && strcmp(keywords[i].kind, slot[h]) != 0; i++)
+            ;
+        if (slot[h])
+            printf("    [%u] = { \"%s\", %lu, %s },\n", h, keywords[i].text,
+                   (unsigned long)strlen(keywords[i].text), keywords[i].kind);
+    }
+    printf("};\n"
+           "\n"
+           "/* Identifier ise TK_IDENTIFIER, anahtar kelime ise türü. Tek hash,\n"
+           " * tek karşılaştırma; s NUL ile bitmek zorunda değil.\n"
+           " */\n"
+           "static inline int turkc_keyword(const char *s, size_t len)\n"
+           "{\n"
+           "    const char *k;\n"
+           "    unsigned h;\n"
+           "    int eq;\n"
+           "\n"
+           "    if (len < TURKC_KEYWORD_MIN_LEN || len > TURKC_KEYWORD_MAX_LEN)\n"
+           "        return TK_IDENTIFIER;\n"
+           "    h = ((unsigned char)s[0] * %uu + (unsigned char)s[1] * %uu +\n"
+           "         (unsigned char)s[len - 1] + (unsigned)len) & %uu;\n"
+           "    if (turkc_keyword_table[h].length != len)\n"
+           "        return TK_IDENTIFIER;\n"
+           "    /* sabit boylu memcmp'ler çağrı yerine birkaç load/compare olur */\n"
+           "    k = turkc_keyword_table[h].text;\n"
+           "    switch (len) {\n", a, b, size - 1);
+    for (len = min_len; len <= max_len; len++)
+        printf("    case %lu: eq = memcmp(k, s, %lu) == 0; break;\n",
+               (unsigned long)len, (unsigned long)len);
+    printf("    default: eq = 0;\n"
+           "    }\n"
+           "    return eq ? turkc_keyword_table[h].kind : TK_IDENTIFIER;\n"
+           "}\n"
+           "\n"
+           "#endif\n");
+    return 0;
+}
@@ -0,0 +1,190 @@
+/* lexdiff: flex backend'i ile elle yazılmış lexer'ı (turkc_fastlex.h)
+ * karşılaştırır. Bu CPU'da çalışan her SIMD backend'i için token akışı
+ * (tür, ofset, uzunluk, satır, sütun) flex'inkiyle aynı olmalıdır.
+ *
+ *   ./lexdiff test1.tc test2.tc       verilen dosyalar
+ *   ./lexdiff -r 10000                10000 rastgele giriş (tekrarlanabilir)
+ *
+ * Fark varsa ilk farklı token yazdırılır ve çıkış kodu 1 olur.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "turkc_fastlex.h"
+#include "turkc_lexer.h"
+#include "turkc_token.h"
+
+static const enum turkc_simd backends[] = {
+    TURKC_SIMD_SCALAR, TURKC_SIMD_SSE2, TURKC_SIMD_AVX2
+};
+
+/* Hata (-1) için mesajı */
+static const char *kind_name(int kind, const char *error)
+{
+    if (kind < 0)
+        return error;
+    return kind == TK_EOF ? "EOF" : turkc_token_category(kind);
+}
+
+/* 0: aynı, 1: farklı, -1: bellek yetersiz. Kapanmayan string/yorum
+ * hatalarının mesajı ve konumu da karşılaştırılır.
+ */
+static int compare(const char *name, const char *src, size_t len)
+{
+    struct turkc_fastlex fl;
+    struct turkc_token a, b;
+    turkc_lexer *lx;
+    size_t i;
+    int ka, kb, rc = 0;
+
+    for (i = 0; i < sizeof(backends) / sizeof(backends[0]) && rc == 0; i++) {
+        if (turkc_fastlex_init(&fl, src, len, backends[i]) != 0)
+            continue;               /* bu CPU'da yok */
+        lx = turkc_lexer_open_string(src, len);
+        if (!lx) {
+            fprintf(stderr, "lexdiff: bellek yetersiz\n");
+            return -1;
+        }
+        do {
+            ka = turkc_lexer_next(lx, &a);
+            kb = turkc_fastlex_next(&fl, &b);
+            if (ka < 0)
+                a.length = 0;       /* hatada length verilmez */
+            if (kb < 0)
+                b.length = 0;
+            if (ka != kb || a.offset != b.offset || a.length != b.length ||
+                a.line != b.line || a.column != b.column ||
+                (ka < 0 && strcmp(turkc_lexer_error(lx), fl.error) != 0)) {
+                printf("%s: %s farkli\n"
+                       "  flex: %s ofset %lu uzunluk %lu satir %lu sutun %lu\n"
+                       "  %-4s: %s ofset %lu uzunluk %lu satir %lu sutun %lu\n",
+                       name, turkc_simd_name(backends[i]),
+                       kind_name(ka, turkc_lexer_error(lx)), a.offset,
+                       (unsigned long)a.length, a.line, a.column,
+                       turkc_simd_name(backends[i]),
+                       kind_name(kb, fl.error), b.offset, (unsigned long)b.length, b.line, b.column);
+                rc = 1;
+                break;
+            }
+        } while (ka > 0);
+        turkc_lexer_close(lx);
+    }
+    return rc;
+}
+
+static char *read_file(const char *path, size_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    char *buf = NULL, *p;
+    size_t cap = 0, n;
+
+    if (!f)
+        return NULL;
+    *len = 0;
+    do {
+        if (*len == cap) {
+            cap = cap ? cap * 2 : 65536;
+            p = realloc(buf, cap);
+            if (!p) {
+                free(buf);
+                fclose(f);
+                return NULL;
+            }
+            buf = p;
+        }
+        n = fread(buf + *len, 1, cap - *len, f);
+        *len += n;
+    } while (n > 0);
+    fclose(f);
+    return buf;
+}
+
+/* Sınır durumlarını sık üreten parçalar: yorum/string başı ve sonu,
+ * iki karakterli operatörlerin yarıları, anahtar kelime önekleri, NUL.
+ */
+static const char *const pieces[] = {
+    " ", "\t", "\n", "\r\n", "/", "*", "*/", "/*", "//", "\"", "=", "!", "<", ">",
+    "eger", "degilse", "icin", "iken", "dondur", "int", "void", "ege", "intx", "_a1",
+    "x", "Z9", "0", "123", "+", "-", "%", "(", ")", "{", "}", ";", ",", "@", "\\",
+    "\xc3\xbc", "\x7f"
+};
+
+static unsigned long long rng_state = 88172645463325252ULL;
+
+static unsigned rng(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (unsigned)(rng_state >> 32);
+}
+
+static size_t random_input(char *buf, size_t max)
+{
+    size_t len = 0, target = rng() % 8 == 0 ? max : rng() % 512, n;
+    unsigned reps;
+    const char *piece;
+
+    while (len < target) {
+        if (rng() % 64 == 0) {
+            buf[len++] = '\0';
+            continue;
+        }
+        piece = pieces[rng() % (sizeof(pieces) / sizeof(pieces[0]))];
+        /* uzun whitespace/identifier koşuları SIMD döngülerini çalıştırır */
+        for (reps = rng() % 16 == 0 ? 1 + rng() % 40 : 1; reps > 0; reps--) {
+            n = strlen(piece);
+            if (n > target - len)
+                n = target - len;
+            memcpy(buf + len, piece, n);
+            len += n;
+        }
+    }
+    return len;
+}
+
+int main(int argc, char **argv)
+{
+    static char buf[65536];
+    char name[32];
+    char *src;
+    size_t len;
+    long count, n;
+    int i, r, rc = 0;
+
+    if (argc < 2) {
+        fprintf(stderr, "kullanim: %s [-r sayi] dosya...\n", argv[0]);
+        return 2;
+    }
+    printf("backend: %s\n", turkc_simd_name(turkc_simd_detect()));
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+            count = atol(argv[++i]);
+            for (n = 0; n < count && rc == 0; n++) {
+                len = random_input(buf, sizeof(buf));
+                sprintf(name, "rastgele #%ld", n);
+                r = compare(name, buf, len);
+                if (r != 0)
+                    rc = 1;
+            }
+            if (rc == 0)
+                printf("%ld rastgele giris ayni\n", count);
+            continue;
+        }
+        src = read_file(argv[i], &len);
+        if (!src) {
+            fprintf(stderr, "lexdiff: %s okunamadi\n", argv[i]);
+            rc = 1;
+            continue;
+        }
+        r = compare(argv[i], src, len);
+        if (r == 0)
+            printf("%s: ayni\n", argv[i]);
+        else
+            rc = 1;
+        free(src);
+    }
+    return rc;
+}
@@ -0,0 +1,367 @@
+/* lspclient: dil sunucusunu (tclsp) alt süreç olarak başlatıp bir betiği
+ * çalıştıran küçük LSP istemcisi. Ağ yok, yalnız pipe'lar.
+ *
+ *   ./lspclient betik.txt ./tclsp --trace
+ *   ./lspclient -q betik.txt ./tclsp         yalnız süreler
+ *
+ * Betik satırları ('#' yorum):
+ *
+ *   request METOT JSON             istek gönder, yanıtı bekle
+ *   notify METOT JSON              bildirim gönder
+ *   open URI DOSYA                 didOpen (metin dosyadan), tanıları bekle
+ *   edit URI S1 K1 S2 K2 [METIN]   didChange: [S1:K1, S2:K2) aralığı METIN olur
+ *                                  (\n, \t, \\ kaçışları), tanıları bekle
+ *   repeat N request METOT JSON    N kez; en az, ortanca ve en çok süre
+ *
+ * Her yanıtın ve bildirimin süresi (gönderimden itibaren) ve gövdesinin
+ * başı yazdırılır. Betik bitince shutdown ve exit gönderilir (betikte
+ * yoksa). Çıkış kodu sunucununkidir; hata yanıtı geldiyse 1.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "turkc_json.h"
+#include "turkc_time.h"
+
+#define SHOW 200                /* gövdeden yazdırılan byte */
+
+struct client {
+    FILE *to, *from;
+    int quiet, errors, exited;
+    long id;
+    struct turkc_json js;
+    struct turkc_json_buf out;
+    char *msg;
+    size_t msg_cap, msg_len;
+    unsigned long versions;     /* edit'lerin sürüm sayacı */
+};
+
+static char *read_file(const char *path, size_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    char *buf = NULL;
+    long size;
+
+    if (!f)
+        return NULL;
+    if (fseek(f, 0, SEEK_END) == 0 && (size = ftell(f)) >= 0 && fseek(f, 0, SEEK_SET) == 0) {
+        buf = malloc((size_t)size + 1);
+        if (buf && fread(buf, 1, (size_t)size, f) != (size_t)size) {
+            free(buf);
+            buf = NULL;
+        }
+        *len = (size_t)size;
+    }
+    fclose(f);
+    return buf;
+}
+
+static int send_message(struct client *c, const struct turkc_json_buf *body)
+{
+    if (body->oom)
+        return -1;
+    fprintf(c->to, "Content-Length: %lu\r\n\r\n", (unsigned long)body->len);
+    fwrite(body->data, 1, body->len, c->to);
+    return fflush(c->to) == 0 ? 0 : -1;
+}
+
+/* Sıradaki mesaj; giriş bitince -1 */
+static int receive(struct client *c)
+{
+    char line[256], *p;
+    size_t len = (size_t)-1;
+
+    while (fgets(line, sizeof(line), c->from) && line[0] != '\r' && line[0] != '\n')
+        if (strncmp(line, "Content-Length:", 15) == 0)
+            len = strtoul(line + 15, NULL, 10);
+    if (feof(c->from) || ferror(c->from) || len == (size_t)-1)
+        return -1;
+    if (len + 1 > c->msg_cap) {
+        p = realloc(c->msg, len + 1);
+        if (!p)
+            return -1;
+        c->msg = p;
+        c->msg_cap = len + 1;
+    }
+    if (fread(c->msg, 1, len, c->from) != len)
+        return -1;
+    c->msg[len] = '\0';
+    c->msg_len = len;
+    return turkc_json_parse(&c->js, c->msg, len) == 0 ? 0 : -1;
+}
+
+static void show(const struct client *c, const char *what, double start)
+{
+    printf("%-40s %9.3f ms", what, (turkc_now() - start) * 1e3);
+    if (!c->quiet)
+        printf("  %.*s%s", (int)(c->msg_len < SHOW ? c->msg_len : SHOW), c->msg,
+               c->msg_len > SHOW ? "..." : "");
+    printf("  (%lu byte)\n", (unsigned long)c->msg_len);
+}
+
+/* id'li yanıtı (id < 0 ise tanı bildirimini) bekler; aradaki
+ * bildirimleri yazdırır. Süre döner, giriş biterse -1.
+ */
+static double wait_for(struct client *c, long id, const char *what, double start)
+{
+    uint32_t method, mid;
+    double t;
+
+    for (;;) {
+        if (receive(c) != 0)
+            return -1;
+        method = turkc_json_get(&c->js, 1, "method");
+        mid = turkc_json_get(&c->js, 1, "id");
+        t = (turkc_now() - start) * 1e3;
+        if (method && turkc_json_equals(&c->js, method, "textDocument/publishDiagnostics")) {
+            show(c, id < 0 ? what : "publishDiagnostics", start);
+            if (id < 0)
+                return t;
+        } else if (!method && mid && turkc_json_int(&c->js, mid, -1) == id) {
+            if (turkc_json_get(&c->js, 1, "error"))
+                c->errors++;
+            if (what)
+                show(c, what, start);
+            return t;
+        } else {
+            show(c, "?", start);
+        }
+    }
+}
+
+static double request(struct client *c, const char *method, const char *params,
+                      const char *what)
+{
+    double start;
+
+    c->out.len = 0;
+    turkc_json_printf(&c->out, "{\"jsonrpc\":\"2.0\",\"id\":%ld,\"method\":\"%s\",\"params\":%s}",
+                      ++c->id, method, params);
+    start = turkc_now();
+    if (send_message(c, &c->out) != 0)
+        return -1;
+    return wait_for(c, c->id, what, start);
+}
+
+static int notify(struct client *c, const char *method, const char *params)
+{
+    c->out.len = 0;
+    turkc_json_printf(&c->out, "{\"jsonrpc\":\"2.0\",\"method\":\"%s\",\"params\":%s}",
+                      method, params);
+    if (strcmp(method, "exit") == 0)
+        c->exited = 1;
+    return send_message(c, &c->out);
+}
+
+static double open_doc(struct client *c, const char *uri, const char *path)
+{
+    size_t len;
+    char *text = read_file(path, &len);
+    double start;
+
+    if (!text) {
+        fprintf(stderr, "lspclient: %s okunamadi\n", path);
+        return -1;
+    }
+    c->out.len = 0;
+    turkc_json_puts(&c->out, "{\"jsonrpc\":\"2.0\",\"method\":\"textDocument/didOpen\","
+                    "\"params\":{\"textDocument\":{\"uri\":");
+    turkc_json_quote(&c->out, uri, strlen(uri));
+    turkc_json_puts(&c->out, ",\"languageId\":\"turkc\",\"version\":0,\"text\":");
+    turkc_json_quote(&c->out, text, len);
+    turkc_json_puts(&c->out, "}}}");
+    free(text);
+    start = turkc_now();
+    if (send_message(c, &c->out) != 0)
+        return -1;
+    return wait_for(c, -1, "didOpen", start);
+}
+
+/* \n, \t ve \\ kaçışlarını çözer (yerinde) */
+static size_t unescape(char *s)
+{
+    char *p = s, *q = s;
+
+    while (*p) {
+        if (p[0] == '\\' && p[1]) {
+            p++;
+            *q++ = *p == 'n' ? '\n' : *p == 't' ? '\t' : *p;
+            p++;
+        } else {
+            *q++ = *p++;
+        }
+    }
+    return (size_t)(q - s);
+}
+
+static double edit(struct client *c, const char *uri, long l1, long c1, long l2, long c2,
+                   char *text)
+{
+    size_t len = unescape(text);
+    double start;
+
+    c->out.len = 0;
+    turkc_json_puts(&c->out, "{\"jsonrpc\":\"2.0\",\"method\":\"textDocument/didChange\","
+                    "\"params\":{\"textDocument\":{\"uri\":");
+    turkc_json_quote(&c->out, uri, strlen(uri));
+    turkc_json_printf(&c->out, ",\"version\":%lu},\"contentChanges\":[{\"range\":"
+                      "{\"start\":{\"line\":%ld,\"character\":%ld},"
+                      "\"end\":{\"line\":%ld,\"character\":%ld}},\"text\":",
+                      ++c->versions, l1, c1, l2, c2);
+    turkc_json_quote(&c->out, text, len);
+    turkc_json_puts(&c->out, "}]}}");
+    start = turkc_now();
+    if (send_message(c, &c->out) != 0)
+        return -1;
+    return wait_for(c, -1, "didChange", start);
+}
+
+static int compare(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+
+    return x < y ? -1 : x > y;
+}
+
+static int repeat(struct client *c, unsigned long n, const char *method, const char *params)
+{
+    double *t = malloc((n ? n : 1) * sizeof(*t));
+    unsigned long i;
+
+    if (!t || n == 0) {
+        free(t);
+        return -1;
+    }
+    for (i = 0; i < n; i++) {
+        t[i] = request(c, method, params, i == 0 ? method : NULL);
+        if (t[i] < 0) {
+            free(t);
+            return -1;
+        }
+    }
+    qsort(t, n, sizeof(*t), compare);
+    printf("%-40s %lu kez: en az %.3f ms, ortanca %.3f ms, en cok %.3f ms\n", method, n,
+           t[0], t[n / 2], t[n - 1]);
+    free(t);
+    return 0;
+}
+
+/* Betik satırı; hata olursa -1 */
+static int run_line(struct client *c, char *line)
+{
+    char cmd[16], a[1024], b[1024];
+    long l1, c1, l2, c2;
+    unsigned long n;
+    int used = 0;
+
+    line[strcspn(line, "\r\n")] = '\0';
+    if (line[0] == '#' || sscanf(line, "%15s", cmd) != 1)
+        return 0;
+    if (strcmp(cmd, "request") == 0 && sscanf(line, "request %1023s %n", a, &used) == 1)
+        return request(c, a, line[used] ? line + used : "null", a) < 0 ? -1 : 0;
+    if (strcmp(cmd, "notify") == 0 && sscanf(line, "notify %1023s %n", a, &used) == 1)
+        return notify(c, a, line[used] ? line + used : "null");
+    if (strcmp(cmd, "open") == 0 && sscanf(line, "open %1023s %1023s", a, b) == 2)
+        return open_doc(c, a, b) < 0 ? -1 : 0;
+    if (strcmp(cmd, "edit") == 0 &&
+        sscanf(line, "edit %1023s %ld %ld %ld %ld%n", a, &l1, &c1, &l2, &c2, &used) == 5) {
+        if (line[used] == ' ')
+            used++;
+        return edit(c, a, l1, c1, l2, c2, line + used) < 0 ? -1 : 0;
+    }
+    if (strcmp(cmd, "repeat") == 0 &&
+        sscanf(line, "repeat %lu request %1023s %n", &n, a, &used) == 2)
+        return repeat(c, n, a, line[used] ? line + used : "null");
+    fprintf(stderr, "lspclient: anlasilmayan satir: %s\n", line);
+    return -1;
+}
+
+int main(int argc, char **argv)
+{
+    struct client c;
+    int to[2], from[2], status, i = 1, rc = 0;
+    char *line = NULL;
+    size_t cap = 0;
+    FILE *script;
+    pid_t pid;
+
+    memset(&c, 0, sizeof(c));
+    if (i < argc && strcmp(argv[i], "-q") == 0) {
+        c.quiet = 1;
+        i++;
+    }
+    if (argc - i < 2) {
+        fprintf(stderr, "kullanim: %s [-q] betik sunucu [arguman]...\n", argv[0]);
+        return 2;
+    }
+    script = fopen(argv[i], "r");
+    if (!script) {
+        fprintf(stderr, "lspclient: %s acilamadi\n", argv[i]);
+        return 1;
+    }
+    if (pipe(to) != 0 || pipe(from) != 0) {
+        perror("lspclient: pipe");
+        return 1;
+    }
+    pid = fork();
+    if (pid < 0) {
+        perror("lspclient: fork");
+        return 1;
+    }
+    if (pid == 0) {
+        dup2(to[0], 0);
+        dup2(from[1], 1);
+        close(to[0]);
+        close(to[1]);
+        close(from[0]);
+        close(from[1]);
+        execv(argv[i + 1], argv + i + 1);
+        perror("lspclient: exec");
+        _exit(127);
+    }
+    close(to[0]);
+    close(from[1]);
+    c.to = fdopen(to[1], "w");
+    c.from = fdopen(from[0], "r");
+    if (!c.to || !c.from) {
+        perror("lspclient: fdopen");
+        return 1;
+    }
+
+    while (getline(&line, &cap, script) > 0 && !c.exited)
+        if (run_line(&c, line) != 0) {
+            rc = 1;
+            break;
+        }
+    if (!c.exited && rc == 0) {
+        request(&c, "shutdown", "null", "shutdown");
+        notify(&c, "exit", "null");
+    }
+    fclose(c.to);
+    /* exit'ten sonra gelenleri de yazdır */
+    while (receive(&c) == 0)
+        show(&c, "?", turkc_now());
+    fclose(c.from);
+    fclose(script);
+    free(line);
+    if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status)) {
+        fprintf(stderr, "lspclient: sunucu beklenmedik sekilde bitti\n");
+        rc = 1;
+    } else {
+        printf("sunucu cikis kodu %d\n", WEXITSTATUS(status));
+        if (WEXITSTATUS(status) != 0)
+            rc = 1;
+    }
+    if (c.errors > 0) {
+        fprintf(stderr, "lspclient: %d hata yaniti\n", c.errors);
+        rc = 1;
+    }
+    free(c.msg);
+    turkc_json_free(&c.js);
+    turkc_json_buf_free(&c.out);
+    return rc;
+}
@@ -0,0 +1,262 @@
+/* relexdiff: artımlı taramayı (turkc_relex.h) tam taramayla karşılaştırır.
+ * Dosyaya tekrarlanabilir rastgele düzenlemeler uygulanır; her birinden
+ * sonra token dizisi (tür, ofset, uzunluk, satır, sütun) ve kapanmayan
+ * string/yorum hatası, metnin baştan taranmasıyla aynı olmalıdır.
+ * Düzenlemeler sık sık yorum açıp kapatan parçalar ve '"' ekler veya
+ * siler, böylece tarama düzenlemeden çok uzağa taşar.
+ *
+ *   ./relexdiff test1.tc big.tc              1000 düzenleme
+ *   ./relexdiff -n 20000 -s 7 big.tc         20000 düzenleme, tohum 7
+ *   ./relexdiff -e 0,0,x -e 5,1, big.tc      verilen düzenlemeler (ofset,sil,metin)
+ *
+ * Sonda düzenleme başına ortalama süre (artımlı ve tam tarama), yeniden
+ * taranan byte ve değişen token sayısı yazılır. Fark varsa ilk farklı
+ * token yazdırılır ve çıkış kodu 1 olur.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "turkc_relex.h"
+#include "turkc_time.h"
+#include "turkc_token.h"
+
+#define MAX_EDITS 64
+
+struct edit {
+    size_t offset, removed;
+    const char *text;
+};
+
+struct totals {
+    unsigned long edits;
+    double relex_seconds, full_seconds;
+    unsigned long long relexed, tokens;
+    size_t max_relexed;
+};
+
+static char *read_file(const char *path, size_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    char *buf = NULL, *p;
+    size_t cap = 0, n;
+
+    if (!f)
+        return NULL;
+    *len = 0;
+    do {
+        if (*len == cap) {
+            cap = cap ? cap * 2 : 65536;
+            p = realloc(buf, cap);
+            if (!p) {
+                free(buf);
+                fclose(f);
+                return NULL;
+            }
+            buf = p;
+        }
+        n = fread(buf + *len, 1, cap - *len, f);
+        *len += n;
+    } while (n > 0);
+    fclose(f);
+    return buf;
+}
+
+/* Eklenen parçalar: yorum/string sınırları ağırlıklı */
+static const char *const pieces[] = {
+    "/*", "/*", "*/", "*/", "\"", "\"", "//", "\n", " ", "/", "*", "=", "!",
+    "<", ">", "x", "eger", "int", "_a1", "123", "(", ")", "{", "}", ";",
+    "x = x + 1;\n", "yaz(\"a\");\n", "/* yorum */", "\"str\"", "\r\n", "@"
+};
+
+static unsigned long long rng_state = 88172645463325252ULL;
+
+static unsigned rng(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (unsigned)(rng_state >> 32);
+}
+
+static void random_edit(size_t len, struct edit *e)
+{
+    unsigned r = rng() % 10;
+
+    e->offset = len ? rng() % (len + 1) : 0;
+    e->removed = 0;
+    e->text = "";
+    if (r >= 5) {               /* silme veya değiştirme */
+        e->removed = 1 + rng() % (r == 9 ? 64 : 4);
+        if (e->removed > len - e->offset)
+            e->removed = len - e->offset;
+    }
+    if (r < 5 || r >= 8)
+        e->text = pieces[rng() % (sizeof(pieces) / sizeof(pieces[0]))];
+}
+
+/* rx tam taramayla aynı mı; 0: aynı, 1: farklı */
+static int verify(const char *name, const struct turkc_relex *rx, double *seconds)
+{
+    struct turkc_fastlex fl;
+    struct turkc_token tok;
+    unsigned long line, column;
+    uint32_t i = 0;
+    double t0 = turkc_now();
+    int kind;
+
+    /* süre yalnız taramanındır, karşılaştırma ayrı bir geçişte */
+    turkc_fastlex_init(&fl, rx->text, rx->len, rx->simd);
+    while (turkc_fastlex_next(&fl, &tok) > 0)
+        i++;
+    *seconds += turkc_now() - t0;
+
+    i = 0;
+    turkc_fastlex_init(&fl, rx->text, rx->len, rx->simd);
+    while ((kind = turkc_fastlex_next(&fl, &tok)) > 0) {
+        if (i >= rx->ntoks)
+            break;
+        turkc_relex_position(rx, rx->toks[i].offset, &line, &column);
+        if (rx->toks[i].kind != kind || rx->toks[i].offset != tok.offset ||
+            rx->toks[i].length != tok.length || line != tok.line || column != tok.column)
+            break;
+        i++;
+    }
+    if (kind > 0 || i != rx->ntoks) {
+        if (i < rx->ntoks)
+            turkc_relex_position(rx, rx->toks[i].offset, &line, &column);
+        printf("%s: token %lu farkli\n"
+               "  tam:     %s ofset %lu uzunluk %lu satir %lu sutun %lu\n"
+               "  artimli: %s ofset %lu uzunluk %lu satir %lu sutun %lu\n",
+               name, (unsigned long)i,
+               kind > 0 ? turkc_token_category(kind) : "son", tok.offset,
+               (unsigned long)tok.length, tok.line, tok.column,
+               i < rx->ntoks ? turkc_token_category(rx->toks[i].kind) : "son",
+               i < rx->ntoks ? (unsigned long)rx->toks[i].offset : 0UL,
+               i < rx->ntoks ? (unsigned long)rx->toks[i].length : 0UL,
+               i < rx->ntoks ? line : 0UL, i < rx->ntoks ? column : 0UL);
+        return 1;
+    }
+    if ((kind < 0) != (rx->error != NULL) ||
+        (kind < 0 && (strcmp(fl.error, rx->error) != 0 || tok.offset != rx->error_offset))) {
+        printf("%s: hata farkli\n  tam:     %s ofset %lu\n  artimli: %s ofset %lu\n",
+               name, kind < 0 ? fl.error : "yok", kind < 0 ? tok.offset : 0UL,
+               rx->error ? rx->error : "yok", (unsigned long)rx->error_offset);
+        return 1;
+    }
+    return 0;
+}
+
+/* 0: aynı, 1: farklı, -1: bellek yetersiz */
+static int run(const char *name, const char *src, size_t len, const struct edit *edits,
+               int nedits, unsigned long count, struct totals *t)
+{
+    struct turkc_relex rx;
+    struct turkc_relex_change ch;
+    struct edit e;
+    unsigned long n;
+    double t0;
+    char where[64];
+    int rc = 0;
+
+    if (turkc_relex_init(&rx, src, len, TURKC_SIMD_AUTO) != 0) {
+        fprintf(stderr, "relexdiff: bellek yetersiz\n");
+        return -1;
+    }
+    if (verify(name, &rx, &t->full_seconds) != 0) {
+        turkc_relex_free(&rx);
+        return 1;
+    }
+    t->full_seconds = 0;
+    for (n = 0; n < (nedits ? (unsigned long)nedits : count) && rc == 0; n++) {
+        if (nedits) {
+            e = edits[n];
+            if (e.offset > rx.len)
+                e.offset = rx.len;
+            if (e.removed > rx.len - e.offset)
+                e.removed = rx.len - e.offset;
+        } else {
+            random_edit(rx.len, &e);
+        }
+        t0 = turkc_now();
+        if (turkc_relex_edit(&rx, e.offset, e.removed, e.text, strlen(e.text), &ch) != 0) {
+            fprintf(stderr, "relexdiff: bellek yetersiz\n");
+            rc = -1;
+            break;
+        }
+        t->relex_seconds += turkc_now() - t0;
+        t->edits++;
+        t->relexed += ch.relexed;
+        t->tokens += ch.inserted;
+        if (ch.relexed > t->max_relexed)
+            t->max_relexed = ch.relexed;
+        if (nedits)
+            printf("%s: ofset %lu -%lu +%lu byte: token #%lu: %lu eski yerine %lu yeni, "
+                   "%lu byte tarandi\n", name, (unsigned long)e.offset,
+                   (unsigned long)e.removed, (unsigned long)strlen(e.text),
+                   (unsigned long)ch.first, (unsigned long)ch.removed,
+                   (unsigned long)ch.inserted, (unsigned long)ch.relexed);
+        sprintf(where, "%s, duzenleme #%lu", name, n);
+        rc = verify(where, &rx, &t->full_seconds);
+    }
+    turkc_relex_free(&rx);
+    return rc;
+}
+
+int main(int argc, char **argv)
+{
+    struct edit edits[MAX_EDITS];
+    struct totals t;
+    unsigned long count = 1000;
+    char *src, *comma;
+    size_t len;
+    int i, nedits = 0, files = 0, rc = 0;
+
+    memset(&t, 0, sizeof(t));
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            count = strtoul(argv[++i], NULL, 10);
+            continue;
+        }
+        if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            rng_state += strtoull(argv[++i], NULL, 10) * 0x9e3779b97f4a7c15ULL;
+            continue;
+        }
+        if (strcmp(argv[i], "-e") == 0 && i + 1 < argc && nedits < MAX_EDITS) {
+            edits[nedits].offset = strtoul(argv[++i], &comma, 10);
+            if (*comma != ',')
+                break;
+            edits[nedits].removed = strtoul(comma + 1, &comma, 10);
+            if (*comma != ',')
+                break;
+            edits[nedits++].text = comma + 1;
+            continue;
+        }
+        if (argv[i][0] == '-')
+            break;
+        files++;
+        src = read_file(argv[i], &len);
+        if (!src) {
+            fprintf(stderr, "relexdiff: %s okunamadi\n", argv[i]);
+            rc = 1;
+            continue;
+        }
+        if (run(argv[i], src, len, edits, nedits, count, &t) != 0)
+            rc = 1;
+        free(src);
+    }
+    if (i < argc || files == 0) {
+        fprintf(stderr, "kullanim: %s [-n sayi] [-s tohum] [-e ofset,sil,metin]... dosya...\n",
+                argv[0]);
+        return 2;
+    }
+    if (rc == 0 && t.edits > 0)
+        printf("%lu duzenleme ayni\n"
+               "  artimli: %.2f us/duzenleme, %.0f byte ve %.1f token yeniden tarandi "
+               "(en fazla %lu byte)\n"
+               "  tam:     %.2f us/tarama\n",
+               t.edits, t.relex_seconds * 1e6 / t.edits, (double)t.relexed / t.edits,
+               (double)t.tokens / t.edits, (unsigned long)t.max_relexed,
+               t.full_seconds * 1e6 / t.edits);
+    return rc;
+}
@@ -0,0 +1,278 @@
+/* scanner: TurkC kaynağını (dosya ya da stdin) token'lara ayırır.
+ *
+ *   ./scanner < test1.tc                    (KEYWORD: int ...)
+ *   ./scanner --format=binary test1.tc      (bkz. turkc_tokstream.h)
+ *
+ * Normal dosyalar mmap ile okunur; pipe girişinde veya --no-mmap ile
+ * stream okunur. --jobs=N (0: çekirdek sayısı) büyük bir dosyayı parçalara
+ * bölüp N thread'le tarar, çıktı sıralı taramayla aynıdır (bkz. turkc_split.h);
+ * yalnızca flex backend'iyle kullanılabilir.
+ * --backend=simd flex yerine elle yazılmış SIMD lexer'ı kullanır
+ * (bkz. turkc_fastlex.h); scalar/sse2/avx2 belirli bir çekirdeği zorlar.
+ * --intern identifier ve string'lerin yerine sembol ID'si yazar, sembol
+ * tablosu çıktının sonuna bir kez eklenir (bkz. turkc_intern.h).
+ * --positions text çıktıda her token'ın önüne "satır:sütun: " yazar.
+ * Tarama hatasında çıkış kodu 1'dir; hataya kadarki token'lar (ve
+ * --intern'de sembol tablosu) her iki biçimde de yazılmış olur.
+ */
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "turkc_fastlex.h"
+#include "turkc_intern.h"
+#include "turkc_lexer.h"
+#include "turkc_mmap.h"
+#include "turkc_split.h"
+#include "turkc_token.h"
+#include "turkc_tokstream.h"
+
+struct output {
+    struct turkc_tokstream_writer *bin;     /* NULL: text */
+    struct turkc_intern *syms;              /* --intern */
+    int positions;                          /* --positions */
+};
+
+static int emit_token(void *ctx, int kind, const char *text, unsigned long length,
+                      unsigned long offset, unsigned long line, unsigned long column)
+{
+    struct output *out = ctx;
+    uint32_t id;
+
+    if (out->positions && !out->bin)
+        printf("%lu:%lu: ", line, column);
+
+    if (out->syms && (kind == TK_IDENTIFIER || kind == TK_STRING)) {
+        id = turkc_intern(out->syms, text, length);
+        if (id == TURKC_INTERN_NONE) {
+            fprintf(stderr, "scanner: bellek yetersiz\n");
+            return -1;
+        }
+        if (!out->bin)
+            printf("%s: #%lu\n", turkc_token_category(kind), (unsigned long)id);
+        else if (turkc_tokstream_put(out->bin, kind, offset, id, line) != 0)
+            goto too_big;
+    } else if (out->bin) {
+        if (turkc_tokstream_put(out->bin, kind, offset, length, line) != 0)
+            goto too_big;
+    } else {
+        printf("%s: %.*s\n", turkc_token_category(kind), (int)length, text);
+    }
+    return 0;
+
+too_big:
+    fprintf(stderr, "scanner: satir %lu, sutun %lu: binary akis 4 GiB'tan buyuk girisi tasiyamaz\n",
+            line, column);
+    return -1;
+}
+
+/* --intern: sembol tablosu bir kez, en sonda */
+static void write_symbols(const struct output *out)
+{
+    const char *text;
+    size_t len;
+    uint32_t id;
+
+    if (out->bin) {
+        turkc_intern_write(out->syms, out->bin);
+        return;
+    }
+    for (id = 0; id < turkc_intern_count(out->syms); id++) {
+        text = turkc_intern_text(out->syms, id, &len);
+        printf("SYMBOL #%lu: %.*s\n", (unsigned long)id, (int)len, text);
+    }
+}
+
+/* --jobs: sadece normal dosyalar bölünebilir, diğerleri sıralı taranır */
+static int split_scan(const char *path, int jobs, size_t chunk_size,
+                      struct output *out, int *handled)
+{
+    struct stat st;
+    struct turkc_split_error error;
+    int fd = path ? open(path, O_RDONLY) : fileno(stdin);
+    int rc;
+
+    *handled = 0;
+    if (fd < 0 || fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        if (path && fd >= 0)
+            close(fd);
+        return 0;
+    }
+    *handled = 1;
+    rc = turkc_split_scan(fd, jobs, chunk_size, emit_token, out, NULL, &error);
+    if (rc != 0 && error.line)
+        fprintf(stderr, "scanner: satir %lu, sutun %lu: %s\n", error.line, error.column, error.message);
+    else if (rc != 0)
+        fprintf(stderr, "scanner: %s\n", error.message);
+    if (path)
+        close(fd);
+    return rc;
+}
+
+static int fast_scan(const char *path, enum turkc_simd simd, struct output *out)
+{
+    struct turkc_file file;
+    struct turkc_fastlex fl;
+    struct turkc_token tok;
+    int rc = turkc_load_file(path, &file), kind;
+
+    if (rc == -1) {
+        fprintf(stderr, "scanner: %s acilamadi\n", path);
+        return -1;
+    }
+    if (rc != 0) {
+        fprintf(stderr, "scanner: bellek yetersiz\n");
+        return -1;
+    }
+    if (turkc_fastlex_init(&fl, file.data, file.size, simd) != 0) {
+        fprintf(stderr, "scanner: %s bu islemcide desteklenmiyor\n", turkc_simd_name(simd));
+        turkc_unload_file(&file);
+        return -1;
+    }
+    while (rc == 0 && (kind = turkc_fastlex_next(&fl, &tok)) > 0)
+        rc = emit_token(out, kind, tok.text, tok.length, tok.offset, tok.line, tok.column);
+    if (rc == 0 && kind < 0) {
+        fprintf(stderr, "scanner: satir %lu, sutun %lu: %s\n", tok.line, tok.column, fl.error);
+        rc = -1;
+    }
+
+    turkc_unload_file(&file);
+    return rc;
+}
+
+int main(int argc, char **argv) {
+    struct output out = { NULL, NULL, 0 };
+    turkc_lexer *lx;
+    struct turkc_token tok;
+    const char *path = NULL;
+    size_t chunk_size = 0;
+    int i, kind, binary = 0, use_mmap = 1, jobs = 1, handled, use_flex = 1, intern = 0;
+    int status = 0;
+    enum turkc_simd simd = TURKC_SIMD_AUTO;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--format=text") == 0) {
+            binary = 0;
+        } else if (strcmp(argv[i], "--format=binary") == 0) {
+            binary = 1;
+        } else if (strcmp(argv[i], "--positions") == 0) {
+            out.positions = 1;
+        } else if (strcmp(argv[i], "--intern") == 0) {
+            intern = 1;
+        } else if (strcmp(argv[i], "--no-mmap") == 0) {
+            use_mmap = 0;
+        } else if (strncmp(argv[i], "--jobs=", 7) == 0) {
+            jobs = atoi(argv[i] + 7);
+        } else if (strncmp(argv[i], "--chunk-size=", 13) == 0) {
+            chunk_size = strtoul(argv[i] + 13, NULL, 10);
+        } else if (strcmp(argv[i], "--backend=flex") == 0) {
+            use_flex = 1;
+        } else if (strcmp(argv[i], "--backend=simd") == 0) {
+            use_flex = 0;
+            simd = TURKC_SIMD_AUTO;
+        } else if (strcmp(argv[i], "--backend=scalar") == 0) {
+            use_flex = 0;
+            simd = TURKC_SIMD_SCALAR;
+        } else if (strcmp(argv[i], "--backend=sse2") == 0) {
+            use_flex = 0;
+            simd = TURKC_SIMD_SSE2;
+        } else if (strcmp(argv[i], "--backend=avx2") == 0) {
+            use_flex = 0;
+            simd = TURKC_SIMD_AVX2;
+        } else if (argv[i][0] != '-' && !path) {
+            path = argv[i];
+        } else {
+            fprintf(stderr, "kullanim: %s [--format=text|binary] [--backend=flex|simd] [--intern] [--positions] [--no-mmap] [--jobs=N] [--chunk-size=N] [dosya.tc]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (!use_flex && jobs != 1) {
+        fprintf(stderr, "scanner: --jobs yalnizca --backend=flex ile kullanilabilir\n");
+        return 2;
+    }
+
+    if (path && !use_mmap && !freopen(path, "r", stdin)) {
+        fprintf(stderr, "scanner: %s acilamadi\n", path);
+        return 1;
+    }
+
+    if (binary) {
+#ifdef _WIN32
+        _setmode(_fileno(stdout), _O_BINARY);
+#endif
+        out.bin = turkc_tokstream_writer_open_flags(stdout, intern ? TURKC_TOKSTREAM_INTERNED : 0);
+        if (!out.bin) {
+            fprintf(stderr, "scanner: bellek yetersiz\n");
+            return 1;
+        }
+    }
+    if (intern && !(out.syms = turkc_intern_new())) {
+        fprintf(stderr, "scanner: bellek yetersiz\n");
+        status = 1;
+        goto done;
+    }
+
+    if (!use_flex) {
+        if (fast_scan(path, simd, &out) != 0)
+            status = 1;
+        goto done;
+    }
+
+    if (use_mmap && jobs != 1) {
+        if (split_scan(path, jobs, chunk_size, &out, &handled) != 0) {
+            status = 1;
+            goto done;
+        }
+        if (handled)
+            goto done;
+    }
+
+    if (!use_mmap)
+        lx = turkc_lexer_open(stdin);
+    else if (path)
+        lx = turkc_lexer_open_path(path);
+    else
+        lx = turkc_lexer_open_fd(fileno(stdin));
+    if (path && use_mmap && !lx) {
+        fprintf(stderr, "scanner: %s acilamadi\n", path);
+        status = 1;
+        goto done;
+    }
+    if (!lx) {
+        fprintf(stderr, "scanner: bellek yetersiz\n");
+        status = 1;
+        goto done;
+    }
+
+    while ((kind = turkc_lexer_next(lx, &tok)) > 0) {
+        if (emit_token(&out, kind, tok.text, tok.length, tok.offset, tok.line, tok.column) != 0) {
+            status = 1;
+            break;
+        }
+    }
+    if (kind < 0) {
+        fprintf(stderr, "scanner: satir %lu, sutun %lu: %s\n", tok.line, tok.column,
+                turkc_lexer_error(lx));
+        status = 1;
+    }
+    turkc_lexer_close(lx);
+
+done:
+    /* hatada da: binary yazıcı tamponu boşaltılır, semboller eklenir */
+    if (out.syms) {
+        write_symbols(&out);
+        turkc_intern_free(out.syms);
+    }
+    if (out.bin && turkc_tokstream_writer_close(out.bin) != 0) {
+        fprintf(stderr, "scanner: cikti yazilamadi\n");
+        return 1;
+    }
+    return status;
+}
@@ -0,0 +1,158 @@
+/* tcasm: TurkC programını x86-64 assembly'ye derler.
+ *
+ *   ./tcasm prog.tc -o prog.s               (-o yoksa stdout)
+ *   gcc prog.s -o prog && ./prog; echo $?   (çıkış kodu ana()'nın değeri)
+ *   ./tcasm -O prog.tc -o prog.s            (IR, varsayılan geçişler, yazmaç ataması)
+ *   ./tcasm -O --regs=0 prog.tc             (IR, tüm değerler yığında)
+ *   ./tcasm --passes=simplify --stats prog.tc
+ *   ./tcasm --cache=.tccache prog.tc        (ayrıştırma önbellekten, turkc_cache)
+ *
+ * Kaynak ayrıştırılır (turkc_parse), isimler çözülür (turkc_resolve) ve
+ * turkc_x86 GNU as sözdiziminde System V assembly üretir. -O veya
+ * --passes ile kod ağaçtan değil IR'dan (turkc_ir, turkc_pass) üretilir ve
+ * değerler doğrusal taramayla yazmaçlara atanır (turkc_regalloc);
+ * --regs=N yazmaç sayısını sınırlar. --stats değer, yığına düşen değer,
+ * yuva ve yığın işleneni sayılarını stderr'e yazar.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "turkc_ast.h"
+#include "turkc_cache.h"
+#include "turkc_ir.h"
+#include "turkc_mmap.h"
+#include "turkc_parse.h"
+#include "turkc_pass.h"
+#include "turkc_regalloc.h"
+#include "turkc_resolve.h"
+#include "turkc_x86.h"
+
+int main(int argc, char **argv)
+{
+    struct turkc_file file;
+    struct turkc_parse_error err;
+    struct turkc_program prog = { NULL, NULL, 0, NULL, 0, 0 };
+    struct turkc_x86_stats st;
+    struct turkc_ir ir = { NULL, NULL, 0 };
+    struct turkc_pm pm;
+    struct turkc_cache cache;
+    struct turkc_ast *ast;
+    const char *path = NULL, *output = NULL, *passes = NULL, *cache_dir = NULL, *data;
+    char *end;
+    size_t len;
+    FILE *out = stdout;
+    int nregs = TURKC_RA_REGS, stats = 0, status = 1, i, rc;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            output = argv[++i];
+        } else if (strcmp(argv[i], "-O") == 0) {
+            passes = TURKC_PM_DEFAULT;
+        } else if (strncmp(argv[i], "--passes=", 9) == 0) {
+            passes = argv[i] + 9;
+        } else if (strncmp(argv[i], "--regs=", 7) == 0) {
+            nregs = (int)strtol(argv[i] + 7, &end, 10);
+            if (end == argv[i] + 7 || *end || nregs < 0 || nregs > TURKC_RA_REGS) {
+                fprintf(stderr, "tcasm: --regs 0..%d olmali\n", TURKC_RA_REGS);
+                return 2;
+            }
+        } else if (strcmp(argv[i], "--stats") == 0) {
+            stats = 1;
+        } else if (strncmp(argv[i], "--cache=", 8) == 0 && argv[i][8]) {
+            cache_dir = argv[i] + 8;
+        } else if (argv[i][0] == '-' || path) {
+            fprintf(stderr, "kullanim: %s [-O | --passes=LISTE] [--regs=N] [--stats] [--cache=DIZIN] "
+                            "[-o cikti.s] [dosya.tc]\n", argv[0]);
+            return 2;
+        } else {
+            path = argv[i];
+        }
+    }
+    if ((stats || nregs != TURKC_RA_REGS) && !passes) {
+        fprintf(stderr, "tcasm: --regs ve --stats -O veya --passes ister\n");
+        return 2;
+    }
+
+    rc = turkc_load_file(path, &file);
+    if (rc == -1) {
+        fprintf(stderr, "tcasm: %s acilamadi\n", path);
+        return 1;
+    }
+    if (cache_dir && turkc_cache_open(&cache, cache_dir) != 0) {
+        fprintf(stderr, "tcasm: onbellek %s acilamadi\n", cache_dir);
+        turkc_unload_file(&file);
+        return 1;
+    }
+    data = file.data;
+    len = file.size;
+    ast = turkc_ast_new();
+    if (!ast || !data) {
+        fprintf(stderr, "tcasm: bellek yetersiz\n");
+        goto done;
+    }
+
+    if ((cache_dir ? turkc_cache_parse(&cache, ast, data, len, &err)
+                   : turkc_parse_buffer(ast, data, len, &err)) != 0)
+        goto error;
+    if (turkc_resolve(&prog, ast, &err) != 0) {
+        turkc_parse_locate(&err, data, len);
+        goto error;
+    }
+    if (passes) {
+        turkc_pm_init(&pm);
+        if (turkc_pm_add(&pm, passes, &err) != 0) {
+            fprintf(stderr, "tcasm: %s\n", err.message);
+            status = 2;
+            goto done;
+        }
+        if (turkc_ir_build(&ir, &prog, &err) != 0 || turkc_pm_run(&pm, &ir, &err) != 0) {
+            fprintf(stderr, "tcasm: %s\n", err.message);
+            goto done;
+        }
+    }
+    if (output && !(out = fopen(output, "w"))) {
+        fprintf(stderr, "tcasm: %s acilamadi\n", output);
+        goto done;
+    }
+    if (passes)
+        rc = turkc_x86_emit_ir(&ir, data, len, nregs, out, &st, &err);
+    else
+        rc = turkc_x86_emit(&prog, data, len, out, &err);
+    if (rc != 0 || fflush(out) != 0) {
+        fprintf(stderr, "tcasm: %s\n", ferror(out) ? "yazma hatasi" : err.message);
+        if (output) {
+            fclose(out);
+            remove(output);
+        }
+        goto done;
+    }
+    if (output && fclose(out) != 0) {
+        fprintf(stderr, "tcasm: yazma hatasi\n");
+        remove(output);
+        goto done;
+    }
+
+    if (stats)
+        fprintf(stderr, "tcasm: %d yazmac, %llu deger, %llu yigina dustu, %llu yuva, "
+                        "%llu yigin isleneni\n", nregs, (unsigned long long)st.values,
+                (unsigned long long)st.spilled, (unsigned long long)st.slots,
+                (unsigned long long)st.stack_refs);
+    status = 0;
+    goto done;
+
+error:
+    fprintf(stderr, "tcasm: satir %lu, sutun %lu: %s\n", err.line, err.column, err.message);
+done:
+    /* hatalı çalıştırmanın aramaları da stats'a yazılsın diye her çıkış buradan */
+    turkc_ir_free(&ir);
+    turkc_program_free(&prog);
+    if (cache_dir) {
+        turkc_cache_free_ast(&cache, ast);
+        turkc_cache_close(&cache);
+    } else {
+        turkc_ast_free(ast);
+    }
+    turkc_unload_file(&file);
+    return status;
+}
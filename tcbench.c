@@ -0,0 +1,541 @@
+/* tcbench: tarayıcı benchmark'ı, sentetik korpuslarda (turkc_corpus.h).
+ *
+ *   ./tcbench > sonuc.json                      (tüm şekiller, 16 MB, flex ve simd)
+ *   ./tcbench --shapes=nest,string --size=64 --reps=20 -o sonuc.json
+ *   ./tcbench --backends=flex,scalar,sse2,avx2,parse --label=$(git rev-parse --short HEAD)
+ *   ./tcbench --gen=comment --size=1 > ornek.tc (korpusu yaz, ölçme)
+ *   ./tcbench --compare eski.json yeni.json     (gerileme eşiği aşılırsa çıkış 1)
+ *
+ * Her şekil için korpus bir kez üretilir; her backend ayrı bir çocuk
+ * süreçte önce --warmup kez, sonra --reps kez taranır. Çocuğun en yüksek
+ * RSS'i (wait4) korpusu da içerir. Tarama süresinin en az/p50/p90/p99/en
+ * çok/ortalaması, p50'ye göre MB/s (MB = 2^20 byte) ve token/s, RSS ile
+ * birlikte JSON olarak yazılır; okunur bir tablo stderr'e gider.
+ *
+ * Backend'ler: flex (turkc_lexer_open_buffer, kopyasız), simd (CPU'nun en
+ * genişi), scalar, sse2, avx2 (turkc_fastlex) ve parse (turkc_parse_buffer:
+ * tarama + ayrıştırma + ağaç). CPU'da olmayan backend atlanır.
+ *
+ * --compare iki sonucu şekil ve backend'e göre eşleştirir. p50 MB/s'i
+ * --threshold yüzdesinden (varsayılan 5) fazla düşen ve yeni p50'si eski
+ * p90'ından da yavaş olan durum gerilemedir; yalnız ilki tutuyorsa
+ * gürültü sayılır ("gurultu?").
+ */
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "turkc_ast.h"
+#include "turkc_corpus.h"
+#include "turkc_fastlex.h"
+#include "turkc_json.h"
+#include "turkc_lexer.h"
+#include "turkc_parse.h"
+#include "turkc_time.h"
+
+#define MAX_REPS        1000
+#define MAX_BACKENDS    8
+
+enum { BACKEND_FLEX, BACKEND_FASTLEX, BACKEND_PARSE };
+
+struct backend {
+    const char *name;
+    int kind;
+    enum turkc_simd simd;
+};
+
+static const struct backend backends[] = {
+    { "flex", BACKEND_FLEX, TURKC_SIMD_AUTO },
+    { "simd", BACKEND_FASTLEX, TURKC_SIMD_AUTO },
+    { "scalar", BACKEND_FASTLEX, TURKC_SIMD_SCALAR },
+    { "sse2", BACKEND_FASTLEX, TURKC_SIMD_SSE2 },
+    { "avx2", BACKEND_FASTLEX, TURKC_SIMD_AVX2 },
+    { "parse", BACKEND_PARSE, TURKC_SIMD_AUTO },
+    { NULL, 0, TURKC_SIMD_AUTO }
+};
+
+/* Çocuktan pipe'la gelen sonuç */
+struct result {
+    int error;                  /* 0, 1: tarama hatası, 2: backend yok */
+    uint64_t tokens;
+    uint32_t runs;
+    double seconds[MAX_REPS];
+};
+
+struct stats {
+    double min, p50, p90, p99, max, mean;
+};
+
+/* Bir tarama; token sayısı, hatada -1 */
+static long long scan_once(const struct backend *b, char *src, size_t len)
+{
+    struct turkc_parse_error err;
+    struct turkc_fastlex fl;
+    struct turkc_token tok;
+    struct turkc_ast *ast;
+    turkc_lexer *lx;
+    long long n = 0;
+    int rc;
+
+    switch (b->kind) {
+    case BACKEND_FLEX:
+        if (!(lx = turkc_lexer_open_buffer(src, len)))
+            return -1;
+        while ((rc = turkc_lexer_next(lx, &tok)) > 0)
+            n++;
+        turkc_lexer_close(lx);
+        return rc < 0 ? -1 : n;
+    case BACKEND_FASTLEX:
+        turkc_fastlex_init(&fl, src, len, b->simd);
+        while ((rc = turkc_fastlex_next(&fl, &tok)) > 0)
+            n++;
+        return rc < 0 ? -1 : n;
+    default:
+        if (!(ast = turkc_ast_new()))
+            return -1;
+        rc = turkc_parse_buffer(ast, src, len, &err);
+        n = ast->count - 1;     /* düğüm sayısı */
+        turkc_ast_free(ast);
+        return rc != 0 ? -1 : n;
+    }
+}
+
+static void child(const struct backend *b, char *src, size_t len, int warmup, int reps, int fd)
+{
+    static struct result r;
+    struct turkc_fastlex fl;
+    long long n = 0;
+    double t;
+    size_t off;
+    ssize_t w;
+    int i;
+
+    memset(&r, 0, sizeof(r));
+    if (b->kind == BACKEND_FASTLEX && turkc_fastlex_init(&fl, src, len, b->simd) != 0)
+        r.error = 2;
+    for (i = 0; !r.error && i < warmup + reps; i++) {
+        t = turkc_now();
+        n = scan_once(b, src, len);
+        t = turkc_now() - t;
+        if (n < 0)
+            r.error = 1;
+        else if (i >= warmup)
+            r.seconds[r.runs++] = t;
+    }
+    r.tokens = (uint64_t)n;
+    for (off = 0; off < sizeof(r); off += (size_t)w)
+        if ((w = write(fd, (char *)&r + off, sizeof(r) - off)) <= 0)
+            _exit(1);
+    _exit(0);
+}
+
+static int cmp_double(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+
+    return x < y ? -1 : x > y;
+}
+
+/* En yakın sıra yöntemi */
+static double percentile(const double *sorted, uint32_t n, double q)
+{
+    uint32_t k = (uint32_t)(q * n);
+
+    if (k < q * n)
+        k++;
+    return sorted[k ? k - 1 : 0];
+}
+
+static void summarize(struct result *r, struct stats *st)
+{
+    double sum = 0;
+    uint32_t i;
+
+    qsort(r->seconds, r->runs, sizeof(double), cmp_double);
+    for (i = 0; i < r->runs; i++)
+        sum += r->seconds[i];
+    st->min = r->seconds[0];
+    st->p50 = percentile(r->seconds, r->runs, 0.50);
+    st->p90 = percentile(r->seconds, r->runs, 0.90);
+    st->p99 = percentile(r->seconds, r->runs, 0.99);
+    st->max = r->seconds[r->runs - 1];
+    st->mean = sum / r->runs;
+}
+
+/* Backend'i çocukta çalıştırır; en yüksek RSS (KB) rss'e */
+static int measure(const struct backend *b, char *src, size_t len, int warmup, int reps,
+                   struct result *r, long *rss)
+{
+    struct rusage ru;
+    size_t off = 0;
+    ssize_t n;
+    int fds[2], status;
+    pid_t pid;
+
+    fflush(NULL);
+    if (pipe(fds) != 0)
+        return -1;
+    pid = fork();
+    if (pid < 0) {
+        close(fds[0]);
+        close(fds[1]);
+        return -1;
+    }
+    if (pid == 0) {
+        close(fds[0]);
+        child(b, src, len, warmup, reps, fds[1]);
+    }
+    close(fds[1]);
+    while (off < sizeof(*r) && ((n = read(fds[0], (char *)r + off, sizeof(*r) - off)) > 0 ||
+                                (n < 0 && errno == EINTR)))
+        if (n > 0)
+            off += (size_t)n;
+    close(fds[0]);
+    if (wait4(pid, &status, 0, &ru) != pid || !WIFEXITED(status) ||
+        WEXITSTATUS(status) != 0 || off != sizeof(*r))
+        return -1;
+    *rss = ru.ru_maxrss;
+    return 0;
+}
+
+static const struct backend *find_backend(const char *name, size_t n)
+{
+    const struct backend *b;
+
+    for (b = backends; b->name; b++)
+        if (strlen(b->name) == n && memcmp(b->name, name, n) == 0)
+            return b;
+    return NULL;
+}
+
+static unsigned long count_lines(const char *s, size_t len)
+{
+    const char *end = s + len;
+    unsigned long n = 1;
+
+    while ((s = memchr(s, '\n', (size_t)(end - s))) != NULL) {
+        n++;
+        s++;
+    }
+    return n;
+}
+
+static char *read_file(const char *path, size_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    char *buf = NULL, *p;
+    size_t cap = 0, n;
+
+    *len = 0;
+    if (!f)
+        return NULL;
+    do {
+        if (*len + 1 >= cap) {
+            cap = cap ? cap * 2 : 65536;
+            if (!(p = realloc(buf, cap))) {
+                free(buf);
+                fclose(f);
+                return NULL;
+            }
+            buf = p;
+        }
+        n = fread(buf + *len, 1, cap - *len - 1, f);
+        *len += n;
+    } while (n > 0);
+    fclose(f);
+    buf[*len] = '\0';
+    return buf;
+}
+
+/* Sayı değeri (turkc_json_int tamsayı verir); sayı değilse 0 */
+static double number(const struct turkc_json *js, uint32_t v)
+{
+    if (!v || js->vals[v].type != TURKC_JSON_NUMBER)
+        return 0;
+    return strtod(js->src + js->vals[v].start, NULL);
+}
+
+static uint32_t find_case(const struct turkc_json *js, uint32_t cases, const struct turkc_json *other,
+                          uint32_t shape, uint32_t backend)
+{
+    char *s = turkc_json_string(other, shape, NULL);
+    char *b = turkc_json_string(other, backend, NULL);
+    uint32_t c, found = 0;
+
+    for (c = cases ? js->vals[cases].child : 0; s && b && c && !found; c = js->vals[c].next)
+        if (turkc_json_equals(js, turkc_json_get(js, c, "shape"), s) &&
+            turkc_json_equals(js, turkc_json_get(js, c, "backend"), b))
+            found = c;
+    free(s);
+    free(b);
+    return found;
+}
+
+static int compare(const char *old_path, const char *new_path, double threshold)
+{
+    struct turkc_json a = { 0 }, b = { 0 };
+    char *old_src, *new_src, *label;
+    size_t old_len, new_len;
+    uint32_t ca, cb, c, o;
+    double mo, mn, change, p50, p90;
+    int regressions = 0, rc = 2;
+
+    old_src = read_file(old_path, &old_len);
+    new_src = read_file(new_path, &new_len);
+    if (!old_src || !new_src) {
+        fprintf(stderr, "tcbench: %s acilamadi\n", old_src ? new_path : old_path);
+        goto done;
+    }
+    if (turkc_json_parse(&a, old_src, old_len) != 0 || turkc_json_parse(&b, new_src, new_len) != 0) {
+        fprintf(stderr, "tcbench: gecersiz JSON\n");
+        goto done;
+    }
+    if (number(&a, turkc_json_get(&a, 1, "size_bytes")) != number(&b, turkc_json_get(&b, 1, "size_bytes")) ||
+        number(&a, turkc_json_get(&a, 1, "seed")) != number(&b, turkc_json_get(&b, 1, "seed")))
+        fprintf(stderr, "tcbench: uyari: korpuslar farkli (size/seed)\n");
+
+    label = turkc_json_string(&a, turkc_json_get(&a, 1, "label"), NULL);
+    printf("eski: %s (%s)\n", old_path, label && *label ? label : "-");
+    free(label);
+    label = turkc_json_string(&b, turkc_json_get(&b, 1, "label"), NULL);
+    printf("yeni: %s (%s)\n", new_path, label && *label ? label : "-");
+    free(label);
+    printf("%-8s %-7s %10s %10s %8s %10s %10s\n", "sekil", "backend", "eski MB/s", "yeni MB/s",
+           "degisim", "eski RSS", "yeni RSS");
+
+    ca = turkc_json_get(&a, 1, "cases");
+    cb = turkc_json_get(&b, 1, "cases");
+    for (c = cb ? b.vals[cb].child : 0; c; c = b.vals[c].next) {
+        char *shape = turkc_json_string(&b, turkc_json_get(&b, c, "shape"), NULL);
+        char *backend = turkc_json_string(&b, turkc_json_get(&b, c, "backend"), NULL);
+
+        o = find_case(&a, ca, &b, turkc_json_get(&b, c, "shape"), turkc_json_get(&b, c, "backend"));
+        mn = number(&b, turkc_json_get(&b, c, "mb_per_s"));
+        if (!o) {
+            printf("%-8s %-7s %10s %10.1f %8s %10s %9.0fK\n", shape ? shape : "?",
+                   backend ? backend : "?", "-", mn, "yeni", "-",
+                   number(&b, turkc_json_get(&b, c, "peak_rss_kb")));
+        } else {
+            mo = number(&a, turkc_json_get(&a, o, "mb_per_s"));
+            change = mo > 0 ? (mn - mo) / mo * 100 : 0;
+            p50 = number(&b, turkc_json_get(&b, turkc_json_get(&b, c, "seconds"), "p50"));
+            p90 = number(&a, turkc_json_get(&a, turkc_json_get(&a, o, "seconds"), "p90"));
+            printf("%-8s %-7s %10.1f %10.1f %+7.1f%% %9.0fK %9.0fK%s\n", shape ? shape : "?",
+                   backend ? backend : "?", mo, mn, change,
+                   number(&a, turkc_json_get(&a, o, "peak_rss_kb")),
+                   number(&b, turkc_json_get(&b, c, "peak_rss_kb")),
+                   change >= -threshold ? "" : p50 > p90 ? "  GERILEME" : "  gurultu?");
+            if (change < -threshold && p50 > p90)
+                regressions++;
+        }
+        free(shape);
+        free(backend);
+    }
+    if (regressions)
+        printf("%d durumda %%%.1f'ten fazla gerileme\n", regressions, threshold);
+    rc = regressions ? 1 : 0;
+
+done:
+    turkc_json_free(&a);
+    turkc_json_free(&b);
+    free(old_src);
+    free(new_src);
+    return rc;
+}
+
+static int usage(const char *argv0)
+{
+    fprintf(stderr, "kullanim: %s [--shapes=a,b,...] [--backends=a,b,...] [--size=MB] [--seed=N] "
+                    "[--warmup=N] [--reps=N] [--label=ETIKET] [-o cikti.json]\n"
+                    "          %s --gen=SEKIL [--size=MB] [--seed=N]\n"
+                    "          %s --compare eski.json yeni.json [--threshold=YUZDE]\n",
+            argv0, argv0, argv0);
+    return 2;
+}
+
+int main(int argc, char **argv)
+{
+    const struct backend *use[MAX_BACKENDS];
+    struct turkc_json_buf out = { NULL, 0, 0, 0 };
+    struct result *r;
+    struct stats st;
+    const char *shapes = NULL, *blist = "flex,simd", *label = "", *output = NULL;
+    const char *gen = NULL, *cmp_old = NULL, *cmp_new = NULL, *p, *q;
+    double size_mb = 16, threshold = 5, mbs;
+    unsigned long long seed = 1;
+    long warmup = 2, reps = 10, rss;
+    int nuse = 0, first = 1, failed = 0, shape, i, j;
+    size_t size, len;
+    char *src, *end;
+    FILE *f;
+
+    for (i = 1; i < argc; i++) {
+        if (strncmp(argv[i], "--shapes=", 9) == 0) {
+            shapes = argv[i] + 9;
+        } else if (strncmp(argv[i], "--backends=", 11) == 0) {
+            blist = argv[i] + 11;
+        } else if (strncmp(argv[i], "--size=", 7) == 0) {
+            size_mb = strtod(argv[i] + 7, &end);
+            if (*end || !(size_mb > 0) || size_mb > 4096)
+                return usage(argv[0]);
+        } else if (strncmp(argv[i], "--seed=", 7) == 0) {
+            seed = strtoull(argv[i] + 7, &end, 10);
+            if (*end || end == argv[i] + 7)
+                return usage(argv[0]);
+        } else if (strncmp(argv[i], "--warmup=", 9) == 0) {
+            warmup = strtol(argv[i] + 9, &end, 10);
+            if (*end || warmup < 0 || warmup > MAX_REPS)
+                return usage(argv[0]);
+        } else if (strncmp(argv[i], "--reps=", 7) == 0) {
+            reps = strtol(argv[i] + 7, &end, 10);
+            if (*end || reps < 1 || reps > MAX_REPS)
+                return usage(argv[0]);
+        } else if (strncmp(argv[i], "--label=", 8) == 0) {
+            label = argv[i] + 8;
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            output = argv[++i];
+        } else if (strncmp(argv[i], "--gen=", 6) == 0) {
+            gen = argv[i] + 6;
+        } else if (strcmp(argv[i], "--compare") == 0 && i + 2 < argc) {
+            cmp_old = argv[++i];
+            cmp_new = argv[++i];
+        } else if (strncmp(argv[i], "--threshold=", 12) == 0) {
+            threshold = strtod(argv[i] + 12, &end);
+            if (*end || threshold < 0)
+                return usage(argv[0]);
+        } else {
+            return usage(argv[0]);
+        }
+    }
+    if (cmp_old)
+        return compare(cmp_old, cmp_new, threshold);
+    size = (size_t)(size_mb * 1048576);
+
+    if (gen) {
+        if ((shape = turkc_corpus_find(gen)) < 0) {
+            fprintf(stderr, "tcbench: bilinmeyen sekil: %s\n", gen);
+            return 2;
+        }
+        if (!(src = turkc_corpus_generate(shape, size, seed, &len))) {
+            fprintf(stderr, "tcbench: bellek yetersiz\n");
+            return 1;
+        }
+        fwrite(src, 1, len, stdout);
+        free(src);
+        return ferror(stdout) ? 1 : 0;
+    }
+
+    for (p = blist; *p; p = *q ? q + 1 : q) {
+        q = strchr(p, ',');
+        if (!q)
+            q = p + strlen(p);
+        if (nuse == MAX_BACKENDS || !(use[nuse] = find_backend(p, (size_t)(q - p)))) {
+            fprintf(stderr, "tcbench: bilinmeyen backend: %.*s\n", (int)(q - p), p);
+            return 2;
+        }
+        nuse++;
+    }
+    if (shapes) {
+        for (p = shapes; *p; p = *q ? q + 1 : q) {
+            char name[32];
+
+            q = strchr(p, ',');
+            if (!q)
+                q = p + strlen(p);
+            snprintf(name, sizeof(name), "%.*s", (int)(q - p), p);
+            if (turkc_corpus_find(name) < 0) {
+                fprintf(stderr, "tcbench: bilinmeyen sekil: %s\n", name);
+                return 2;
+            }
+        }
+    }
+    if (!(r = malloc(sizeof(*r)))) {
+        fprintf(stderr, "tcbench: bellek yetersiz\n");
+        return 1;
+    }
+
+    turkc_json_printf(&out, "{\n  \"tool\": \"tcbench\",\n  \"format\": 1,\n  \"label\": ");
+    turkc_json_quote(&out, label, strlen(label));
+    turkc_json_printf(&out, ",\n  \"simd\": \"%s\",\n  \"size_bytes\": %lu,\n  \"seed\": %llu,\n"
+                            "  \"warmup\": %ld,\n  \"reps\": %ld,\n  \"cases\": [",
+                      turkc_simd_name(turkc_simd_detect()), (unsigned long)size, seed, warmup, reps);
+    fprintf(stderr, "%-8s %-7s %9s %11s %10s %10s %10s %10s %9s\n", "sekil", "backend", "MB",
+                    "token", "p50 ms", "p99 ms", "MB/s", "Mtoken/s", "RSS");
+
+    for (shape = 0; shape < TURKC_CORPUS_SHAPES; shape++) {
+        const char *name = turkc_corpus_name(shape);
+
+        if (shapes) {
+            for (p = shapes; *p; p = *q ? q + 1 : q) {
+                q = strchr(p, ',');
+                if (!q)
+                    q = p + strlen(p);
+                if ((size_t)(q - p) == strlen(name) && memcmp(p, name, (size_t)(q - p)) == 0)
+                    break;
+            }
+            if (!*p)
+                continue;
+        }
+        if (!(src = turkc_corpus_generate(shape, size, seed, &len))) {
+            fprintf(stderr, "tcbench: bellek yetersiz\n");
+            return 1;
+        }
+        for (j = 0; j < nuse; j++) {
+            if (measure(use[j], src, len, (int)warmup, (int)reps, r, &rss) != 0) {
+                fprintf(stderr, "tcbench: %s/%s olculemedi\n", name, use[j]->name);
+                failed = 1;
+                continue;
+            }
+            if (r->error == 2) {
+                fprintf(stderr, "%-8s %-7s bu CPU'da yok, atlandi\n", name, use[j]->name);
+                continue;
+            }
+            if (r->error) {
+                fprintf(stderr, "tcbench: %s/%s: tarama hatasi\n", name, use[j]->name);
+                failed = 1;
+                continue;
+            }
+            summarize(r, &st);
+            mbs = len / st.p50 / 1048576;
+            fprintf(stderr, "%-8s %-7s %9.2f %11llu %10.3f %10.3f %10.1f %10.1f %8ldK\n", name,
+                    use[j]->name, len / 1048576.0, (unsigned long long)r->tokens, st.p50 * 1e3,
+                    st.p99 * 1e3, mbs, r->tokens / st.p50 / 1e6, rss);
+            turkc_json_printf(&out, "%s\n    {\"shape\": \"%s\", \"backend\": \"%s\", \"bytes\": %lu, "
+                                    "\"lines\": %lu, \"%s\": %llu, \"runs\": %lu,\n", first ? "" : ",",
+                              name, use[j]->name, (unsigned long)len, count_lines(src, len),
+                              use[j]->kind == BACKEND_PARSE ? "nodes" : "tokens",
+                              (unsigned long long)r->tokens, (unsigned long)r->runs);
+            turkc_json_printf(&out, "     \"seconds\": {\"min\": %.9f, \"p50\": %.9f, \"p90\": %.9f, "
+                                    "\"p99\": %.9f, \"max\": %.9f, \"mean\": %.9f},\n",
+                              st.min, st.p50, st.p90, st.p99, st.max, st.mean);
+            turkc_json_printf(&out, "     \"mb_per_s\": %.3f, \"%s\": %.1f, \"peak_rss_kb\": %ld}",
+                              mbs, use[j]->kind == BACKEND_PARSE ? "nodes_per_s" : "tokens_per_s",
+                              r->tokens / st.p50, rss);
+            first = 0;
+        }
+        free(src);
+    }
+    turkc_json_puts(&out, "\n  ]\n}\n");
+    free(r);
+    if (out.oom) {
+        fprintf(stderr, "tcbench: bellek yetersiz\n");
+        return 1;
+    }
+
+    f = output ? fopen(output, "w") : stdout;
+    if (!f) {
+        fprintf(stderr, "tcbench: %s acilamadi\n", output);
+        return 1;
+    }
+    fwrite(out.data, 1, out.len, f);
+    if (output)
+        fclose(f);
+    turkc_json_buf_free(&out);
+    return failed;
+}
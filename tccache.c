@@ -0,0 +1,149 @@
+/* tccache: TurkC dosyalarını token/ağaç cache'i (turkc_cache.h) üzerinden
+ * ayrıştırır; derlemenin ön yüzünün yaptığı iş.
+ *
+ *   ./tccache a.tc b.tc ...                 .tccache dizinini kullanır
+ *   ./tccache -d dizin -v *.tc              dosya başına isabet/ıska ve süre
+ *   ./tccache -n *.tc                       cache'siz (karşılaştırma için)
+ *   ./tccache --cache=dizin --stats         birikmiş istatistikler (-d dizin ile aynı)
+ *   ./tccache -d dizin --clear              kayıtları ve istatistikleri sil
+ *
+ * Sonda bu çalıştırmanın ve dizinde birikmiş istatistikler yazılır:
+ * isabet oranı, taranmayan byte, kazanılan süre (kaydedilmiş ayrıştırma
+ * süresi eksi yükleme), kayıt sayısı ve boyu. Ayrıştırılamayan dosya
+ * varsa çıkış kodu 1'dir.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "turkc_ast.h"
+#include "turkc_cache.h"
+#include "turkc_mmap.h"
+#include "turkc_parse.h"
+#include "turkc_time.h"
+
+static void print_stats(const char *label, const struct turkc_cache_stats *st)
+{
+    printf("%s %llu arama, %llu isabet (%%%.1f), %llu kayit; %.2f MB taranmadi, "
+           "%.3f ms kazanildi (yukleme %.3f ms, ayristirma %.3f ms)\n",
+           label, (unsigned long long)st->lookups, (unsigned long long)st->hits,
+           st->lookups ? 100.0 * st->hits / st->lookups : 0.0,
+           (unsigned long long)st->stores, st->bytes_saved / 1048576.0,
+           st->seconds_saved * 1e3, st->load_seconds * 1e3, st->parse_seconds * 1e3);
+}
+
+/* Dosyayı ayrıştırır; hata olursa -1 */
+static int parse_file(struct turkc_cache *cache, const char *path, int verbose,
+                      unsigned long long *bytes)
+{
+    struct turkc_file file;
+    struct turkc_parse_error err;
+    struct turkc_ast *ast;
+    const char *data;
+    double start;
+    size_t len;
+    int rc;
+
+    if (turkc_load_file(path, &file) == -1) {
+        fprintf(stderr, "tccache: %s acilamadi\n", path);
+        return -1;
+    }
+    data = file.data;
+    len = file.size;
+    ast = turkc_ast_new();
+    if (!ast || !data) {
+        fprintf(stderr, "tccache: bellek yetersiz\n");
+        turkc_ast_free(ast);
+        turkc_unload_file(&file);
+        return -1;
+    }
+
+    start = turkc_now();
+    rc = cache ? turkc_cache_parse(cache, ast, data, len, &err)
+               : turkc_parse_buffer(ast, data, len, &err);
+    if (rc != 0)
+        fprintf(stderr, "tccache: %s: satir %lu, sutun %lu: %s\n", path, err.line,
+                err.column, err.message);
+    else if (verbose)
+        printf("%s: %s, %.3f ms, %lu dugum\n", path,
+               !cache ? "cache yok" : cache->hit ? "isabet" : "iska",
+               (turkc_now() - start) * 1e3, (unsigned long)ast->count - 1);
+    *bytes += len;
+    if (cache)
+        turkc_cache_free_ast(cache, ast);
+    else
+        turkc_ast_free(ast);
+    turkc_unload_file(&file);
+    return rc;
+}
+
+int main(int argc, char **argv)
+{
+    struct turkc_cache cache, *c = &cache;
+    struct turkc_cache_stats total;
+    const char *dir = ".tccache";
+    unsigned long long bytes = 0, size;
+    unsigned long files = 0, entries;
+    int verbose = 0, stats = 0, clear = 0, i, rc = 0;
+    long removed;
+    double start;
+
+    for (i = 1; i < argc && argv[i][0] == '-'; i++) {
+        if (strcmp(argv[i], "-d") == 0 && i + 1 < argc)
+            dir = argv[++i];
+        else if (strncmp(argv[i], "--cache=", 8) == 0 && argv[i][8])
+            dir = argv[i] + 8;
+        else if (strcmp(argv[i], "-v") == 0)
+            verbose = 1;
+        else if (strcmp(argv[i], "-n") == 0)
+            c = NULL;
+        else if (strcmp(argv[i], "--stats") == 0)
+            stats = 1;
+        else if (strcmp(argv[i], "--clear") == 0)
+            clear = 1;
+        else
+            break;
+    }
+    if ((i < argc && argv[i][0] == '-') || (i == argc && !stats && !clear) ||
+        (!c && (stats || clear))) {
+        fprintf(stderr, "kullanim: %s [-d dizin | --cache=dizin] [-v] [-n] [--stats] [--clear] [dosya.tc]...\n",
+                argv[0]);
+        return 2;
+    }
+    if (c && turkc_cache_open(c, dir) != 0) {
+        fprintf(stderr, "tccache: %s acilamadi\n", dir);
+        return 1;
+    }
+    if (clear) {
+        removed = turkc_cache_clear(c);
+        if (removed < 0) {
+            fprintf(stderr, "tccache: %s temizlenemedi\n", dir);
+            rc = 1;
+        } else {
+            printf("%ld kayit silindi\n", removed);
+        }
+    }
+
+    start = turkc_now();
+    for (; i < argc; i++, files++)
+        if (parse_file(c, argv[i], verbose, &bytes) != 0)
+            rc = 1;
+    if (files > 0)
+        printf("%lu dosya, %.2f MB, %.3f ms\n", files, bytes / 1048576.0,
+               (turkc_now() - start) * 1e3);
+    if (!c)
+        return rc;
+
+    if (files > 0)
+        print_stats("bu calistirma:", &c->stats);
+    turkc_cache_close(c);
+    if (stats || files > 0) {
+        turkc_cache_open(c, dir);
+        turkc_cache_totals(c, &total);
+        turkc_cache_usage(c, &entries, &size);
+        print_stats("toplam:       ", &total);
+        printf("%s: %lu kayit, %.2f MB\n", dir, entries, size / 1048576.0);
+        turkc_cache_close(c);
+    }
+    return rc;
+}
@@ -0,0 +1,173 @@
+/* tcir: TurkC programını SSA IR'a çevirir, geçişleri uygular, IR'ı yazar
+ * veya yorumlar.
+ *
+ *   ./tcir prog.tc                          (kurulan IR)
+ *   ./tcir -O prog.tc                       (varsayılan geçişlerden sonra)
+ *   ./tcir --passes=simplify prog.tc        (seçilen geçişler, sırayla)
+ *   ./tcir -O --time prog.tc                (geçiş başına süre ve komut sayısı stderr'e)
+ *   ./tcir -O --run prog.tc                 (IR'ı yorumla; çıkış kodu ana()'nın değeri)
+ *   ./tcir -O --dump=unroll prog.tc         (unroll'dan önceki ve sonraki IR stderr'e)
+ *   ./tcir --cache=.tccache prog.tc         (ayrıştırma önbellekten, turkc_cache)
+ *   ./tcir --list                           (kayıtlı geçişler)
+ *
+ * Kaynak ayrıştırılır (turkc_parse), isimler çözülür (turkc_resolve), IR
+ * kurulur (turkc_ir) ve geçiş yöneticisi (turkc_pass) geçişleri çalıştırır.
+ * IR kurulduktan sonra ve her geçişten sonra doğrulanır; --no-verify
+ * kapatır. --run --stats çalıştırılan IR komutu sayısını da yazar. --dump
+ * IR'ı kurulumdan ve her geçişten sonra stderr'e yazar; --dump=GEÇİŞ yalnız
+ * o geçişin önünü ve arkasını.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "turkc_ast.h"
+#include "turkc_cache.h"
+#include "turkc_ir.h"
+#include "turkc_mmap.h"
+#include "turkc_parse.h"
+#include "turkc_pass.h"
+#include "turkc_resolve.h"
+#include "turkc_time.h"
+
+int main(int argc, char **argv)
+{
+    struct turkc_file file;
+    struct turkc_parse_error err;
+    struct turkc_program prog = { NULL, NULL, 0, NULL, 0, 0 };
+    struct turkc_ir ir = { NULL, NULL, 0 };
+    struct turkc_pm pm;
+    struct turkc_cache cache;
+    struct turkc_ast *ast;
+    const struct turkc_pass *p;
+    const char *path = NULL, *cache_dir = NULL, *data;
+    size_t len;
+    int run = 0, timing = 0, stats = 0, status = 1, i, rc;
+    uint64_t steps = 0, ninsns = 0;
+    int32_t result = 0;
+    double t0, t1, t2, t3;
+
+    turkc_pm_init(&pm);
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-O") == 0) {
+            if (turkc_pm_add(&pm, TURKC_PM_DEFAULT, &err) != 0)
+                goto usage;
+        } else if (strncmp(argv[i], "--passes=", 9) == 0) {
+            if (turkc_pm_add(&pm, argv[i] + 9, &err) != 0) {
+                fprintf(stderr, "tcir: %s\n", err.message);
+                return 2;
+            }
+        } else if (strcmp(argv[i], "--time") == 0) {
+            timing = 1;
+        } else if (strcmp(argv[i], "--run") == 0) {
+            run = 1;
+        } else if (strcmp(argv[i], "--stats") == 0) {
+            stats = 1;
+        } else if (strcmp(argv[i], "--dump") == 0) {
+            pm.dump = stderr;
+        } else if (strncmp(argv[i], "--dump=", 7) == 0) {
+            pm.dump = stderr;
+            pm.dump_pass = argv[i] + 7;
+            if (!turkc_pass_find(pm.dump_pass)) {
+                fprintf(stderr, "tcir: bilinmeyen gecis: %s\n", pm.dump_pass);
+                return 2;
+            }
+        } else if (strncmp(argv[i], "--cache=", 8) == 0 && argv[i][8]) {
+            cache_dir = argv[i] + 8;
+        } else if (strcmp(argv[i], "--no-verify") == 0) {
+            pm.verify = 0;
+        } else if (strcmp(argv[i], "--list") == 0) {
+            for (p = turkc_passes; p->name; p++)
+                printf("%-10s %s\n", p->name, p->help);
+            return 0;
+        } else if (argv[i][0] == '-' || path) {
+            goto usage;
+        } else {
+            path = argv[i];
+        }
+    }
+
+    rc = turkc_load_file(path, &file);
+    if (rc == -1) {
+        fprintf(stderr, "tcir: %s acilamadi\n", path);
+        return 1;
+    }
+    if (cache_dir && turkc_cache_open(&cache, cache_dir) != 0) {
+        fprintf(stderr, "tcir: onbellek %s acilamadi\n", cache_dir);
+        turkc_unload_file(&file);
+        return 1;
+    }
+    data = file.data;
+    len = file.size;
+    ast = turkc_ast_new();
+    if (!ast || !data) {
+        fprintf(stderr, "tcir: bellek yetersiz\n");
+        goto done;
+    }
+
+    if ((cache_dir ? turkc_cache_parse(&cache, ast, data, len, &err)
+                   : turkc_parse_buffer(ast, data, len, &err)) != 0)
+        goto error;
+    if (turkc_resolve(&prog, ast, &err) != 0) {
+        turkc_parse_locate(&err, data, len);
+        goto error;
+    }
+    t0 = turkc_now();
+    if (turkc_ir_build(&ir, &prog, &err) != 0) {
+        fprintf(stderr, "tcir: %s\n", err.message);
+        goto done;
+    }
+    t1 = turkc_now();
+    if (turkc_pm_run(&pm, &ir, &err) != 0) {
+        fprintf(stderr, "tcir: %s\n", err.message);
+        goto done;
+    }
+    t2 = turkc_now();
+    if (timing) {
+        fprintf(stderr, "%-10s %9.3f ms\n", "kurulum", (t1 - t0) * 1e3);
+        turkc_pm_report(&pm, stderr);
+    }
+
+    if (!run) {
+        for (i = 0; i < (int)ir.nfuncs; i++)
+            turkc_ir_print(&ir, i, stdout);
+    } else {
+        rc = turkc_ir_run(&ir, prog.entry, NULL, &result, stdout, &steps, &err);
+        t3 = turkc_now();
+        fflush(stdout);
+        if (rc != 0) {
+            turkc_parse_locate(&err, data, len);
+            goto error;
+        }
+        if (stats) {
+            for (i = 0; i < (int)ir.nfuncs; i++)
+                ninsns += turkc_ir_count(&ir.funcs[i]);
+            fprintf(stderr, "ir: %.3f sn, %llu komut\n", t2 - t0, (unsigned long long)ninsns);
+            fprintf(stderr, "calistirma: %.3f sn, %llu komut calisti, ana = %ld\n", t3 - t2,
+                    (unsigned long long)steps, (long)result);
+        }
+    }
+
+    status = result & 0xff;
+    goto done;
+
+usage:
+    fprintf(stderr, "kullanim: %s [-O] [--passes=a,b,...] [--time] [--run] [--stats] [--dump[=gecis]] [--no-verify] [--cache=DIZIN] [--list] [dosya.tc]\n",
+            argv[0]);
+    return 2;
+
+error:
+    fprintf(stderr, "tcir: satir %lu, sutun %lu: %s\n", err.line, err.column, err.message);
+done:
+    /* hatalı çalıştırmanın aramaları da stats'a yazılsın diye her çıkış buradan */
+    turkc_ir_free(&ir);
+    turkc_program_free(&prog);
+    if (cache_dir) {
+        turkc_cache_free_ast(&cache, ast);
+        turkc_cache_close(&cache);
+    } else {
+        turkc_ast_free(ast);
+    }
+    turkc_unload_file(&file);
+    return status;
+}
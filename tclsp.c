@@ -0,0 +1,44 @@
+/* tclsp: TurkC dil sunucusu (turkc_lsp.h), stdin/stdout üzerinden JSON-RPC.
+ *
+ *   ./tclsp                    editörün başlattığı sunucu
+ *   ./tclsp --trace            mesaj süreleri stderr'e
+ *   ./tclsp --check            her değişikliği tam ayrıştırmayla karşılaştır
+ *
+ * Çıkış kodu: shutdown'dan sonra exit gelirse 0, değilse 1; --check ile
+ * fark bulunduysa da 1.
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "turkc_lsp.h"
+
+int main(int argc, char **argv)
+{
+    struct turkc_lsp *s;
+    int i, trace = 0, check = 0, rc;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--trace") == 0)
+            trace = 1;
+        else if (strcmp(argv[i], "--check") == 0)
+            check = 1;
+        else
+            break;
+    }
+    if (i < argc) {
+        fprintf(stderr, "kullanim: %s [--trace] [--check]\n", argv[0]);
+        return 2;
+    }
+    s = turkc_lsp_new(trace ? stderr : NULL, check);
+    if (!s) {
+        fprintf(stderr, "tclsp: bellek yetersiz\n");
+        return 1;
+    }
+    rc = turkc_lsp_serve(s, stdin, stdout);
+    if (turkc_lsp_mismatches(s) > 0) {
+        fprintf(stderr, "tclsp: %lu degisiklikte fark\n", turkc_lsp_mismatches(s));
+        rc = 1;
+    }
+    turkc_lsp_free(s);
+    return rc;
+}
@@ -0,0 +1,174 @@
+/* tcrun: TurkC programını çalıştırır.
+ *
+ *   ./tcrun test2.tc                        (çıkış kodu ana()'nın değeri)
+ *   ./tcrun --stats prog.tc                 (aşama süreleri stderr'e)
+ *   ./tcrun --engine=tree prog.tc           (ağaç yorumlayıcısı)
+ *   ./tcrun --engine=jit prog.tc            (VM + sık çağrılanlar makine koduna)
+ *   ./tcrun --engine=jit --jit-threshold=1 prog.tc
+ *   ./tcrun --bytecode prog.tc              (bytecode dökümü, çalıştırmaz)
+ *   ./tcrun --cache=.tccache prog.tc        (ayrıştırma önbellekten, turkc_cache)
+ *
+ * Kaynak ayrıştırılır (turkc_parse), isimler çözülür (turkc_resolve) ve
+ * ana() bytecode VM'iyle (turkc_vm, varsayılan), JIT'li VM'le (turkc_jit)
+ * veya ağaç yorumlayıcısıyla (turkc_interp) çalıştırılır. yaz() çıktısı
+ * stdout'a gider. --stats JIT'te derlenen her fonksiyonu da yazar.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "turkc_ast.h"
+#include "turkc_cache.h"
+#include "turkc_interp.h"
+#include "turkc_jit.h"
+#include "turkc_mmap.h"
+#include "turkc_parse.h"
+#include "turkc_resolve.h"
+#include "turkc_time.h"
+#include "turkc_vm.h"
+
+enum { ENGINE_TREE, ENGINE_VM, ENGINE_JIT };
+
+int main(int argc, char **argv)
+{
+    struct turkc_file file;
+    struct turkc_parse_error err;
+    struct turkc_program prog = { NULL, NULL, 0, NULL, 0, 0 };
+    struct turkc_interp *in = NULL;
+    struct turkc_vm *vm = NULL;
+    struct turkc_cache cache;
+    struct turkc_ast *ast;
+    const char *path = NULL, *cache_dir = NULL, *data;
+    size_t len;
+    int stats = 0, dump = 0, engine = ENGINE_VM, status = 1, i, rc;
+    unsigned long ncode = 0, threshold = TURKC_JIT_THRESHOLD;
+    const struct turkc_vm_func *fn;
+    char *end;
+    int32_t result;
+    double t0, t1, t2, t3, t4;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--stats") == 0) {
+            stats = 1;
+        } else if (strcmp(argv[i], "--bytecode") == 0) {
+            dump = 1;
+        } else if (strcmp(argv[i], "--engine=tree") == 0) {
+            engine = ENGINE_TREE;
+        } else if (strcmp(argv[i], "--engine=vm") == 0) {
+            engine = ENGINE_VM;
+        } else if (strcmp(argv[i], "--engine=jit") == 0) {
+            engine = ENGINE_JIT;
+        } else if (strncmp(argv[i], "--jit-threshold=", 16) == 0 &&
+                   (threshold = strtoul(argv[i] + 16, &end, 10)) > 0 && *end == '\0') {
+            engine = ENGINE_JIT;
+        } else if (strncmp(argv[i], "--cache=", 8) == 0 && argv[i][8]) {
+            cache_dir = argv[i] + 8;
+        } else if (argv[i][0] == '-' || path) {
+            fprintf(stderr, "kullanim: %s [--engine=vm|jit|tree] [--jit-threshold=N] [--bytecode] [--cache=DIZIN] [--stats] [dosya.tc]\n",
+                    argv[0]);
+            return 2;
+        } else {
+            path = argv[i];
+        }
+    }
+
+    rc = turkc_load_file(path, &file);
+    if (rc == -1) {
+        fprintf(stderr, "tcrun: %s acilamadi\n", path);
+        return 1;
+    }
+    if (cache_dir && turkc_cache_open(&cache, cache_dir) != 0) {
+        fprintf(stderr, "tcrun: onbellek %s acilamadi\n", cache_dir);
+        turkc_unload_file(&file);
+        return 1;
+    }
+    data = file.data;
+    len = file.size;
+    ast = turkc_ast_new();
+    if (!ast || !data) {
+        fprintf(stderr, "tcrun: bellek yetersiz\n");
+        goto done;
+    }
+
+    t0 = turkc_now();
+    if ((cache_dir ? turkc_cache_parse(&cache, ast, data, len, &err)
+                   : turkc_parse_buffer(ast, data, len, &err)) != 0)
+        goto error;
+    t1 = turkc_now();
+    if (turkc_resolve(&prog, ast, &err) != 0) {
+        turkc_parse_locate(&err, data, len);
+        goto error;
+    }
+    t2 = turkc_now();
+    if (engine != ENGINE_TREE || dump) {
+        vm = turkc_vm_new(&prog, stdout, &err);
+        if (!vm) {
+            turkc_parse_locate(&err, data, len);
+            goto error;
+        }
+        for (i = 0; i < (int)prog.nfuncs; i++)
+            ncode += turkc_vm_function(vm, i)->ncode;
+        if (dump) {
+            turkc_vm_dump(vm, stdout);
+            status = 0;
+            goto done;
+        }
+        if (engine == ENGINE_JIT)
+            turkc_vm_set_jit(vm, (uint32_t)threshold);
+    } else {
+        in = turkc_interp_new(&prog, stdout);
+        if (!in) {
+            fprintf(stderr, "tcrun: bellek yetersiz\n");
+            goto done;
+        }
+    }
+    t3 = turkc_now();
+    if (vm)
+        rc = turkc_vm_call(vm, prog.entry, NULL, &result, &err);
+    else
+        rc = turkc_interp_call(in, prog.entry, NULL, &result, &err);
+    t4 = turkc_now();
+    fflush(stdout);
+    if (rc != 0) {
+        turkc_parse_locate(&err, data, len);
+        goto error;
+    }
+
+    if (stats) {
+        fprintf(stderr, "ayristirma: %.3f sn, %lu dugum\n", t1 - t0, (unsigned long)ast->count - 1);
+        fprintf(stderr, "cozumleme: %.3f sn, %lu fonksiyon, %lu global\n", t2 - t1,
+                (unsigned long)prog.nfuncs, (unsigned long)prog.nglobals);
+        if (vm)
+            fprintf(stderr, "derleme: %.3f sn, %lu komut\n", t3 - t2, ncode);
+        fprintf(stderr, "calistirma: %.3f sn, ana = %ld\n", t4 - t3, (long)result);
+        for (i = 0; engine == ENGINE_JIT && i < (int)prog.nfuncs; i++) {
+            fn = turkc_vm_function(vm, i);
+            if (fn->native)
+                fprintf(stderr, "jit: %s, %lu komut -> %lu bayt, %.1f us\n",
+                        turkc_ast_symbol(ast, prog.funcs[i].name), (unsigned long)fn->ncode,
+                        (unsigned long)fn->native_size, fn->jit_seconds * 1e6);
+            else if (fn->calls >= threshold)
+                fprintf(stderr, "jit: %s derlenemedi, yorumlandi\n",
+                        turkc_ast_symbol(ast, prog.funcs[i].name));
+        }
+    }
+
+    status = result & 0xff;
+    goto done;
+
+error:
+    fprintf(stderr, "tcrun: satir %lu, sutun %lu: %s\n", err.line, err.column, err.message);
+done:
+    /* hatalı çalıştırmanın aramaları da stats'a yazılsın diye her çıkış buradan */
+    turkc_vm_free(vm);
+    turkc_interp_free(in);
+    turkc_program_free(&prog);
+    if (cache_dir) {
+        turkc_cache_free_ast(&cache, ast);
+        turkc_cache_close(&cache);
+    } else {
+        turkc_ast_free(ast);
+    }
+    turkc_unload_file(&file);
+    return status;
+}
@@ -0,0 +1,118 @@
+/* Binary token akışını okuyup scanner'ın text çıktısına çevirir.
+ *
+ *   ./scanner --format=binary < test1.tc > test1.tok
+ *   ./tokdump test1.tok test1.tc      (scanner'ın text çıktısının aynısı)
+ *   ./tokdump test1.tok               (kind/ofset/uzunluk/satır)
+ *
+ * Interned akışta (scanner --intern) sembol tablosu akışın sonundadır; kayıtlar
+ * önce belleğe okunur, identifier ve string uzunlukları tablodan alınır.
+ * Kaynak verilmezse uzunluk sütunu sembol ID'sidir ve tablo en sonda yazılır.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "turkc_token.h"
+#include "turkc_tokstream.h"
+
+/* Kaynağı tamamen belleğe okur; token metinleri ofsetlerden alınır */
+static char *read_file(const char *path, long *size)
+{
+    FILE *f = fopen(path, "rb");
+    char *buf;
+
+    if (!f)
+        return NULL;
+    fseek(f, 0, SEEK_END);
+    *size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    buf = malloc(*size + 1);
+    if (buf && fread(buf, 1, *size, f) != (size_t)*size) {
+        free(buf);
+        buf = NULL;
+    }
+    fclose(f);
+    return buf;
+}
+
+int main(int argc, char **argv)
+{
+    FILE *in;
+    turkc_tokstream_reader *r;
+    struct turkc_token_record *recs = NULL, *p;
+    char *src = NULL;
+    const char *text;
+    long src_size = 0;
+    size_t n = 0, cap = 0, got, i;
+    uint32_t len, id;
+    int rc = 0, interned;
+
+    if (argc < 2 || argc > 3) {
+        fprintf(stderr, "kullanim: %s tokens.bin [kaynak.tc]\n", argv[0]);
+        return 2;
+    }
+    in = fopen(argv[1], "rb");
+    if (!in) {
+        perror(argv[1]);
+        return 1;
+    }
+    if (argc == 3 && !(src = read_file(argv[2], &src_size))) {
+        perror(argv[2]);
+        return 1;
+    }
+    r = turkc_tokstream_open(in);
+    if (!r) {
+        fprintf(stderr, "%s: gecersiz token akisi\n", argv[1]);
+        return 1;
+    }
+
+    interned = (turkc_tokstream_flags(r) & TURKC_TOKSTREAM_INTERNED) != 0;
+    for (;;) {
+        if (n == cap) {
+            cap = cap ? cap * 2 : 65536;
+            p = realloc(recs, cap * sizeof(*recs));
+            if (!p) {
+                fprintf(stderr, "tokdump: bellek yetersiz\n");
+                return 1;
+            }
+            recs = p;
+        }
+        got = turkc_tokstream_read(r, recs + n, cap - n);
+        if (got == 0)
+            break;
+        n += got;
+    }
+    if (turkc_tokstream_error(r))
+        rc = -1;
+
+    for (i = 0; i < n && rc == 0; i++) {
+        len = recs[i].length;
+        if (interned && (recs[i].kind == TK_IDENTIFIER || recs[i].kind == TK_STRING) &&
+            !turkc_tokstream_symbol(r, recs[i].length, &len)) {
+            rc = -1;
+            break;
+        }
+        if (!src) {
+            printf("%u %u %u %u\n", recs[i].kind, recs[i].offset, recs[i].length, recs[i].line);
+        } else if ((long)recs[i].offset + len > src_size) {
+            rc = -1;    /* başka bir kaynak dosyanın akışı */
+            break;
+        } else {
+            printf("%s: %.*s\n", turkc_token_category(recs[i].kind),
+                   (int)len, src + recs[i].offset);
+        }
+    }
+    if (rc == 0 && interned && !src) {
+        for (id = 0; id < turkc_tokstream_symbol_count(r); id++) {
+            text = turkc_tokstream_symbol(r, id, &len);
+            printf("SYMBOL #%lu: %.*s\n", (unsigned long)id, (int)len, text);
+        }
+    }
+    if (rc < 0)
+        fprintf(stderr, "%s: token akisi bozuk\n", argv[1]);
+
+    turkc_tokstream_close(r);
+    fclose(in);
+    free(src);
+    free(recs);
+    return rc < 0 ? 1 : 0;
+}
@@ -0,0 +1,194 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "turkc_ast.h"
+#include "turkc_token.h"
+
+static const char *const node_names[ND_COUNT] = {
+    [ND_NONE]    = "-",
+    [ND_PROGRAM] = "PROGRAM",
+    [ND_FUNC]    = "FUNC",
+    [ND_PARAM]   = "PARAM",
+    [ND_VAR]     = "VAR",
+    [ND_BLOCK]   = "BLOCK",
+    [ND_IF]      = "IF",
+    [ND_WHILE]   = "WHILE",
+    [ND_FOR]     = "FOR",
+    [ND_RETURN]  = "RETURN",
+    [ND_EXPR]    = "EXPR",
+    [ND_NUMBER]  = "NUMBER",
+    [ND_STRING]  = "STRING",
+    [ND_NAME]    = "NAME",
+    [ND_ASSIGN]  = "ASSIGN",
+    [ND_BINARY]  = "BINARY",
+    [ND_NEG]     = "NEG",
+    [ND_CALL]    = "CALL",
+};
+
+/* Hangi alanlar düğüm indeksi: bit 0 a, bit 1 b, bit 2 c, bit 3 d */
+static const unsigned char child_fields[ND_COUNT] = {
+    [ND_PROGRAM] = 1,
+    [ND_FUNC]    = 1 | 2,
+    [ND_VAR]     = 1,
+    [ND_BLOCK]   = 1,
+    [ND_IF]      = 1 | 2 | 4,
+    [ND_WHILE]   = 1 | 2,
+    [ND_FOR]     = 1 | 2 | 4 | 8,
+    [ND_RETURN]  = 1,
+    [ND_EXPR]    = 1,
+    [ND_ASSIGN]  = 1 | 2,
+    [ND_BINARY]  = 1 | 2,
+    [ND_NEG]     = 1,
+    [ND_CALL]    = 2,
+};
+
+struct turkc_ast *turkc_ast_new(void)
+{
+    struct turkc_ast *ast = calloc(1, sizeof(*ast));
+
+    if (!ast)
+        return NULL;
+    ast->cap = 1024;
+    ast->nodes = malloc(ast->cap * sizeof(*ast->nodes));
+    ast->syms = turkc_intern_new();
+    if (!ast->nodes || !ast->syms) {
+        turkc_ast_free(ast);
+        return NULL;
+    }
+    memset(&ast->nodes[0], 0, sizeof(ast->nodes[0]));
+    ast->count = 1;
+    return ast;
+}
+
+void turkc_ast_free(struct turkc_ast *ast)
+{
+    if (!ast)
+        return;
+    if (!ast->borrowed)
+        free(ast->nodes);
+    turkc_intern_free(ast->syms);
+    free(ast);
+}
+
+uint32_t turkc_ast_add(struct turkc_ast *ast, int kind, uint32_t offset)
+{
+    struct turkc_node *n;
+
+    if (ast->count == ast->cap) {
+        if (ast->cap > UINT32_MAX / 2)
+            return 0;
+        if (ast->borrowed) {
+            /* ödünç düğümler büyüyemez: kopyalanır */
+            n = malloc((size_t)ast->cap * 2 * sizeof(*n));
+            if (!n)
+                return 0;
+            memcpy(n, ast->nodes, (size_t)ast->count * sizeof(*n));
+            ast->borrowed = 0;
+        } else {
+            n = realloc(ast->nodes, (size_t)ast->cap * 2 * sizeof(*n));
+        }
+        if (!n)
+            return 0;
+        ast->nodes = n;
+        ast->cap *= 2;
+    }
+    n = &ast->nodes[ast->count];
+    memset(n, 0, sizeof(*n));
+    n->kind = (uint8_t)kind;
+    n->offset = offset;
+    return ast->count++;
+}
+
+const char *turkc_node_name(int kind)
+{
+    if (kind < 0 || kind >= ND_COUNT)
+        return "?";
+    return node_names[kind];
+}
+
+const char *turkc_ast_symbol(const struct turkc_ast *ast, uint32_t sym)
+{
+    const char *text = turkc_intern_text(ast->syms, sym, NULL);
+
+    return text ? text : "?";
+}
+
+static void dump_node(const struct turkc_ast *ast, const struct turkc_node *n, FILE *out)
+{
+    fputs(turkc_node_name(n->kind), out);
+    switch (n->kind) {
+    case ND_FUNC:
+        fprintf(out, " %s %s", turkc_token_spelling(n->op), turkc_ast_symbol(ast, n->c));
+        break;
+    case ND_PARAM:
+    case ND_VAR:
+        fprintf(out, " %s", turkc_ast_symbol(ast, n->c));
+        break;
+    case ND_NUMBER:
+        fprintf(out, " %ld", (long)(int32_t)n->a);
+        break;
+    case ND_STRING:
+    case ND_NAME:
+    case ND_CALL:
+        fprintf(out, " %s", turkc_ast_symbol(ast, n->a));
+        break;
+    case ND_BINARY:
+        fprintf(out, " %s", turkc_token_spelling(n->op));
+        break;
+    }
+    fputc('\n', out);
+}
+
+/* Özyinelemesiz: üretilmiş kodda ağaç binlerce seviye derin olabilir.
+ * Yığında (düğüm, derinlik) çiftleri; önce kardeş, sonra çocuklar ters
+ * sırayla itilir ki çocuklar kardeşten önce yazılsın.
+ */
+void turkc_ast_dump(const struct turkc_ast *ast, FILE *out)
+{
+    struct item { uint32_t node, depth; } *stack, it;
+    size_t top = 0, cap = 256;
+    const struct turkc_node *n;
+    uint32_t fields[4];
+    int i;
+
+    if (!ast->root || !(stack = malloc(cap * sizeof(*stack))))
+        return;
+    stack[top].node = ast->root;
+    stack[top++].depth = 0;
+    while (top > 0) {
+        it = stack[--top];
+        n = &ast->nodes[it.node];
+        fprintf(out, "%*s", (int)it.depth * 2, "");
+        dump_node(ast, n, out);
+
+        /* en fazla 5 itme */
+        if (cap - top < 5) {
+            struct item *s = realloc(stack, cap * 2 * sizeof(*s));
+
+            if (!s)
+                break;
+            stack = s;
+            cap *= 2;
+        }
+        if (it.node != ast->root && n->next) {
+            stack[top].node = n->next;
+            stack[top++].depth = it.depth;
+        }
+        fields[0] = n->a;
+        fields[1] = n->b;
+        fields[2] = n->c;
+        fields[3] = n->d;
+        for (i = 3; i >= 0; i--) {
+            if (!(child_fields[n->kind] & (1 << i)))
+                continue;
+            if (fields[i]) {
+                stack[top].node = fields[i];
+                stack[top++].depth = it.depth + 1;
+            } else if (n->kind == ND_FOR) {
+                stack[top].node = 0;        /* boş for parçası: "-" */
+                stack[top++].depth = it.depth + 1;
+            }
+        }
+    }
+    free(stack);
+}
@@ -0,0 +1,94 @@
+#ifndef TURKC_AST_H
+#define TURKC_AST_H
+
+/* TurkC sözdizim ağacı (bkz. turkc_parse.h).
+ *
+ * Tüm düğümler tek bir dizide durur ve birbirini 32 bit indeksle gösterir;
+ * düğüm başına malloc yoktur. Dizi dolunca iki katına büyür (realloc),
+ * indeksler geçerli kalır, pointer'lar (turkc_ast_node) kalmaz. 0 indeksi
+ * "yok" anlamındadır. Listeler (bildirimler, deyimler, parametreler,
+ * argümanlar) ilk elemanın indeksi ve elemanların next alanıyla tutulur.
+ *
+ * İsimler ve string'ler ağacın interning tablosundadır (turkc_intern.h),
+ * düğümde sembol ID'si durur.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "turkc_intern.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Alanların anlamı türe göre; boş alanlar 0 */
+enum turkc_node_kind {
+    ND_NONE = 0,
+    ND_PROGRAM,     /* a: ilk bildirim (FUNC veya VAR) */
+    ND_FUNC,        /* op: dönüş türü (TK_INT/TK_VOID), a: ilk PARAM, b: gövde (BLOCK), c: isim */
+    ND_PARAM,       /* c: isim */
+    ND_VAR,         /* a: ilk değer, c: isim */
+    ND_BLOCK,       /* a: ilk deyim */
+    ND_IF,          /* a: koşul, b: eger dalı, c: degilse dalı */
+    ND_WHILE,       /* a: koşul, b: gövde */
+    ND_FOR,         /* a: başlangıç (VAR veya EXPR), b: koşul, c: adım, d: gövde */
+    ND_RETURN,      /* a: değer */
+    ND_EXPR,        /* ifade deyimi, a: ifade */
+    ND_NUMBER,      /* a: değer (int32, ikiye tümleyen) */
+    ND_STRING,      /* a: sembol (tırnaklarla) */
+    ND_NAME,        /* a: sembol */
+    ND_ASSIGN,      /* a: hedef (NAME), b: değer */
+    ND_BINARY,      /* op: operatör token'ı (TK_PLUS...TK_GE), a, b: işlenenler */
+    ND_NEG,         /* tekli eksi, a: işlenen */
+    ND_CALL,        /* a: isim, b: ilk argüman */
+
+    ND_COUNT
+};
+
+/* 32 byte: bir cache satırına iki düğüm */
+struct turkc_node {
+    uint8_t kind;
+    uint8_t op;
+    uint16_t flags;             /* sonraki aşamalar için, ayrıştırıcı 0 yazar */
+    uint32_t a, b, c, d;
+    uint32_t next;              /* listedeki sonraki düğüm */
+    uint32_t offset;            /* ilk token'ın kaynaktaki ofseti */
+    uint32_t aux;               /* sonraki aşamalar için (örn. değişken slotu) */
+};
+
+struct turkc_ast {
+    struct turkc_node *nodes;   /* nodes[0] kullanılmaz */
+    uint32_t count, cap;
+    uint32_t root;              /* PROGRAM düğümü */
+    struct turkc_intern *syms;
+    int borrowed;               /* nodes başkasına ait (turkc_cache mapping'i), free edilmez */
+};
+
+struct turkc_ast *turkc_ast_new(void);
+void turkc_ast_free(struct turkc_ast *ast);
+
+/* Yeni düğümün indeksi, bellek yetersizse 0. Alanlar sıfırdır. */
+uint32_t turkc_ast_add(struct turkc_ast *ast, int kind, uint32_t offset);
+
+/* Pointer sadece bir sonraki turkc_ast_add'e kadar geçerlidir */
+static inline struct turkc_node *turkc_ast_node(const struct turkc_ast *ast, uint32_t i)
+{
+    return &ast->nodes[i];
+}
+
+/* "FUNC", "IF", ... */
+const char *turkc_node_name(int kind);
+
+/* Sembolün metni (NUL ile biter) */
+const char *turkc_ast_symbol(const struct turkc_ast *ast, uint32_t sym);
+
+/* Girintili ağaç dökümü, düğüm başına bir satır */
+void turkc_ast_dump(const struct turkc_ast *ast, FILE *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
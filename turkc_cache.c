@@ -0,0 +1,616 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <direct.h>
+#include <io.h>
+#include <process.h>
+#define mkdir(path, mode) _mkdir(path)
+#else
+#include <dirent.h>
+#include <unistd.h>
+#endif
+
+#include "turkc_cache.h"
+#include "turkc_fastlex.h"
+#include "turkc_intern.h"
+#include "turkc_time.h"
+
+/* ---- XXH64 ---- */
+
+#define P1 0x9e3779b185ebca87ULL
+#define P2 0xc2b2ae3d27d4eb4fULL
+#define P3 0x165667b19e3779f9ULL
+#define P4 0x85ebca77c2b2ae63ULL
+#define P5 0x27d4eb2f165667c5ULL
+
+static uint64_t rotl(uint64_t x, int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+/* little-endian okuma (x86/ARM native) */
+static uint64_t read64(const unsigned char *p)
+{
+    uint64_t v;
+
+    memcpy(&v, p, 8);
+    return v;
+}
+
+static uint32_t read32(const unsigned char *p)
+{
+    uint32_t v;
+
+    memcpy(&v, p, 4);
+    return v;
+}
+
+static uint64_t round64(uint64_t acc, uint64_t input)
+{
+    acc += input * P2;
+    return rotl(acc, 31) * P1;
+}
+
+static uint64_t merge(uint64_t acc, uint64_t v)
+{
+    acc ^= round64(0, v);
+    return acc * P1 + P4;
+}
+
+uint64_t turkc_cache_hash(const void *data, size_t len, uint64_t seed)
+{
+    const unsigned char *p = data, *end = p + len;
+    uint64_t h, v1, v2, v3, v4;
+
+    if (len >= 32) {
+        v1 = seed + P1 + P2;
+        v2 = seed + P2;
+        v3 = seed;
+        v4 = seed - P1;
+        do {
+            v1 = round64(v1, read64(p));
+            v2 = round64(v2, read64(p + 8));
+            v3 = round64(v3, read64(p + 16));
+            v4 = round64(v4, read64(p + 24));
+            p += 32;
+        } while (p + 32 <= end);
+        h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        h = merge(h, v1);
+        h = merge(h, v2);
+        h = merge(h, v3);
+        h = merge(h, v4);
+    } else {
+        h = seed + P5;
+    }
+    h += len;
+    for (; p + 8 <= end; p += 8)
+        h = rotl(h ^ round64(0, read64(p)), 27) * P1 + P4;
+    if (p + 4 <= end) {
+        h = rotl(h ^ (read32(p) * P1), 23) * P2 + P3;
+        p += 4;
+    }
+    for (; p < end; p++)
+        h = rotl(h ^ (*p * P5), 11) * P1;
+    h ^= h >> 33;
+    h *= P2;
+    h ^= h >> 29;
+    h *= P3;
+    h ^= h >> 32;
+    return h;
+}
+
+/* ---- Dizin ---- */
+
+static char *path_of(const struct turkc_cache *c, const char *name)
+{
+    size_t n = strlen(c->dir) + strlen(name) + 2;
+    char *p = malloc(n);
+
+    if (p)
+        snprintf(p, n, "%s/%s", c->dir, name);
+    return p;
+}
+
+static char *entry_path(const struct turkc_cache *c, uint64_t hash)
+{
+    char name[24];
+
+    snprintf(name, sizeof(name), "%016llx.tcc", (unsigned long long)hash);
+    return path_of(c, name);
+}
+
+int turkc_cache_open(struct turkc_cache *c, const char *dir)
+{
+    struct stat st;
+
+    memset(c, 0, sizeof(*c));
+    if (mkdir(dir, 0777) != 0 && errno != EEXIST)
+        return -1;
+    if (stat(dir, &st) != 0 || !S_ISDIR(st.st_mode))
+        return -1;
+    c->dir = malloc(strlen(dir) + 1);
+    if (!c->dir)
+        return -1;
+    strcpy(c->dir, dir);
+    return 0;
+}
+
+/* ---- İstatistik dosyası ---- */
+
+static void read_stats(const struct turkc_cache *c, struct turkc_cache_stats *st)
+{
+    char *path = path_of(c, "stats"), key[32], value[64];
+    unsigned long long u;
+    FILE *f;
+    double d;
+
+    memset(st, 0, sizeof(*st));
+    f = path ? fopen(path, "r") : NULL;
+    free(path);
+    if (!f)
+        return;
+    while (fscanf(f, "%31s %63s", key, value) == 2) {
+        u = strtoull(value, NULL, 10);
+        d = strtod(value, NULL);
+        if (strcmp(key, "lookups") == 0)
+            st->lookups = u;
+        else if (strcmp(key, "hits") == 0)
+            st->hits = u;
+        else if (strcmp(key, "stores") == 0)
+            st->stores = u;
+        else if (strcmp(key, "bytes_saved") == 0)
+            st->bytes_saved = u;
+        else if (strcmp(key, "seconds_saved") == 0)
+            st->seconds_saved = d;
+        else if (strcmp(key, "load_seconds") == 0)
+            st->load_seconds = d;
+        else if (strcmp(key, "parse_seconds") == 0)
+            st->parse_seconds = d;
+    }
+    fclose(f);
+}
+
+/* Geçici dosyaya yazıp rename ile yerine koyar */
+static FILE *create_tmp(const struct turkc_cache *c, const char *name, char **tmp)
+{
+    char buf[64];
+    FILE *f;
+
+    snprintf(buf, sizeof(buf), ".tmp-%ld-%s", (long)getpid(), name);
+    *tmp = path_of(c, buf);
+    f = *tmp ? fopen(*tmp, "wb") : NULL;
+    if (!f) {
+        free(*tmp);
+        *tmp = NULL;
+    }
+    return f;
+}
+
+static int commit_tmp(const struct turkc_cache *c, FILE *f, char *tmp, const char *name)
+{
+    char *path = path_of(c, name);
+    int rc = ferror(f) ? -1 : 0;
+
+    if (fclose(f) != 0)
+        rc = -1;
+#ifdef _WIN32
+    if (rc == 0 && path)
+        remove(path);
+#endif
+    if (rc != 0 || !path || rename(tmp, path) != 0) {
+        remove(tmp);
+        rc = -1;
+    }
+    free(path);
+    free(tmp);
+    return rc;
+}
+
+static void write_stats(const struct turkc_cache *c)
+{
+    struct turkc_cache_stats st;
+    char *tmp;
+    FILE *f;
+
+    if (c->stats.lookups == 0)
+        return;
+    read_stats(c, &st);
+    st.lookups += c->stats.lookups;
+    st.hits += c->stats.hits;
+    st.stores += c->stats.stores;
+    st.bytes_saved += c->stats.bytes_saved;
+    st.seconds_saved += c->stats.seconds_saved;
+    st.load_seconds += c->stats.load_seconds;
+    st.parse_seconds += c->stats.parse_seconds;
+    f = create_tmp(c, "stats", &tmp);
+    if (!f)
+        return;
+    fprintf(f, "lookups %llu\nhits %llu\nstores %llu\nbytes_saved %llu\n"
+               "seconds_saved %.9f\nload_seconds %.9f\nparse_seconds %.9f\n",
+            (unsigned long long)st.lookups, (unsigned long long)st.hits,
+            (unsigned long long)st.stores, (unsigned long long)st.bytes_saved,
+            st.seconds_saved, st.load_seconds, st.parse_seconds);
+    commit_tmp(c, f, tmp, "stats");
+}
+
+void turkc_cache_totals(const struct turkc_cache *c, struct turkc_cache_stats *st)
+{
+    read_stats(c, st);
+}
+
+void turkc_cache_close(struct turkc_cache *c)
+{
+    uint32_t i;
+
+    if (!c->dir)
+        return;
+    write_stats(c);
+    for (i = 0; i < c->nmaps; i++)
+        turkc_unmap_file(&c->maps[i]);
+    free(c->maps);
+    free(c->toks);
+    free(c->dir);
+    memset(c, 0, sizeof(*c));
+}
+
+void turkc_cache_free_ast(struct turkc_cache *c, struct turkc_ast *ast)
+{
+    const char *nodes;
+    uint32_t i;
+
+    if (ast && ast->borrowed) {
+        nodes = (const char *)ast->nodes;
+        for (i = 0; i < c->nmaps; i++)
+            if (nodes >= c->maps[i].data && nodes < c->maps[i].data + c->maps[i].size) {
+                if (c->tokens >= (const struct turkc_token_record *)c->maps[i].data &&
+                    (const char *)c->tokens < c->maps[i].data + c->maps[i].size) {
+                    c->tokens = NULL;
+                    c->ntokens = 0;
+                }
+                turkc_unmap_file(&c->maps[i]);
+                c->maps[i] = c->maps[--c->nmaps];
+                break;
+            }
+    }
+    turkc_ast_free(ast);
+}
+
+/* ---- Yükleme ---- */
+
+static uint64_t align(uint64_t x)
+{
+    return (x + TURKC_CACHE_ALIGN - 1) & ~(uint64_t)(TURKC_CACHE_ALIGN - 1);
+}
+
+static int section_ok(uint64_t offset, uint64_t size, uint64_t file_size)
+{
+    return offset % TURKC_CACHE_ALIGN == 0 && offset <= file_size && size <= file_size - offset;
+}
+
+/* Kaydın checksum'ı: header (checksum 0 iken) ve bölümler sırayla, her
+ * biri öncekinin hash'ini seed alır. Dolgu byte'ları kullanılmaz, katılmaz.
+ */
+static uint64_t checksum(const struct turkc_cache_header *hp, const void *tokens,
+                         const void *nodes, const void *syms)
+{
+    struct turkc_cache_header h = *hp;
+    uint64_t x;
+
+    h.checksum = 0;
+    x = turkc_cache_hash(&h, sizeof(h), 0);
+    x = turkc_cache_hash(tokens, (size_t)h.ntokens * sizeof(struct turkc_token_record), x);
+    x = turkc_cache_hash(nodes, (size_t)h.nnodes * sizeof(struct turkc_node), x);
+    return turkc_cache_hash(syms, (size_t)h.syms_size, x);
+}
+
+static int grow_maps(struct turkc_cache *c)
+{
+    struct turkc_mapping *p;
+    uint32_t n = c->maps_cap ? c->maps_cap * 2 : 16;
+
+    if (c->nmaps < c->maps_cap)
+        return 0;
+    p = realloc(c->maps, n * sizeof(*p));
+    if (!p)
+        return -1;
+    c->maps = p;
+    c->maps_cap = n;
+    return 0;
+}
+
+/* Kaydı ast'ye yükler. Yoksa, geçersizse veya checksum tutmuyorsa -1; düğümler değişmez ama
+ * semboller eklenmiş olabilir (ayrıştırıcı aynı metinlere aynı ID'leri
+ * verir, ağaç yine tutarlıdır).
+ */
+static int load(struct turkc_cache *c, struct turkc_ast *ast, uint64_t hash, size_t len)
+{
+    struct turkc_cache_header h;
+    struct turkc_mapping m;
+    const char *p, *end;
+    char *path = entry_path(c, hash);
+    uint32_t i, n;
+    int fd;
+
+    fd = path ? open(path, O_RDONLY) : -1;
+    free(path);
+    if (fd < 0)
+        return -1;
+    if (turkc_map_file(fd, &m) != 0) {
+        close(fd);
+        return -1;
+    }
+    close(fd);
+    if (m.size < sizeof(h))
+        goto fail;
+    memcpy(&h, m.data, sizeof(h));
+    if (memcmp(h.magic, TURKC_CACHE_MAGIC, 4) != 0 || h.version != TURKC_CACHE_VERSION ||
+        h.frontend != TURKC_FRONTEND_VERSION || h.node_size != sizeof(struct turkc_node) ||
+        h.hash != hash || h.source_size != len || h.nnodes < 2 || h.root >= h.nnodes ||
+        !section_ok(h.tokens, (uint64_t)h.ntokens * sizeof(struct turkc_token_record), m.size) ||
+        !section_ok(h.nodes, (uint64_t)h.nnodes * sizeof(struct turkc_node), m.size) ||
+        !section_ok(h.syms, h.syms_size, m.size) ||
+        h.checksum != checksum(&h, m.data + h.tokens, m.data + h.nodes, m.data + h.syms))
+        goto fail;
+
+    /* semboller ID sırasıyla: aynı ID'leri alırlar */
+    p = m.data + h.syms;
+    end = p + h.syms_size;
+    for (i = 0; i < h.nsyms; i++) {
+        if (end - p < 4)
+            goto fail;
+        memcpy(&n, p, 4);
+        p += 4;
+        if ((uint64_t)(end - p) < n || turkc_intern(ast->syms, p, n) != i)
+            goto fail;
+        p += n;
+    }
+    if (grow_maps(c) != 0)
+        goto fail;
+    c->maps[c->nmaps++] = m;
+
+    free(ast->nodes);
+    ast->nodes = (struct turkc_node *)(m.data + h.nodes);
+    ast->count = ast->cap = h.nnodes;
+    ast->root = h.root;
+    ast->borrowed = 1;
+    c->tokens = (const struct turkc_token_record *)(m.data + h.tokens);
+    c->ntokens = h.ntokens;
+    c->stats.seconds_saved += h.parse_seconds;
+    return 0;
+
+fail:
+    turkc_unmap_file(&m);
+    return -1;
+}
+
+/* ---- Kaydetme ---- */
+
+/* Ayrıştırıcıya giden token'ları c->toks'a da yazan kaynak */
+struct recorder {
+    struct turkc_cache *c;
+    struct turkc_fastlex fl;
+    uint32_t n;
+    int oom;
+};
+
+static int recorder_next(void *lexer, struct turkc_token *tok)
+{
+    struct recorder *r = lexer;
+    struct turkc_cache *c = r->c;
+    struct turkc_token_record *rec;
+    int kind = turkc_fastlex_next(&r->fl, tok);
+    uint32_t cap;
+
+    if (kind <= 0 || r->oom)
+        return kind;
+    if (r->n == c->toks_cap) {
+        cap = c->toks_cap ? c->toks_cap * 2 : 4096;
+        rec = cap > c->toks_cap ? realloc(c->toks, (size_t)cap * sizeof(*rec)) : NULL;
+        if (!rec) {
+            r->oom = 1;
+            return kind;
+        }
+        c->toks = rec;
+        c->toks_cap = cap;
+    }
+    rec = &c->toks[r->n++];
+    rec->kind = (uint32_t)kind;
+    rec->offset = (uint32_t)tok->offset;
+    rec->length = (uint32_t)tok->length;
+    rec->line = (uint32_t)tok->line;
+    return kind;
+}
+
+static const char *recorder_error(void *lexer)
+{
+    return ((struct recorder *)lexer)->fl.error;
+}
+
+static void pad(FILE *f, uint64_t from, uint64_t to)
+{
+    static const char zero[TURKC_CACHE_ALIGN];
+
+    fwrite(zero, 1, (size_t)(to - from), f);
+}
+
+static void store(struct turkc_cache *c, const struct turkc_ast *ast, uint64_t hash,
+                  size_t len, uint32_t ntokens, double seconds)
+{
+    struct turkc_cache_header h;
+    uint32_t nsyms = turkc_intern_count(ast->syms), i, n;
+    uint64_t end;
+    const char *text;
+    char name[24], *tmp, *syms, *p;
+    size_t slen;
+    FILE *f;
+
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, TURKC_CACHE_MAGIC, 4);
+    h.version = TURKC_CACHE_VERSION;
+    h.frontend = TURKC_FRONTEND_VERSION;
+    h.node_size = sizeof(struct turkc_node);
+    h.hash = hash;
+    h.source_size = len;
+    h.ntokens = ntokens;
+    h.nnodes = ast->count;
+    h.root = ast->root;
+    h.nsyms = nsyms;
+    h.tokens = align(sizeof(h));
+    h.nodes = align(h.tokens + (uint64_t)ntokens * sizeof(struct turkc_token_record));
+    h.syms = align(h.nodes + (uint64_t)ast->count * sizeof(struct turkc_node));
+    for (i = 0; i < nsyms; i++) {
+        turkc_intern_text(ast->syms, i, &slen);
+        h.syms_size += 4 + slen;
+    }
+    h.parse_seconds = seconds;
+
+    /* sembol bölümü checksum için önce bellekte kurulur */
+    p = syms = malloc(h.syms_size ? (size_t)h.syms_size : 1);
+    if (!syms)
+        return;
+    for (i = 0; i < nsyms; i++) {
+        text = turkc_intern_text(ast->syms, i, &slen);
+        n = (uint32_t)slen;
+        memcpy(p, &n, 4);
+        memcpy(p + 4, text, slen);
+        p += 4 + slen;
+    }
+    h.checksum = checksum(&h, c->toks, ast->nodes, syms);
+
+    snprintf(name, sizeof(name), "%016llx.tcc", (unsigned long long)hash);
+    f = create_tmp(c, name, &tmp);
+    if (!f) {
+        free(syms);
+        return;
+    }
+    fwrite(&h, sizeof(h), 1, f);
+    pad(f, sizeof(h), h.tokens);
+    fwrite(c->toks, sizeof(*c->toks), ntokens, f);
+    end = h.tokens + (uint64_t)ntokens * sizeof(struct turkc_token_record);
+    pad(f, end, h.nodes);
+    fwrite(ast->nodes, sizeof(struct turkc_node), ast->count, f);
+    end = h.nodes + (uint64_t)ast->count * sizeof(struct turkc_node);
+    pad(f, end, h.syms);
+    fwrite(syms, 1, (size_t)h.syms_size, f);
+    free(syms);
+    if (commit_tmp(c, f, tmp, name) == 0)
+        c->stats.stores++;
+}
+
+int turkc_cache_parse(struct turkc_cache *c, struct turkc_ast *ast, const char *src,
+                      size_t len, struct turkc_parse_error *err)
+{
+    struct recorder r;
+    struct turkc_token_source ts = { recorder_next, recorder_error, &r };
+    double start = turkc_now(), elapsed;
+    uint64_t hash = turkc_cache_hash(src, len, 0);
+
+    c->stats.lookups++;
+    if (load(c, ast, hash, len) == 0) {
+        elapsed = turkc_now() - start;
+        c->hit = 1;
+        c->stats.hits++;
+        c->stats.bytes_saved += len;
+        c->stats.load_seconds += elapsed;
+        c->stats.seconds_saved -= elapsed;
+        return 0;
+    }
+
+    c->hit = 0;
+    c->tokens = c->toks;
+    c->ntokens = 0;
+    r.c = c;
+    r.n = 0;
+    r.oom = 0;
+    turkc_fastlex_init(&r.fl, src, len, TURKC_SIMD_AUTO);
+    start = turkc_now();
+    if (turkc_parse(ast, &ts, err) != 0)
+        return -1;
+    elapsed = turkc_now() - start;
+    c->stats.parse_seconds += elapsed;
+    c->tokens = c->toks;
+    c->ntokens = r.oom ? 0 : r.n;
+    if (!r.oom)
+        store(c, ast, hash, len, r.n, elapsed);
+    return 0;
+}
+
+/* ---- Bakım ---- */
+
+#ifdef _WIN32
+
+long turkc_cache_clear(struct turkc_cache *c)
+{
+    (void)c;
+    return -1;
+}
+
+void turkc_cache_usage(const struct turkc_cache *c, unsigned long *entries,
+                       unsigned long long *bytes)
+{
+    (void)c;
+    *entries = 0;
+    *bytes = 0;
+}
+
+#else
+
+static int is_entry(const char *name)
+{
+    size_t n = strlen(name);
+
+    return n == 20 && strcmp(name + 16, ".tcc") == 0;
+}
+
+long turkc_cache_clear(struct turkc_cache *c)
+{
+    struct dirent *e;
+    long removed = 0;
+    char *path;
+    DIR *d = opendir(c->dir);
+
+    if (!d)
+        return -1;
+    while ((e = readdir(d)) != NULL) {
+        if (!is_entry(e->d_name) && strcmp(e->d_name, "stats") != 0)
+            continue;
+        path = path_of(c, e->d_name);
+        if (path && remove(path) == 0 && is_entry(e->d_name))
+            removed++;
+        free(path);
+    }
+    closedir(d);
+    memset(&c->stats, 0, sizeof(c->stats));
+    return removed;
+}
+
+void turkc_cache_usage(const struct turkc_cache *c, unsigned long *entries,
+                       unsigned long long *bytes)
+{
+    struct dirent *e;
+    struct stat st;
+    char *path;
+    DIR *d = opendir(c->dir);
+
+    *entries = 0;
+    *bytes = 0;
+    if (!d)
+        return;
+    while ((e = readdir(d)) != NULL) {
+        if (!is_entry(e->d_name))
+            continue;
+        path = path_of(c, e->d_name);
+        if (path && stat(path, &st) == 0) {
+            (*entries)++;
+            *bytes += (unsigned long long)st.st_size;
+        }
+        free(path);
+    }
+    closedir(d);
+}
+
+#endif
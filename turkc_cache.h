@@ -0,0 +1,139 @@
+#ifndef TURKC_CACHE_H
+#define TURKC_CACHE_H
+
+/* Token ve sözdizim ağacı için disk cache'i.
+ *
+ *   struct turkc_cache cache;
+ *
+ *   turkc_cache_open(&cache, ".tccache");
+ *   turkc_cache_parse(&cache, ast, src, len, &err);     (turkc_parse_buffer gibi)
+ *   ...
+ *   turkc_cache_free_ast(&cache, ast);
+ *   turkc_cache_close(&cache);
+ *
+ * Anahtar kaynağın 64 bit içerik hash'idir (turkc_cache_hash, XXH64) ve
+ * boyudur; kayıt ayrıca ön ucun sürümünü (TURKC_FRONTEND_VERSION; Makefile
+ * kaydedilenleri belirleyen kaynakların, yani scanner.l, anahtar kelime
+ * tablosu, turkc_fastlex, turkc_parse ve düğüm düzeninin cksum'unu verir)
+ * ve kayıt biçiminin sürümünü taşır. Biri tutmayan kayıt ıskadır ve üzerine
+ * yazılır. Kayıt dosyası dizin/<hash>.tcc'dir:
+ *
+ *   header, token kayıtları (turkc_token_record), düğümler (nodes[0]
+ *   dahil), semboller (ID sırasıyla uint32 uzunluk + metin)
+ *
+ * Bölümler 64 byte'a hizalıdır. İsabette dosya map edilir
+ * (turkc_map_file, MAP_PRIVATE): token'lar ve düğümler kopyalanmadan
+ * kullanılır, ast->nodes mapping'i gösterir (ast->borrowed) ve sonraki
+ * aşamaların yazdıkları dosyaya yansımaz. Yalnız semboller yeniden intern
+ * edilir; ID sırasıyla eklendikleri için ID'ler aynı kalır. Iskada kaynak
+ * turkc_fastlex ile taranıp ayrıştırılır ve kayıt geçici bir dosyaya
+ * yazılıp rename ile yerine konur; yarım kalan yazma kayıt bırakmaz.
+ * Ayrıştırma hatası olan kaynak kaydedilmez.
+ *
+ * Header'da header'ın ve tüm bölümlerin XXH64'ü (checksum) durur ve her
+ * isabette denetlenir: kesik, yarım yazılmış veya bozulmuş kayıt ıskadır,
+ * yeniden taranıp üzerine yazılır. Bu bozulmaya karşıdır; checksum'ı da
+ * yeniden hesaplayan kasıtlı bir değişikliğe karşı koruma değildir.
+ *
+ * İstatistikler bu süreç için tutulur ve turkc_cache_close'da dizindeki
+ * "stats" dosyasına eklenir (aynı anda çalışan süreçlerin eklemeleri
+ * birbirini ezebilir).
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "turkc_ast.h"
+#include "turkc_mmap.h"
+#include "turkc_parse.h"
+#include "turkc_tokstream.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Kayıt biçimi veya ayrıştırıcının ürettiği ağaç değişince artırılır */
+#define TURKC_CACHE_VERSION     2
+
+/* Token'ları ve ağacı üreten kaynakların sürümü (bkz. Makefile); elle derlemede 0 */
+#ifndef TURKC_FRONTEND_VERSION
+#define TURKC_FRONTEND_VERSION  0
+#endif
+
+#define TURKC_CACHE_MAGIC       "TKCC"
+#define TURKC_CACHE_ALIGN       64
+
+struct turkc_cache_header {
+    char magic[4];              /* "TKCC" */
+    uint32_t version;           /* TURKC_CACHE_VERSION */
+    uint32_t frontend;          /* TURKC_FRONTEND_VERSION */
+    uint32_t node_size;         /* sizeof(struct turkc_node) */
+    uint64_t hash;              /* kaynağın turkc_cache_hash'i */
+    uint64_t source_size;
+    uint32_t ntokens, nnodes;   /* nnodes nodes[0]'ı da sayar */
+    uint32_t root, nsyms;
+    uint64_t tokens, nodes, syms, syms_size;    /* dosyadaki ofsetler, sembol bölümü boyu */
+    double parse_seconds;       /* kaydedilirken tarama + ayrıştırma süresi */
+    uint64_t checksum;          /* header (bu alan 0 iken), token'lar, düğümler, semboller */
+};
+
+struct turkc_cache_stats {
+    uint64_t lookups, hits, stores;
+    uint64_t bytes_saved;       /* isabetlerde taranmayan kaynak byte'ı */
+    double seconds_saved;       /* isabetlerde kaydedilmiş ayrıştırma süresi - yükleme */
+    double load_seconds;        /* isabetlerde hash + map + sembol yükleme */
+    double parse_seconds;       /* ıskalarda tarama + ayrıştırma */
+};
+
+struct turkc_cache {
+    char *dir;
+    struct turkc_cache_stats stats;         /* bu süreç */
+    struct turkc_mapping *maps;             /* isabetlerin mapping'leri */
+    uint32_t nmaps, maps_cap;
+    struct turkc_token_record *toks;        /* ıskada taranan token'lar */
+    uint32_t toks_cap;
+    /* son turkc_cache_parse */
+    int hit;
+    const struct turkc_token_record *tokens;
+    uint32_t ntokens;
+};
+
+/* XXH64; seed 0 ile anahtar */
+uint64_t turkc_cache_hash(const void *data, size_t len, uint64_t seed);
+
+/* Dizini (yoksa) oluşturur. Başarıda 0, olmazsa -1. */
+int turkc_cache_open(struct turkc_cache *c, const char *dir);
+
+/* İstatistikleri dizine ekler ve mapping'leri kapatır. Cache'ten gelen
+ * ağaçlar önce free edilmelidir.
+ */
+void turkc_cache_close(struct turkc_cache *c);
+
+/* turkc_ast_free; ağaç kayıttan geldiyse mapping'i de kapatılır (yoksa
+ * mapping turkc_cache_close'a kadar kalır)
+ */
+void turkc_cache_free_ast(struct turkc_cache *c, struct turkc_ast *ast);
+
+/* turkc_parse_buffer gibi; ast yeni olmalıdır (turkc_ast_new). Kayıt
+ * varsa ondan yükler, yoksa ayrıştırıp kaydeder (kaydetme hatası yok
+ * sayılır). Sonra c->hit, c->tokens ve c->ntokens bu kaynağındır; tokens
+ * sonraki çağrıya veya kapatmaya kadar geçerlidir.
+ */
+int turkc_cache_parse(struct turkc_cache *c, struct turkc_ast *ast, const char *src,
+                      size_t len, struct turkc_parse_error *err);
+
+/* Birikmiş istatistikler (dizindeki "stats"); dosya yoksa sıfır */
+void turkc_cache_totals(const struct turkc_cache *c, struct turkc_cache_stats *st);
+
+/* Tüm kayıtları ve istatistikleri siler; silinen kayıt sayısı, hata -1 */
+long turkc_cache_clear(struct turkc_cache *c);
+
+/* Kayıt sayısı ve toplam boyu */
+void turkc_cache_usage(const struct turkc_cache *c, unsigned long *entries,
+                       unsigned long long *bytes);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,425 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "turkc_corpus.h"
+
+#define MAX_VARS 16
+
+struct gen {
+    char *data;
+    size_t len, cap;
+    int oom;
+    uint64_t rng;
+    uint32_t nints;             /* üretilen int fonksiyonları (çağrılabilir) */
+    uint32_t nvoids;
+    char vars[MAX_VARS][64];    /* fonksiyonun tanımlı yerelleri ve parametreleri */
+    int nvars;
+};
+
+static const char *const shape_names[TURKC_CORPUS_SHAPES] = {
+    "ident", "comment", "string", "nest", "keyword", "mixed"
+};
+
+/* Anahtar kelime veya yaz olmayan kelimeler */
+static const char *const words[] = {
+    "sayi", "toplam", "deger", "sonuc", "adim", "liste", "uzunluk", "gecici",
+    "sayac", "indeks", "fark", "oran", "kalan", "bolum", "carpim", "en_buyuk",
+    "en_kucuk", "ortalama", "sinir", "baslangic", "bitis", "konum", "hiz", "zaman",
+    "agirlik", "yukseklik", "genislik", "derinlik", "kapasite", "miktar", "fiyat",
+    "tutar", "vergi", "indirim", "puan", "seviye", "katman", "dugum", "kenar",
+    "yol", "maliyet", "hedef", "kaynak", "tampon", "boyut", "sira", "anahtar",
+    "belge", "satir", "sutun", "karakter", "kelime", "cumle", "paragraf"
+};
+#define NWORDS (sizeof(words) / sizeof(words[0]))
+
+static const char *const binops[] = {
+    "+", "-", "*", "/", "%", "<", ">", "<=", ">=", "==", "!="
+};
+
+/* splitmix64: her platformda aynı dizi */
+static uint64_t next(struct gen *g)
+{
+    uint64_t z = (g->rng += 0x9e3779b97f4a7c15ull);
+
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+/* [lo, hi] */
+static unsigned range(struct gen *g, unsigned lo, unsigned hi)
+{
+    return lo + (unsigned)(next(g) % (hi - lo + 1));
+}
+
+static const char *word(struct gen *g)
+{
+    return words[next(g) % NWORDS];
+}
+
+static void put(struct gen *g, const char *s, size_t n)
+{
+    size_t cap;
+    char *d;
+
+    if (g->oom)
+        return;
+    if (g->len + n + 2 > g->cap) {
+        cap = g->cap ? g->cap : 1 << 16;
+        while (g->len + n + 2 > cap)
+            cap *= 2;
+        if (!(d = realloc(g->data, cap))) {
+            g->oom = 1;
+            return;
+        }
+        g->data = d;
+        g->cap = cap;
+    }
+    memcpy(g->data + g->len, s, n);
+    g->len += n;
+}
+
+static void puts_(struct gen *g, const char *s)
+{
+    put(g, s, strlen(s));
+}
+
+static void printf_(struct gen *g, const char *fmt, ...)
+{
+    char tmp[256];
+    va_list ap;
+    int n;
+
+    va_start(ap, fmt);
+    n = vsnprintf(tmp, sizeof(tmp), fmt, ap);
+    va_end(ap);
+    if (n > 0)
+        put(g, tmp, (size_t)n < sizeof(tmp) ? (size_t)n : sizeof(tmp) - 1);
+}
+
+static void indent(struct gen *g, int level)
+{
+    static const char spaces[] = "                                ";
+    int n = level * 4;
+
+    for (; n > 32; n -= 32)
+        put(g, spaces, 32);
+    put(g, spaces, (size_t)n);
+}
+
+/* lo..hi kelimelik cümle */
+static void sentence(struct gen *g, unsigned lo, unsigned hi)
+{
+    unsigned i, n = range(g, lo, hi);
+
+    for (i = 0; i < n; i++) {
+        if (i)
+            puts_(g, " ");
+        puts_(g, word(g));
+    }
+}
+
+/* Yeni yerel: long ise 2-4 kelime, sonuna indeks (fonksiyonda eşsiz) */
+static const char *new_var(struct gen *g, int longname)
+{
+    char *v = g->vars[g->nvars];
+    unsigned i, n = longname ? range(g, 2, 4) : 1;
+    size_t len = 0;
+
+    if (g->nvars == MAX_VARS)
+        return g->vars[next(g) % MAX_VARS];
+    for (i = 0; i < n; i++)
+        len += (size_t)snprintf(v + len, sizeof(g->vars[0]) - len, "%s%s", i ? "_" : "", word(g));
+    if (!longname)
+        snprintf(v, sizeof(g->vars[0]), "%c", 'a' + g->nvars);
+    else
+        snprintf(v + len, sizeof(g->vars[0]) - len, "_%d", g->nvars);
+    g->nvars++;
+    return v;
+}
+
+static const char *any_var(struct gen *g)
+{
+    return g->vars[next(g) % g->nvars];
+}
+
+static void int_name(struct gen *g, uint32_t n)
+{
+    printf_(g, "%s_%lu", words[n % NWORDS], (unsigned long)n);
+}
+
+/* terms terimli ifade: değişken, sayı veya önceki bir fonksiyona çağrı */
+static void expr(struct gen *g, unsigned terms)
+{
+    unsigned i, r;
+
+    for (i = 0; i < terms; i++) {
+        if (i)
+            printf_(g, " %s ", binops[next(g) % (sizeof(binops) / sizeof(binops[0]))]);
+        r = range(g, 0, 9);
+        if (r < 6) {
+            puts_(g, any_var(g));
+        } else if (r < 9 || !g->nints) {
+            printf_(g, "%u", range(g, 0, r == 8 ? 100000 : 9));
+        } else {
+            int_name(g, (uint32_t)(next(g) % g->nints));
+            printf_(g, "(%s, %u)", any_var(g), range(g, 0, 99));
+        }
+    }
+}
+
+/* int <isim>(p0, p1) { */
+static void begin_int(struct gen *g, int longnames)
+{
+    const char *p0, *p1;
+
+    g->nvars = 0;
+    puts_(g, "int ");
+    int_name(g, g->nints);
+    p0 = new_var(g, longnames);
+    p1 = new_var(g, longnames);
+    printf_(g, "(int %s, int %s) {\n", p0, p1);
+}
+
+static void end_int(struct gen *g)
+{
+    puts_(g, "    dondur ");
+    expr(g, range(g, 1, 3));
+    puts_(g, ";\n}\n\n");
+    g->nints++;
+}
+
+static void gen_ident(struct gen *g)
+{
+    unsigned i, n;
+    const char *v;
+
+    begin_int(g, 1);
+    n = range(g, 4, 10);
+    for (i = 0; i < n; i++) {
+        puts_(g, "    int ");
+        v = new_var(g, 1);
+        printf_(g, "%s = ", v);
+        g->nvars--;             /* kendi ilk değerinde görünmez */
+        expr(g, range(g, 2, 4));
+        g->nvars++;
+        puts_(g, ";\n");
+    }
+    n = range(g, 4, 10);
+    for (i = 0; i < n; i++) {
+        printf_(g, "    %s = ", any_var(g));
+        expr(g, range(g, 3, 8));
+        puts_(g, ";\n");
+    }
+    end_int(g);
+}
+
+static void gen_comment(struct gen *g)
+{
+    unsigned i, j, n;
+    const char *v;
+
+    puts_(g, "/* ");
+    int_name(g, g->nints);
+    puts_(g, ": ");
+    sentence(g, 6, 14);
+    n = range(g, 2, 8);
+    for (i = 0; i < n; i++) {
+        puts_(g, "\n * ");
+        sentence(g, 6, 14);
+    }
+    puts_(g, "\n */\n");
+    begin_int(g, 0);
+    n = range(g, 3, 6);
+    for (i = 0; i < n; i++) {
+        puts_(g, "    // ");
+        sentence(g, 4, 12);
+        puts_(g, "\n");
+        if (range(g, 0, 2) == 0) {
+            puts_(g, "    /* ");
+            sentence(g, 4, 10);
+            for (j = range(g, 0, 3); j > 0; j--) {
+                puts_(g, "\n       ");
+                sentence(g, 4, 10);
+            }
+            puts_(g, " */\n");
+        }
+        v = new_var(g, 0);
+        printf_(g, "    int %s = ", v);
+        g->nvars--;
+        expr(g, range(g, 1, 3));
+        g->nvars++;
+        puts_(g, ";   // ");
+        sentence(g, 2, 8);
+        puts_(g, "\n");
+    }
+    end_int(g);
+}
+
+static void gen_string(struct gen *g)
+{
+    static const char punct[] = ".,:;!?-()'";
+    unsigned i, n, len, max;
+
+    begin_int(g, 0);
+    n = range(g, 2, 5);
+    for (i = 0; i < n; i++) {
+        puts_(g, "    yaz(\"");
+        max = range(g, 50, 3000);
+        for (len = 0; len < max && !g->oom; ) {
+            size_t before = g->len;
+
+            puts_(g, word(g));
+            if (range(g, 0, 7) == 0)
+                put(g, &punct[next(g) % (sizeof(punct) - 1)], 1);
+            puts_(g, range(g, 0, 39) == 0 ? "\n" : " ");
+            len += (unsigned)(g->len - before);
+        }
+        puts_(g, "\");\n");
+    }
+    end_int(g);
+}
+
+/* ((((v + 1) * 2) - 3) ...): depth kat parantez */
+static void nest_expr(struct gen *g, const char *v, unsigned depth)
+{
+    unsigned i;
+
+    for (i = 0; i < depth; i++)
+        puts_(g, "(");
+    puts_(g, v);
+    for (i = 0; i < depth; i++)
+        printf_(g, " %s %u)", binops[next(g) % 3], range(g, 1, 9));
+}
+
+static void nest_block(struct gen *g, unsigned level, unsigned depth)
+{
+    unsigned k = range(g, 0, 9), kind = (unsigned)(next(g) % 3);
+
+    indent(g, level);
+    switch (kind) {
+    case 0:
+        printf_(g, "eger (d > %u) {\n", k);
+        break;
+    case 1:
+        printf_(g, "iken (d > %u) {\n", k);
+        indent(g, level + 1);
+        puts_(g, "d = d - 1;\n");
+        break;
+    default:
+        printf_(g, "icin (int i%u = 0; i%u < %u; i%u = i%u + 1) {\n",
+                level, level, k, level, level);
+        break;
+    }
+    if (level < depth) {
+        nest_block(g, level + 1, depth);
+    } else {
+        indent(g, level + 1);
+        puts_(g, "d = ");
+        nest_expr(g, "d", range(g, depth / 2, depth));
+        puts_(g, ";\n");
+    }
+    indent(g, level);
+    if (kind == 0 && range(g, 0, 1) == 0) {
+        puts_(g, "} degilse {\n");
+        indent(g, level + 1);
+        puts_(g, "d = ");
+        nest_expr(g, "d", range(g, 1, 8));
+        puts_(g, ";\n");
+        indent(g, level);
+    }
+    puts_(g, "}\n");
+}
+
+static void gen_nest(struct gen *g)
+{
+    begin_int(g, 0);
+    puts_(g, "    int d = a;\n");
+    nest_block(g, 1, range(g, 8, TURKC_CORPUS_MAX_NEST));
+    puts_(g, "    dondur d;\n}\n\n");
+    g->nints++;
+}
+
+static void gen_keyword(struct gen *g)
+{
+    unsigned i, n;
+
+    if (range(g, 0, 3) == 0) {
+        printf_(g, "void v%lu(int a) {\n", (unsigned long)g->nvoids++);
+        printf_(g, "    eger (a %s %u) {\n        dondur;\n    }\n", binops[next(g) % 6 + 5], range(g, 0, 9));
+        puts_(g, "    yaz(a);\n}\n\n");
+        return;
+    }
+    begin_int(g, 0);
+    puts_(g, "    int c = 0;\n");
+    n = range(g, 6, 16);
+    for (i = 0; i < n; i++) {
+        switch (next(g) % 5) {
+        case 0:
+            printf_(g, "    eger (a %s b) {\n        dondur a;\n    } degilse {\n        c = b;\n    }\n",
+                    binops[next(g) % 6 + 5]);
+            break;
+        case 1:
+            puts_(g, "    iken (c > 0) {\n        c = c - 1;\n    }\n");
+            break;
+        case 2:
+            printf_(g, "    icin (int i = 0; i < %u; i = i + 1) {\n        c = c + i;\n    }\n",
+                    range(g, 1, 9));
+            break;
+        case 3:
+            printf_(g, "    eger (c == %u) {\n        dondur 0;\n    }\n", range(g, 0, 9));
+            break;
+        default:
+            printf_(g, "    c = a %s b;\n", binops[next(g) % 5]);
+            break;
+        }
+    }
+    puts_(g, "    dondur c;\n}\n\n");
+    g->nints++;
+}
+
+static void (*const shapes[TURKC_CORPUS_MIXED])(struct gen *) = {
+    gen_ident, gen_comment, gen_string, gen_nest, gen_keyword
+};
+
+const char *turkc_corpus_name(int shape)
+{
+    return shape >= 0 && shape < TURKC_CORPUS_SHAPES ? shape_names[shape] : "?";
+}
+
+int turkc_corpus_find(const char *name)
+{
+    int i;
+
+    for (i = 0; i < TURKC_CORPUS_SHAPES; i++)
+        if (strcmp(name, shape_names[i]) == 0)
+            return i;
+    return -1;
+}
+
+char *turkc_corpus_generate(int shape, size_t size, uint64_t seed, size_t *len)
+{
+    struct gen g;
+
+    if (shape < 0 || shape >= TURKC_CORPUS_SHAPES)
+        return NULL;
+    memset(&g, 0, sizeof(g));
+    g.rng = seed ^ ((uint64_t)(shape + 1) << 56);
+    while (g.len < size && !g.oom) {
+        if (shape == TURKC_CORPUS_MIXED)
+            shapes[next(&g) % TURKC_CORPUS_MIXED](&g);
+        else
+            shapes[shape](&g);
+    }
+    puts_(&g, "int ana() {\n    dondur 0;\n}\n");
+    if (g.oom) {
+        free(g.data);
+        return NULL;
+    }
+    g.data[g.len] = '\0';
+    g.data[g.len + 1] = '\0';
+    *len = g.len;
+    return g.data;
+}
@@ -0,0 +1,65 @@
+#ifndef TURKC_CORPUS_H
+#define TURKC_CORPUS_H
+
+/* Benchmark için sentetik TurkC kaynağı (tcbench).
+ *
+ *   size_t len;
+ *   char *src = turkc_corpus_generate(TURKC_CORPUS_NEST, 16 << 20, 1, &len);
+ *   ...
+ *   free(src);
+ *
+ * Üretilen kaynak spesifikasyondaki yapılardan kurulur ve geçerli bir
+ * programdır: ayrıştırılır ve isimleri çözülür (fonksiyonlar yalnız
+ * öncekileri çağırır, yerel değişkenler kullanılmadan önce tanımlanır),
+ * sonunda ana() vardır. Aynı şekil, boy ve seed her platformda aynı
+ * byte'ları verir (splitmix64), bu yüzden farklı commit'lerin sonuçları
+ * karşılaştırılabilir.
+ *
+ * Şekiller taranan token'ların karışımını değiştirir:
+ *
+ *   ident     uzun identifier'lar, çok terimli ifadeler
+ *   comment   kodun çoğu blok ve satır yorumu
+ *   string    uzun (bazen çok satırlı) yaz("...") string'leri
+ *   nest      iç içe eger/iken/icin blokları ve parantezler
+ *   keyword   kısa isimler, sık anahtar kelime ve operatör
+ *   mixed     fonksiyon başına yukarıdakilerden biri
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum turkc_corpus_shape {
+    TURKC_CORPUS_IDENT,
+    TURKC_CORPUS_COMMENT,
+    TURKC_CORPUS_STRING,
+    TURKC_CORPUS_NEST,
+    TURKC_CORPUS_KEYWORD,
+    TURKC_CORPUS_MIXED,
+
+    TURKC_CORPUS_SHAPES
+};
+
+/* nest şeklinde en derin blok ve parantez iç içeliği */
+#define TURKC_CORPUS_MAX_NEST   48
+
+/* "ident", "comment", ... */
+const char *turkc_corpus_name(int shape);
+
+/* İsimle şekil, yoksa -1 */
+int turkc_corpus_find(const char *name);
+
+/* En az size byte'lık (son fonksiyon ve ana() kadar fazlası olabilir)
+ * kaynak üretir. Dönen buffer malloc'tur; src[len] ve src[len + 1] '\0'dır
+ * (turkc_lexer_open_buffer kopyasız tarayabilir). Bellek yetmezse NULL.
+ */
+char *turkc_corpus_generate(int shape, size_t size, uint64_t seed, size_t *len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,512 @@
+#include <string.h>
+
+#include "turkc_fastlex.h"
+#include "turkc_keywords.h"
+#include "turkc_token.h"
+
+/* Bir backend'in tarama çekirdekleri. Hepsi [p, end) içinde çalışır ve
+ * end'den sonrasını okumaz; vektör döngüleri kalan kısmı skaler bitirir.
+ */
+struct turkc_simd_kernels {
+    enum turkc_simd simd;
+    /* [ \t\n]* sonu, geçilen satır sonları *lines'a eklenir */
+    const char *(*skip_ws)(const char *p, const char *end, unsigned long *lines);
+    /* [a-zA-Z0-9_]* sonu */
+    const char *(*ident_end)(const char *p, const char *end);
+    /* [0-9]* sonu */
+    const char *(*digits_end)(const char *p, const char *end);
+    /* ilk '"', yoksa end */
+    const char *(*find_quote)(const char *p, const char *end);
+    /* ilk "*" "/" çiftinin '*'ı, yoksa end */
+    const char *(*find_comment_end)(const char *p, const char *end);
+    unsigned long (*count_nl)(const char *p, const char *end);
+};
+
+/* ---- Skaler ---- */
+
+static int is_ident(unsigned char c)
+{
+    return (unsigned char)((c | 0x20) - 'a') < 26 ||
+           (unsigned char)(c - '0') < 10 || c == '_';
+}
+
+static const char *skip_ws_scalar(const char *p, const char *end, unsigned long *lines)
+{
+    for (; p < end; p++) {
+        if (*p == '\n')
+            (*lines)++;
+        else if (*p != ' ' && *p != '\t')
+            break;
+    }
+    return p;
+}
+
+static const char *ident_end_scalar(const char *p, const char *end)
+{
+    while (p < end && is_ident((unsigned char)*p))
+        p++;
+    return p;
+}
+
+static const char *digits_end_scalar(const char *p, const char *end)
+{
+    while (p < end && (unsigned char)(*p - '0') < 10)
+        p++;
+    return p;
+}
+
+static const char *find_quote_scalar(const char *p, const char *end)
+{
+    const char *q = memchr(p, '"', end - p);
+
+    return q ? q : end;
+}
+
+static const char *find_comment_end_scalar(const char *p, const char *end)
+{
+    for (; end - p >= 2; p++)
+        if (p[0] == '*' && p[1] == '/')
+            return p;
+    return end;
+}
+
+static unsigned long count_nl_scalar(const char *p, const char *end)
+{
+    unsigned long n = 0;
+
+    while ((p = memchr(p, '\n', end - p)) != NULL) {
+        n++;
+        p++;
+    }
+    return n;
+}
+
+static const struct turkc_simd_kernels kernels_scalar = {
+    TURKC_SIMD_SCALAR, skip_ws_scalar, ident_end_scalar, digits_end_scalar,
+    find_quote_scalar, find_comment_end_scalar, count_nl_scalar
+};
+
+/* ---- x86: SSE2 ve AVX2 ----
+ *
+ * Her blokta sınıf maskesi movemask ile bit maskesine çevrilir; ilk
+ * uymayan byte'ın yeri ctz, satır sayısı popcount ile bulunur. Aralık
+ * kontrolü: (x - lo) <= (hi - lo) işaretsiz, yani max_epu8(x - lo, hi - lo)
+ * == hi - lo.
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define TURKC_HAVE_X86_SIMD 1
+#include <immintrin.h>
+
+#define SSE2 __attribute__((target("sse2")))
+#define AVX2 __attribute__((target("avx2")))
+
+#define IN_RANGE128(v, lo, span) \
+    _mm_cmpeq_epi8(_mm_max_epu8(_mm_sub_epi8((v), _mm_set1_epi8(lo)), _mm_set1_epi8(span)), \
+                   _mm_set1_epi8(span))
+#define IN_RANGE256(v, lo, span) \
+    _mm256_cmpeq_epi8(_mm256_max_epu8(_mm256_sub_epi8((v), _mm256_set1_epi8(lo)), \
+                                      _mm256_set1_epi8(span)), _mm256_set1_epi8(span))
+
+SSE2 static const char *skip_ws_sse2(const char *p, const char *end, unsigned long *lines)
+{
+    __m128i v, nl, ws;
+    unsigned stop, nls;
+
+    while (end - p >= 16) {
+        v = _mm_loadu_si128((const __m128i *)p);
+        nl = _mm_cmpeq_epi8(v, _mm_set1_epi8('\n'));
+        ws = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')),
+                                       _mm_cmpeq_epi8(v, _mm_set1_epi8('\t'))), nl);
+        stop = ~(unsigned)_mm_movemask_epi8(ws) & 0xFFFF;
+        nls = (unsigned)_mm_movemask_epi8(nl);
+        if (stop) {
+            stop = __builtin_ctz(stop);
+            *lines += __builtin_popcount(nls & ((1u << stop) - 1));
+            return p + stop;
+        }
+        *lines += __builtin_popcount(nls);
+        p += 16;
+    }
+    return skip_ws_scalar(p, end, lines);
+}
+
+SSE2 static const char *ident_end_sse2(const char *p, const char *end)
+{
+    __m128i v, ok;
+    unsigned stop;
+
+    while (end - p >= 16) {
+        v = _mm_loadu_si128((const __m128i *)p);
+        ok = _mm_or_si128(IN_RANGE128(_mm_or_si128(v, _mm_set1_epi8(0x20)), 'a', 25),
+                          _mm_or_si128(IN_RANGE128(v, '0', 9),
+                                       _mm_cmpeq_epi8(v, _mm_set1_epi8('_'))));
+        stop = ~(unsigned)_mm_movemask_epi8(ok) & 0xFFFF;
+        if (stop)
+            return p + __builtin_ctz(stop);
+        p += 16;
+    }
+    return ident_end_scalar(p, end);
+}
+
+SSE2 static const char *digits_end_sse2(const char *p, const char *end)
+{
+    unsigned stop;
+
+    while (end - p >= 16) {
+        stop = ~(unsigned)_mm_movemask_epi8(
+                   IN_RANGE128(_mm_loadu_si128((const __m128i *)p), '0', 9)) & 0xFFFF;
+        if (stop)
+            return p + __builtin_ctz(stop);
+        p += 16;
+    }
+    return digits_end_scalar(p, end);
+}
+
+SSE2 static const char *find_quote_sse2(const char *p, const char *end)
+{
+    unsigned hit;
+
+    while (end - p >= 16) {
+        hit = (unsigned)_mm_movemask_epi8(
+                  _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)p), _mm_set1_epi8('"')));
+        if (hit)
+            return p + __builtin_ctz(hit);
+        p += 16;
+    }
+    return find_quote_scalar(p, end);
+}
+
+/* p ve p + 1'den iki yükleme: '*' maskesi ile bir sonraki byte'ın '/' maskesi */
+SSE2 static const char *find_comment_end_sse2(const char *p, const char *end)
+{
+    __m128i star, slash;
+    unsigned hit;
+
+    while (end - p >= 17) {
+        star = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)p), _mm_set1_epi8('*'));
+        slash = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(p + 1)), _mm_set1_epi8('/'));
+        hit = (unsigned)_mm_movemask_epi8(_mm_and_si128(star, slash));
+        if (hit)
+            return p + __builtin_ctz(hit);
+        p += 16;
+    }
+    return find_comment_end_scalar(p, end);
+}
+
+SSE2 static unsigned long count_nl_sse2(const char *p, const char *end)
+{
+    unsigned long n = 0;
+
+    while (end - p >= 16) {
+        n += __builtin_popcount((unsigned)_mm_movemask_epi8(
+                 _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)p), _mm_set1_epi8('\n'))));
+        p += 16;
+    }
+    return n + count_nl_scalar(p, end);
+}
+
+AVX2 static const char *skip_ws_avx2(const char *p, const char *end, unsigned long *lines)
+{
+    __m256i v, nl, ws;
+    unsigned stop, nls;
+
+    while (end - p >= 32) {
+        v = _mm256_loadu_si256((const __m256i *)p);
+        nl = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n'));
+        ws = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')),
+                                             _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\t'))), nl);
+        stop = ~(unsigned)_mm256_movemask_epi8(ws);
+        nls = (unsigned)_mm256_movemask_epi8(nl);
+        if (stop) {
+            stop = __builtin_ctz(stop);
+            *lines += __builtin_popcount(nls & ((1u << stop) - 1));
+            return p + stop;
+        }
+        *lines += __builtin_popcount(nls);
+        p += 32;
+    }
+    return skip_ws_sse2(p, end, lines);
+}
+
+AVX2 static const char *ident_end_avx2(const char *p, const char *end)
+{
+    __m256i v, ok;
+    unsigned stop;
+
+    while (end - p >= 32) {
+        v = _mm256_loadu_si256((const __m256i *)p);
+        ok = _mm256_or_si256(IN_RANGE256(_mm256_or_si256(v, _mm256_set1_epi8(0x20)), 'a', 25),
+                             _mm256_or_si256(IN_RANGE256(v, '0', 9),
+                                             _mm256_cmpeq_epi8(v, _mm256_set1_epi8('_'))));
+        stop = ~(unsigned)_mm256_movemask_epi8(ok);
+        if (stop)
+            return p + __builtin_ctz(stop);
+        p += 32;
+    }
+    return ident_end_sse2(p, end);
+}
+
+AVX2 static const char *digits_end_avx2(const char *p, const char *end)
+{
+    unsigned stop;
+
+    while (end - p >= 32) {
+        stop = ~(unsigned)_mm256_movemask_epi8(
+                   IN_RANGE256(_mm256_loadu_si256((const __m256i *)p), '0', 9));
+        if (stop)
+            return p + __builtin_ctz(stop);
+        p += 32;
+    }
+    return digits_end_sse2(p, end);
+}
+
+AVX2 static const char *find_quote_avx2(const char *p, const char *end)
+{
+    unsigned hit;
+
+    while (end - p >= 32) {
+        hit = (unsigned)_mm256_movemask_epi8(
+                  _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)p),
+                                    _mm256_set1_epi8('"')));
+        if (hit)
+            return p + __builtin_ctz(hit);
+        p += 32;
+    }
+    return find_quote_sse2(p, end);
+}
+
+AVX2 static const char *find_comment_end_avx2(const char *p, const char *end)
+{
+    __m256i star, slash;
+    unsigned hit;
+
+    while (end - p >= 33) {
+        star = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)p),
+                                 _mm256_set1_epi8('*'));
+        slash = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(p + 1)),
+                                  _mm256_set1_epi8('/'));
+        hit = (unsigned)_mm256_movemask_epi8(_mm256_and_si256(star, slash));
+        if (hit)
+            return p + __builtin_ctz(hit);
+        p += 32;
+    }
+    return find_comment_end_sse2(p, end);
+}
+
+AVX2 static unsigned long count_nl_avx2(const char *p, const char *end)
+{
+    unsigned long n = 0;
+
+    while (end - p >= 32) {
+        n += __builtin_popcount((unsigned)_mm256_movemask_epi8(
+                 _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)p),
+                                   _mm256_set1_epi8('\n'))));
+        p += 32;
+    }
+    return n + count_nl_sse2(p, end);
+}
+
+static const struct turkc_simd_kernels kernels_sse2 = {
+    TURKC_SIMD_SSE2, skip_ws_sse2, ident_end_sse2, digits_end_sse2,
+    find_quote_sse2, find_comment_end_sse2, count_nl_sse2
+};
+
+static const struct turkc_simd_kernels kernels_avx2 = {
+    TURKC_SIMD_AVX2, skip_ws_avx2, ident_end_avx2, digits_end_avx2,
+    find_quote_avx2, find_comment_end_avx2, count_nl_avx2
+};
+
+#endif
+
+/* ---- Seçim ---- */
+
+static int simd_supported(enum turkc_simd simd)
+{
+    switch (simd) {
+    case TURKC_SIMD_SCALAR:
+        return 1;
+#ifdef TURKC_HAVE_X86_SIMD
+    case TURKC_SIMD_SSE2:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("sse2");
+    case TURKC_SIMD_AVX2:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+#endif
+    default:
+        return 0;
+    }
+}
+
+enum turkc_simd turkc_simd_detect(void)
+{
+    if (simd_supported(TURKC_SIMD_AVX2))
+        return TURKC_SIMD_AVX2;
+    if (simd_supported(TURKC_SIMD_SSE2))
+        return TURKC_SIMD_SSE2;
+    return TURKC_SIMD_SCALAR;
+}
+
+const char *turkc_simd_name(enum turkc_simd simd)
+{
+    switch (simd) {
+    case TURKC_SIMD_SCALAR: return "scalar";
+    case TURKC_SIMD_SSE2:   return "sse2";
+    case TURKC_SIMD_AVX2:   return "avx2";
+    default:                return "auto";
+    }
+}
+
+int turkc_fastlex_init(struct turkc_fastlex *fl, const char *buf, size_t len,
+                       enum turkc_simd simd)
+{
+    if (simd == TURKC_SIMD_AUTO)
+        simd = turkc_simd_detect();
+    if (!simd_supported(simd))
+        return -1;
+
+    fl->buf = fl->pos = buf;
+    fl->end = buf + len;
+    fl->error = NULL;
+    fl->line = 1;
+    fl->line_start = buf;
+    fl->k = &kernels_scalar;
+#ifdef TURKC_HAVE_X86_SIMD
+    if (simd == TURKC_SIMD_SSE2)
+        fl->k = &kernels_sse2;
+    else if (simd == TURKC_SIMD_AVX2)
+        fl->k = &kernels_avx2;
+#endif
+    return 0;
+}
+
+/* ---- Lexer ---- */
+
+/* [p, end) içinde '\n' olduğu biliniyorsa son satırın başı. Geriye doğru
+ * sadece son satırın o ana kadarki kısmı taranır.
+ */
+static const char *last_line_start(const char *p, const char *end)
+{
+    while (end > p && end[-1] != '\n')
+        end--;
+    return end;
+}
+
+void turkc_fastlex_seek(struct turkc_fastlex *fl, size_t offset, unsigned long line)
+{
+    fl->pos = fl->buf + offset;
+    fl->error = NULL;
+    fl->line = line;
+    fl->line_start = last_line_start(fl->buf, fl->pos);
+}
+
+/* "==", "!=", "<=", ">=" */
+static int with_eq(const char *p, const char *end, int single, int pair, size_t *len)
+{
+    if (end - p >= 2 && p[1] == '=') {
+        *len = 2;
+        return pair;
+    }
+    *len = 1;
+    return single;
+}
+
+int turkc_fastlex_next(struct turkc_fastlex *fl, struct turkc_token *tok)
+{
+    const struct turkc_simd_kernels *k = fl->k;
+    const char *p = fl->pos, *end = fl->end, *q;
+    unsigned long line = fl->line;
+    size_t len = 1;
+    int kind;
+
+    if (fl->error)
+        return -1;
+
+    /* Whitespace ve yorumlar token üretmez */
+    for (;;) {
+        p = k->skip_ws(p, end, &fl->line);
+        if (end - p < 2 || p[0] != '/')
+            break;
+        if (p[1] == '/') {
+            q = memchr(p, '\n', end - p);
+            p = q ? q : end;
+        } else if (p[1] == '*') {
+            q = k->find_comment_end(p + 2, end);
+            if (q == end) {
+                fl->error = "kapanmamis yorum";
+                break;
+            }
+            fl->line += k->count_nl(p + 2, q);
+            p = q + 2;
+        } else {
+            break;
+        }
+    }
+
+    if (fl->line != line)
+        fl->line_start = last_line_start(fl->pos, p);
+
+    tok->text = p;
+    tok->offset = p - fl->buf;
+    tok->line = fl->line;
+    tok->column = p - fl->line_start + 1;
+    if (fl->error)
+        return -1;
+    if (p == end) {
+        fl->pos = p;
+        tok->kind = TK_EOF;
+        tok->length = 0;
+        return TK_EOF;
+    }
+
+    switch ((unsigned char)*p) {
+    case '+': kind = TK_PLUS; break;
+    case '-': kind = TK_MINUS; break;
+    case '*': kind = TK_STAR; break;
+    case '/': kind = TK_SLASH; break;
+    case '%': kind = TK_PERCENT; break;
+    case '(': kind = TK_LPAREN; break;
+    case ')': kind = TK_RPAREN; break;
+    case '{': kind = TK_LBRACE; break;
+    case '}': kind = TK_RBRACE; break;
+    case ';': kind = TK_SEMI; break;
+    case ',': kind = TK_COMMA; break;
+    case '=': kind = with_eq(p, end, TK_ASSIGN, TK_EQ, &len); break;
+    case '!': kind = with_eq(p, end, TK_UNKNOWN, TK_NE, &len); break;
+    case '<': kind = with_eq(p, end, TK_LT, TK_LE, &len); break;
+    case '>': kind = with_eq(p, end, TK_GT, TK_GE, &len); break;
+    case '"':
+        q = k->find_quote(p + 1, end);
+        if (q == end) {
+            fl->pos = p;
+            fl->error = "kapanmamis string";
+            return -1;
+        }
+        kind = TK_STRING;
+        line = k->count_nl(p + 1, q);
+        if (line) {
+            fl->line += line;
+            fl->line_start = last_line_start(p + 1, q);
+        }
+        len = q + 1 - p;
+        break;
+    default:
+        if (is_ident((unsigned char)*p)) {
+            if ((unsigned char)(*p - '0') < 10) {
+                kind = TK_NUMBER;
+                len = k->digits_end(p + 1, end) - p;
+            } else {
+                len = k->ident_end(p + 1, end) - p;
+                kind = turkc_keyword(p, len);
+            }
+        } else {
+            kind = TK_UNKNOWN;
+        }
+        break;
+    }
+
+    fl->pos = p + len;
+    tok->kind = kind;
+    tok->length = len;
+    return kind;
+}
@@ -0,0 +1,69 @@
+#ifndef TURKC_FASTLEX_H
+#define TURKC_FASTLEX_H
+
+/* Elle yazılmış TurkC lexer'ı (flex'e alternatif backend).
+ *
+ * scanner.l'deki kurallarla aynı token akışını üretir (bkz. lexdiff.c).
+ * Whitespace, identifier/sayı devamı, kapanış '"' ve yorum sonu aramaları
+ * SSE2/AVX2 ile 16/32 byte birden yapılır; hangisinin kullanılacağı
+ * çalışma zamanında CPU'ya göre seçilir. Buffer'a hiç yazmaz, bu yüzden
+ * aynı buffer birden fazla lexer tarafından aynı anda taranabilir.
+ *
+ *   struct turkc_fastlex fl;
+ *   turkc_fastlex_init(&fl, src, len, TURKC_SIMD_AUTO);
+ *   while (turkc_fastlex_next(&fl, &tok) > 0)
+ *       printf("%.*s\n", (int)tok.length, tok.text);
+ */
+
+#include <stddef.h>
+
+#include "turkc_lexer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum turkc_simd {
+    TURKC_SIMD_AUTO,            /* CPU'nun desteklediği en geniş */
+    TURKC_SIMD_SCALAR,
+    TURKC_SIMD_SSE2,
+    TURKC_SIMD_AVX2
+};
+
+struct turkc_simd_kernels;
+
+struct turkc_fastlex {
+    const char *buf, *pos, *end;
+    const char *error;          /* kapanmayan string/yorum, NULL: hata yok */
+    unsigned long line;
+    const char *line_start;
+    const struct turkc_simd_kernels *k;
+};
+
+/* İstenen backend bu CPU'da yoksa -1 döner */
+int turkc_fastlex_init(struct turkc_fastlex *fl, const char *buf, size_t len,
+                       enum turkc_simd simd);
+
+/* turkc_lexer_next gibi: kind (> 0), giriş bitince 0, kapanmayan string
+ * veya yorumda -1 (fl->error; tok'un konumu literal'in başı). tok->text
+ * buffer'ı gösterir ve NUL ile bitmez, uzunluk için tok->length kullanılmalı.
+ */
+int turkc_fastlex_next(struct turkc_fastlex *fl, struct turkc_token *tok);
+
+/* Taramayı buf + offset'ten sürdürür (artımlı tarama, turkc_relex.h).
+ * offset 0 veya bir token'ın sonu olmalı, line o ofsetin satırıdır.
+ * Önceki hata temizlenir.
+ */
+void turkc_fastlex_seek(struct turkc_fastlex *fl, size_t offset, unsigned long line);
+
+/* AUTO için çalışma zamanında seçilecek backend */
+enum turkc_simd turkc_simd_detect(void);
+
+/* "scalar", "sse2", "avx2" */
+const char *turkc_simd_name(enum turkc_simd simd);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
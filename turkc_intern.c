@@ -0,0 +1,204 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "turkc_intern.h"
+#include "turkc_token.h"
+
+#define ARENA_BLOCK (64 * 1024)
+
+struct arena_block {
+    struct arena_block *next;
+    char data[];
+};
+
+struct symbol {
+    const char *text;
+    uint32_t length;
+    uint32_t hash;
+};
+
+struct turkc_intern {
+    struct symbol *syms;        /* ID -> metin */
+    uint32_t count, cap;
+    uint32_t *slots;            /* 0: boş, diğerleri ID + 1 */
+    uint32_t mask;
+    struct arena_block *blocks;
+    char *pos, *end;            /* son bloktaki boş alan */
+    size_t bytes;
+};
+
+/* 8 byte'lık adımlarla çarpma tabanlı hash; identifier'lar kısa olduğu için
+ * çoğunlukla tek adım
+ */
+static uint32_t hash_text(const char *s, size_t len)
+{
+    uint64_t h = 0x9e3779b97f4a7c15ULL ^ len, w;
+    size_t i;
+
+    for (; len >= 8; s += 8, len -= 8) {
+        memcpy(&w, s, 8);
+        h = (h ^ w) * 0xff51afd7ed558ccdULL;
+        h ^= h >> 32;
+    }
+    for (w = 0, i = 0; i < len; i++)
+        w |= (uint64_t)(unsigned char)s[i] << (i * 8);
+    h = (h ^ w) * 0xc4ceb9fe1a85ec53ULL;
+    return (uint32_t)(h >> 32);
+}
+
+struct turkc_intern *turkc_intern_new(void)
+{
+    struct turkc_intern *t = calloc(1, sizeof(*t));
+
+    if (!t)
+        return NULL;
+    t->mask = 1023;
+    t->slots = calloc(t->mask + 1, sizeof(*t->slots));
+    if (!t->slots) {
+        free(t);
+        return NULL;
+    }
+    return t;
+}
+
+void turkc_intern_free(struct turkc_intern *t)
+{
+    struct arena_block *b, *next;
+
+    if (!t)
+        return;
+    for (b = t->blocks; b; b = next) {
+        next = b->next;
+        free(b);
+    }
+    free(t->syms);
+    free(t->slots);
+    free(t);
+}
+
+/* len + 1 byte'lık yer; blok boyundan uzun metinler kendi bloklarını alır */
+static char *arena_alloc(struct turkc_intern *t, size_t len)
+{
+    struct arena_block *b;
+    size_t size = len + 1 > ARENA_BLOCK ? len + 1 : ARENA_BLOCK;
+    char *p;
+
+    if ((size_t)(t->end - t->pos) < len + 1) {
+        b = malloc(sizeof(*b) + size);
+        if (!b)
+            return NULL;
+        b->next = t->blocks;
+        t->blocks = b;
+        t->pos = b->data;
+        t->end = b->data + size;
+    }
+    p = t->pos;
+    t->pos += len + 1;
+    return p;
+}
+
+/* Yük %50'yi geçince tablo iki katına çıkar */
+static int grow_slots(struct turkc_intern *t)
+{
+    uint32_t mask = t->mask * 2 + 1, *slots, i, j;
+
+    slots = calloc((size_t)mask + 1, sizeof(*slots));
+    if (!slots)
+        return -1;
+    for (i = 0; i < t->count; i++) {
+        for (j = t->syms[i].hash & mask; slots[j]; j = (j + 1) & mask)
+            ;
+        slots[j] = i + 1;
+    }
+    free(t->slots);
+    t->slots = slots;
+    t->mask = mask;
+    return 0;
+}
+
+uint32_t turkc_intern(struct turkc_intern *t, const char *s, size_t len)
+{
+    uint32_t h = hash_text(s, len), i, id;
+    const struct symbol *sym;
+    struct symbol *syms;
+    char *text;
+
+    for (i = h & t->mask; (id = t->slots[i]) != 0; i = (i + 1) & t->mask) {
+        sym = &t->syms[id - 1];
+        if (sym->hash == h && sym->length == len && memcmp(sym->text, s, len) == 0)
+            return id - 1;
+    }
+
+    /* Yeni sembol */
+    if (len > UINT32_MAX || t->count == TURKC_INTERN_NONE - 1)
+        return TURKC_INTERN_NONE;
+    if (t->count == t->cap) {
+        uint32_t cap = t->cap ? t->cap * 2 : 256;
+
+        syms = realloc(t->syms, (size_t)cap * sizeof(*syms));
+        if (!syms)
+            return TURKC_INTERN_NONE;
+        t->syms = syms;
+        t->cap = cap;
+    }
+    text = arena_alloc(t, len);
+    if (!text)
+        return TURKC_INTERN_NONE;
+    memcpy(text, s, len);
+    text[len] = '\0';
+
+    id = t->count++;
+    t->syms[id].text = text;
+    t->syms[id].length = (uint32_t)len;
+    t->syms[id].hash = h;
+    t->slots[i] = id + 1;
+    t->bytes += len;
+    if (t->count * 2 > t->mask && grow_slots(t) != 0) {
+        t->slots[i] = 0;
+        t->count--;
+        return TURKC_INTERN_NONE;
+    }
+    return id;
+}
+
+uint32_t turkc_intern_count(const struct turkc_intern *t)
+{
+    return t->count;
+}
+
+const char *turkc_intern_text(const struct turkc_intern *t, uint32_t id, size_t *len)
+{
+    if (id >= t->count)
+        return NULL;
+    if (len)
+        *len = t->syms[id].length;
+    return t->syms[id].text;
+}
+
+size_t turkc_intern_bytes(const struct turkc_intern *t)
+{
+    return t->bytes;
+}
+
+void turkc_intern_write(const struct turkc_intern *t, struct turkc_tokstream_writer *w)
+{
+    static const char zero[sizeof(struct turkc_token_record)];
+    size_t size = 0, pad;
+    uint32_t i, len;
+
+    for (i = 0; i < t->count; i++)
+        size += 4 + t->syms[i].length;
+    pad = (sizeof(zero) - size % sizeof(zero)) % sizeof(zero);
+
+    /* Sonlandırıcı: offset sembol sayısı, length kayıt cinsinden boy */
+    turkc_tokstream_put(w, TK_EOF, t->count, (uint32_t)((size + pad) / sizeof(zero)), 0);
+    turkc_tokstream_flush(w);
+    for (i = 0; i < t->count && !w->error; i++) {
+        len = t->syms[i].length;
+        if (fwrite(&len, 4, 1, w->out) != 1 ||
+            fwrite(t->syms[i].text, 1, len, w->out) != len)
+            w->error = 1;
+    }
+    if (pad && fwrite(zero, 1, pad, w->out) != pad)
+        w->error = 1;
+}
@@ -0,0 +1,49 @@
+#ifndef TURKC_INTERN_H
+#define TURKC_INTERN_H
+
+/* String interning: identifier ve string literal'leri küçük tamsayı
+ * ID'lere çevirir (scanner --intern).
+ *
+ * Metinler arena'da (büyük bloklar, tek tek free yok) durur; ID'ler
+ * open addressing (linear probing) bir hash tablosunda aranır. Aynı metin
+ * her zaman aynı ID'yi alır, ID'ler 0'dan başlayıp ilk görülme sırasıyla
+ * artar. Thread-safe değildir.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "turkc_tokstream.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TURKC_INTERN_NONE   UINT32_MAX      /* bellek yetersiz */
+
+struct turkc_intern;
+
+struct turkc_intern *turkc_intern_new(void);
+void turkc_intern_free(struct turkc_intern *t);
+
+/* Metnin ID'si; ilk kez görülüyorsa arena'ya kopyalanır */
+uint32_t turkc_intern(struct turkc_intern *t, const char *s, size_t len);
+
+uint32_t turkc_intern_count(const struct turkc_intern *t);
+
+/* NUL ile biter; tablo yaşadıkça geçerlidir */
+const char *turkc_intern_text(const struct turkc_intern *t, uint32_t id, size_t *len);
+
+/* Arena'daki metinlerin toplam boyu (byte) */
+size_t turkc_intern_bytes(const struct turkc_intern *t);
+
+/* Tabloyu binary token akışının sonuna yazar (bkz. turkc_tokstream.h,
+ * TURKC_TOKSTREAM_INTERNED). Son kayıttan sonra bir kez çağrılır.
+ */
+void turkc_intern_write(const struct turkc_intern *t, struct turkc_tokstream_writer *w);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
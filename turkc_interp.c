@@ -0,0 +1,260 @@
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "turkc_interp.h"
+#include "turkc_stack.h"
+#include "turkc_token.h"
+
+struct turkc_interp {
+    const struct turkc_program *prog;
+    const struct turkc_node *nodes;
+    int32_t *globals;
+    int32_t *stack, *sp, *end;  /* değer yığını; sp ilk boş slot */
+    int32_t ret;                /* dondur'un değeri */
+    uint32_t depth;             /* etkin çağrılar, ana dahil */
+    uintptr_t c_stack;          /* dış çağrıdaki C yığını adresi */
+    size_t c_limit;             /* oradan inilebilecek byte */
+    FILE *out;
+    struct turkc_parse_error *err;
+    jmp_buf fail;
+};
+
+static void fail(struct turkc_interp *in, uint32_t node, const char *fmt, ...)
+{
+    va_list ap;
+
+    if (in->err) {
+        va_start(ap, fmt);
+        vsnprintf(in->err->message, sizeof(in->err->message), fmt, ap);
+        va_end(ap);
+        in->err->offset = in->nodes[node].offset;
+        in->err->line = 0;
+        in->err->column = 0;
+    }
+    longjmp(in->fail, 1);
+}
+
+struct turkc_interp *turkc_interp_new(const struct turkc_program *prog, FILE *out)
+{
+    struct turkc_interp *in = calloc(1, sizeof(*in));
+
+    if (!in)
+        return NULL;
+    in->prog = prog;
+    in->nodes = prog->ast->nodes;
+    in->out = out;
+    in->globals = malloc((prog->nglobals ? prog->nglobals : 1) * sizeof(int32_t));
+    in->stack = malloc(TURKC_INTERP_STACK_SLOTS * sizeof(int32_t));
+    if (!in->globals || !in->stack) {
+        turkc_interp_free(in);
+        return NULL;
+    }
+    memcpy(in->globals, prog->globals, prog->nglobals * sizeof(int32_t));
+    in->sp = in->stack;
+    in->end = in->stack + TURKC_INTERP_STACK_SLOTS;
+    return in;
+}
+
+void turkc_interp_free(struct turkc_interp *in)
+{
+    if (!in)
+        return;
+    free(in->globals);
+    free(in->stack);
+    free(in);
+}
+
+static int32_t call(struct turkc_interp *in, int32_t *fp, uint32_t i);
+
+static int32_t eval(struct turkc_interp *in, int32_t *fp, uint32_t i)
+{
+    const struct turkc_node *n = &in->nodes[i], *t;
+    uint32_t j;
+    int32_t a, b;
+
+    switch (n->kind) {
+    case ND_NUMBER:
+        return (int32_t)n->a;
+    case ND_NAME:
+        return n->flags & TURKC_NF_GLOBAL ? in->globals[n->aux] : fp[n->aux];
+    case ND_ASSIGN:
+        a = eval(in, fp, n->b);
+        t = &in->nodes[n->a];
+        if (t->flags & TURKC_NF_GLOBAL)
+            in->globals[t->aux] = a;
+        else
+            fp[t->aux] = a;
+        return a;
+    case ND_BINARY:
+        /* sola bağlı zincir döngüyle: dipten aux ile i'ye çıkılır */
+        j = turkc_chain_bottom(in->nodes, i);
+        a = eval(in, fp, in->nodes[j].a);
+        for (;;) {
+            n = &in->nodes[j];
+            b = eval(in, fp, n->b);
+            if (b == 0 && (n->op == TK_SLASH || n->op == TK_PERCENT))
+                fail(in, j, "sifira bolme");
+            a = turkc_binop(n->op, a, b);
+            if (j == i)
+                return a;
+            j = n->aux;
+        }
+    case ND_NEG:
+        return (int32_t)(0u - (uint32_t)eval(in, fp, n->a));
+    case ND_CALL:
+        return call(in, fp, i);
+    }
+    fail(in, i, "beklenmeyen dugum %s", turkc_node_name(n->kind));
+    return 0;
+}
+
+/* dondur çalıştıysa 1 */
+static int exec(struct turkc_interp *in, int32_t *fp, uint32_t i)
+{
+    const struct turkc_node *n = &in->nodes[i];
+    uint32_t s;
+
+    switch (n->kind) {
+    case ND_NONE:               /* boş deyim: eger (x) ; */
+        return 0;
+    case ND_BLOCK:
+        for (s = n->a; s; s = in->nodes[s].next) {
+            if (exec(in, fp, s))
+                return 1;
+        }
+        return 0;
+    case ND_VAR:
+        fp[n->aux] = n->a ? eval(in, fp, n->a) : 0;
+        return 0;
+    case ND_IF:
+        if (eval(in, fp, n->a))
+            return exec(in, fp, n->b);
+        return n->c ? exec(in, fp, n->c) : 0;
+    case ND_WHILE:
+        while (eval(in, fp, n->a)) {
+            if (exec(in, fp, n->b))
+                return 1;
+        }
+        return 0;
+    case ND_FOR:
+        if (n->a)
+            exec(in, fp, n->a);
+        while (!n->b || eval(in, fp, n->b)) {
+            if (exec(in, fp, n->d))
+                return 1;
+            if (n->c)
+                eval(in, fp, n->c);
+        }
+        return 0;
+    case ND_RETURN:
+        in->ret = n->a ? eval(in, fp, n->a) : 0;
+        return 1;
+    case ND_EXPR:
+        eval(in, fp, n->a);
+        return 0;
+    }
+    fail(in, i, "beklenmeyen dugum %s", turkc_node_name(n->kind));
+    return 0;
+}
+
+static void yaz(struct turkc_interp *in, int32_t *fp, uint32_t arg)
+{
+    const struct turkc_node *n = &in->nodes[arg];
+    const char *text;
+    size_t len;
+
+    if (n->kind == ND_STRING) {
+        text = turkc_intern_text(in->prog->ast->syms, n->a, &len);
+        fwrite(text + 1, 1, len - 2, in->out);      /* tırnaklar hariç */
+        fputc('\n', in->out);
+    } else {
+        fprintf(in->out, "%ld\n", (long)eval(in, fp, arg));
+    }
+}
+
+/* Argümanlar çağıranın çerçevesinde (fp) soldan sağa hesaplanıp yeni
+ * çerçevenin ilk slotlarına yazılır. Çerçeve önce ayrılır ki argümandaki
+ * çağrılar onun üstüne kursun.
+ */
+static int32_t call(struct turkc_interp *in, int32_t *fp, uint32_t i)
+{
+    const struct turkc_node *n = &in->nodes[i];
+    const struct turkc_function *f;
+    int32_t *frame = in->sp;
+    uintptr_t here = (uintptr_t)&frame;
+    uint32_t arg, k = 0;
+
+    if (n->aux == TURKC_FUNC_YAZ) {
+        yaz(in, fp, n->b);
+        return 0;
+    }
+    f = &in->prog->funcs[n->aux];
+    if ((uintptr_t)(in->end - frame) < f->nslots)
+        fail(in, i, "yigin tasmasi");
+    /* C yığını sınırı yalnız çok derin ifadeli özyinelemede önce dolar */
+    if (in->depth >= TURKC_MAX_CALL_DEPTH ||
+        (here < in->c_stack ? in->c_stack - here : here - in->c_stack) > in->c_limit)
+        fail(in, i, "cok derin ozyineleme");
+    in->sp = frame + f->nslots;
+    for (arg = n->b; arg; arg = in->nodes[arg].next)
+        frame[k++] = eval(in, fp, arg);
+    in->depth++;
+    in->ret = 0;
+    exec(in, frame, in->nodes[f->node].b);
+    in->depth--;
+    in->sp = frame;
+    return in->ret;
+}
+
+struct interp_call {
+    struct turkc_interp *in;
+    uint32_t func;
+    const int32_t *args;
+    int32_t result;
+    int rc;
+};
+
+/* turkc_stack_run'ın açtığı yığında */
+static void interp_main(void *arg, size_t limit)
+{
+    struct interp_call *c = arg;
+    struct turkc_interp *in = c->in;
+    const struct turkc_function *f = &in->prog->funcs[c->func];
+    int32_t *frame = in->sp;
+
+    in->c_stack = (uintptr_t)&frame;
+    in->c_limit = limit;
+    in->depth = 1;
+    c->rc = -1;
+    if (setjmp(in->fail)) {
+        in->sp = in->stack;
+        return;
+    }
+    if ((uintptr_t)(in->end - frame) < f->nslots)
+        fail(in, f->node, "yigin tasmasi");
+    if (f->nparams)
+        memcpy(frame, c->args, f->nparams * sizeof(int32_t));
+    in->sp = frame + f->nslots;
+    in->ret = 0;
+    exec(in, frame, in->nodes[f->node].b);
+    in->sp = frame;
+    c->result = in->ret;
+    c->rc = 0;
+}
+
+int turkc_interp_call(struct turkc_interp *in, uint32_t func, const int32_t *args,
+                      int32_t *result, struct turkc_parse_error *err)
+{
+    struct interp_call c;
+
+    c.in = in;
+    c.func = func;
+    c.args = args;
+    in->err = err;
+    turkc_stack_run(interp_main, &c);
+    if (c.rc == 0 && result)
+        *result = c.result;
+    return c.rc;
+}
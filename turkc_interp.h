@@ -0,0 +1,48 @@
+#ifndef TURKC_INTERP_H
+#define TURKC_INTERP_H
+
+/* Ağaç üzerinde çalışan TurkC yorumlayıcısı.
+ *
+ * Çözümlenmiş ağacı (turkc_resolve.h) doğrudan dolaşır: değişkenler
+ * çerçevedeki slot indeksiyle, çağrılar fonksiyon indeksiyle bulunur,
+ * çalışırken isim aranmaz. Diğer motorların anlam referansıdır; aynı
+ * programda aynı çıktıyı ve dönüş değerini vermeleri gerekir.
+ *
+ * Yerel değişkenler tek bir değer yığınındaki çerçevelerde durur. Çağrı
+ * C yığınında özyinelemedir; turkc_interp_call ayrı bir yığında çalışır
+ * ve derinlik diğer motorlardaki gibi TURKC_MAX_CALL_DEPTH çağrıyla
+ * sınırlıdır (turkc_stack.h), aşılırsa çalışma hatası verilir.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "turkc_parse.h"
+#include "turkc_resolve.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TURKC_INTERP_STACK_SLOTS    (1u << 20)      /* değer yığını, 4 MB */
+
+struct turkc_interp;
+
+/* Globaller prog'daki ilk değerlerle başlar ve çağrılar arasında korunur.
+ * yaz() çıktısı out'a gider. Bellek yetersizse NULL.
+ */
+struct turkc_interp *turkc_interp_new(const struct turkc_program *prog, FILE *out);
+void turkc_interp_free(struct turkc_interp *in);
+
+/* prog->funcs[func]'ı args ile çağırır (nparams tane). int fonksiyonun
+ * değeri *result'a yazılır (void'de 0). Başarıda 0; çalışma hatasında -1
+ * ve err'de message ve offset (satır/sütun için turkc_parse_locate).
+ */
+int turkc_interp_call(struct turkc_interp *in, uint32_t func, const int32_t *args,
+                      int32_t *result, struct turkc_parse_error *err);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,1515 @@
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "turkc_ir.h"
+#include "turkc_stack.h"
+#include "turkc_token.h"
+
+/* IR_ADD...IR_GE için turkc_binop'un token'ı */
+static const uint8_t binop_token[] = {
+    TK_PLUS, TK_MINUS, TK_STAR, TK_SLASH, TK_PERCENT,
+    TK_EQ, TK_NE, TK_LT, TK_GT, TK_LE, TK_GE
+};
+
+static const char *const op_names[IR_OP_COUNT] = {
+    "nop", "const", "param", "phi",
+    "add", "sub", "mul", "div", "mod",
+    "eq", "ne", "lt", "gt", "le", "ge",
+    "neg", "loadg", "storeg", "call", "yaz", "yazs",
+    "jmp", "br", "ret"
+};
+
+const char *turkc_ir_op_name(int op)
+{
+    return op >= 0 && op < IR_OP_COUNT ? op_names[op] : "?";
+}
+
+static int grow(void **p, uint32_t *cap, uint32_t need, size_t size)
+{
+    uint32_t n = *cap ? *cap : 16;
+    void *q;
+
+    if (need <= *cap)
+        return 0;
+    while (n < need) {
+        if (n > UINT32_MAX / 2)
+            return -1;
+        n *= 2;
+    }
+    q = realloc(*p, (size_t)n * size);
+    if (!q)
+        return -1;
+    *p = q;
+    *cap = n;
+    return 0;
+}
+
+/* Düzenleme */
+
+uint32_t turkc_ir_block_new(struct turkc_ir_func *f)
+{
+    uint32_t b;
+
+    if (f->oom || grow((void **)&f->blocks, &f->blocks_cap, f->nblocks + 1, sizeof(*f->blocks)) != 0) {
+        f->oom = 1;
+        return 0;
+    }
+    b = f->nblocks++;
+    memset(&f->blocks[b], 0, sizeof(f->blocks[b]));
+    return b;
+}
+
+/* n boş işlenen; n == 0 ise 0 */
+static uint32_t alloc_uses(struct turkc_ir_func *f, uint32_t n)
+{
+    uint32_t u;
+
+    if (n == 0 || f->oom)
+        return 0;
+    if (f->nuses > UINT32_MAX - n ||
+        grow((void **)&f->uses, &f->uses_cap, f->nuses + n, sizeof(*f->uses)) != 0) {
+        f->oom = 1;
+        return 0;
+    }
+    u = f->nuses;
+    memset(&f->uses[u], 0, n * sizeof(*f->uses));
+    f->nuses += n;
+    return u;
+}
+
+static void unlink_use(struct turkc_ir_func *f, uint32_t u)
+{
+    struct turkc_ir_use *p = &f->uses[u];
+
+    if (!p->value)
+        return;
+    if (p->prev)
+        f->uses[p->prev].next = p->next;
+    else
+        f->insns[p->value].uses = p->next;
+    if (p->next)
+        f->uses[p->next].prev = p->prev;
+    p->value = p->prev = p->next = 0;
+}
+
+static void link_use(struct turkc_ir_func *f, uint32_t u, uint32_t value)
+{
+    struct turkc_ir_use *p = &f->uses[u];
+
+    p->value = value;
+    p->prev = 0;
+    p->next = 0;
+    if (!value)
+        return;
+    p->next = f->insns[value].uses;
+    if (p->next)
+        f->uses[p->next].prev = u;
+    f->insns[value].uses = u;
+}
+
+static void place(struct turkc_ir_func *f, uint32_t i, uint32_t block, uint32_t before)
+{
+    struct turkc_ir_block *b = &f->blocks[block];
+    struct turkc_ir_insn *in = &f->insns[i];
+
+    in->block = block;
+    in->next = before;
+    in->prev = before ? f->insns[before].prev : b->last;
+    if (in->prev)
+        f->insns[in->prev].next = i;
+    else
+        b->first = i;
+    if (before)
+        f->insns[before].prev = i;
+    else
+        b->last = i;
+}
+
+static void unplace(struct turkc_ir_func *f, uint32_t i)
+{
+    struct turkc_ir_insn *in = &f->insns[i];
+    struct turkc_ir_block *b = &f->blocks[in->block];
+
+    if (in->prev)
+        f->insns[in->prev].next = in->next;
+    else
+        b->first = in->next;
+    if (in->next)
+        f->insns[in->next].prev = in->prev;
+    else
+        b->last = in->prev;
+    in->prev = in->next = 0;
+}
+
+uint32_t turkc_ir_insert(struct turkc_ir_func *f, uint32_t block, uint32_t before,
+                         int op, int32_t k, uint32_t nargs)
+{
+    struct turkc_ir_insn *in;
+    uint32_t i, a, u;
+
+    if (f->oom || grow((void **)&f->insns, &f->insns_cap, f->ninsns + 1, sizeof(*f->insns)) != 0) {
+        f->oom = 1;
+        return 0;
+    }
+    a = alloc_uses(f, nargs);
+    if (f->oom)
+        return 0;
+    i = f->ninsns++;
+    in = &f->insns[i];
+    memset(in, 0, sizeof(*in));
+    in->op = (uint8_t)op;
+    in->k = k;
+    in->args = a;
+    in->nargs = nargs;
+    for (u = a; u < a + nargs; u++)
+        f->uses[u].user = i;
+    place(f, i, block, before);
+    return i;
+}
+
+void turkc_ir_move(struct turkc_ir_func *f, uint32_t insn, uint32_t block, uint32_t before)
+{
+    unplace(f, insn);
+    place(f, insn, block, before);
+}
+
+void turkc_ir_set_arg(struct turkc_ir_func *f, uint32_t insn, uint32_t i, uint32_t value)
+{
+    uint32_t u = f->insns[insn].args + i;
+
+    unlink_use(f, u);
+    link_use(f, u, value);
+}
+
+void turkc_ir_phi_add(struct turkc_ir_func *f, uint32_t phi, uint32_t from, uint32_t value)
+{
+    uint32_t a = f->insns[phi].args, n = f->insns[phi].nargs, na, i, v;
+
+    if (n && a + n == f->nuses) {
+        if (!alloc_uses(f, 1))
+            return;
+    } else {
+        /* aralık dizinin sonunda değil: sona taşınır */
+        na = alloc_uses(f, n + 1);
+        if (!na)
+            return;
+        for (i = 0; i < n; i++) {
+            v = f->uses[a + i].value;
+            f->uses[na + i].user = phi;
+            f->uses[na + i].block = f->uses[a + i].block;
+            unlink_use(f, a + i);
+            link_use(f, na + i, v);
+        }
+        f->insns[phi].args = a = na;
+    }
+    f->uses[a + n].user = phi;
+    f->uses[a + n].block = from;
+    link_use(f, a + n, value);
+    f->insns[phi].nargs = n + 1;
+}
+
+void turkc_ir_phi_drop(struct turkc_ir_func *f, uint32_t phi, uint32_t from)
+{
+    uint32_t a = f->insns[phi].args, n = f->insns[phi].nargs, i;
+
+    for (i = 0; i < n && f->uses[a + i].block != from; i++)
+        ;
+    if (i == n)
+        return;
+    for (; i + 1 < n; i++) {
+        turkc_ir_set_arg(f, phi, i, f->uses[a + i + 1].value);
+        f->uses[a + i].block = f->uses[a + i + 1].block;
+    }
+    unlink_use(f, a + n - 1);
+    f->uses[a + n - 1].block = 0;
+    f->insns[phi].nargs = n - 1;
+}
+
+uint32_t turkc_ir_phi_value(const struct turkc_ir_func *f, uint32_t phi, uint32_t from)
+{
+    uint32_t a = f->insns[phi].args, i;
+
+    for (i = 0; i < f->insns[phi].nargs; i++) {
+        if (f->uses[a + i].block == from)
+            return f->uses[a + i].value;
+    }
+    return 0;
+}
+
+void turkc_ir_replace(struct turkc_ir_func *f, uint32_t old, uint32_t new_)
+{
+    uint32_t u;
+
+    if (old == new_)
+        return;
+    while ((u = f->insns[old].uses) != 0) {
+        unlink_use(f, u);
+        link_use(f, u, new_);
+    }
+}
+
+void turkc_ir_remove(struct turkc_ir_func *f, uint32_t insn)
+{
+    struct turkc_ir_insn *in = &f->insns[insn];
+    uint32_t u;
+
+    for (u = in->args; u < in->args + in->nargs; u++)
+        unlink_use(f, u);
+    unplace(f, insn);
+    in = &f->insns[insn];
+    in->op = IR_NOP;
+    in->nargs = 0;
+    in->block = 0;
+}
+
+void turkc_ir_block_remove(struct turkc_ir_func *f, uint32_t block)
+{
+    struct turkc_ir_block *b = &f->blocks[block];
+    uint32_t s, i, u;
+
+    for (s = 0; s < 2; s++) {
+        if (!b->succ[s])
+            continue;
+        for (i = f->blocks[b->succ[s]].first; i && f->insns[i].op == IR_PHI; i = f->insns[i].next)
+            turkc_ir_phi_drop(f, i, block);
+    }
+    for (i = b->first; i; i = f->insns[i].next) {
+        for (u = f->insns[i].args; u < f->insns[i].args + f->insns[i].nargs; u++)
+            unlink_use(f, u);
+    }
+    /* kalan kullanıcılar da ölü koddadır */
+    while ((i = b->first) != 0) {
+        while (f->insns[i].uses)
+            unlink_use(f, f->insns[i].uses);
+        turkc_ir_remove(f, i);
+    }
+    b->succ[0] = b->succ[1] = 0;
+    b->dead = 1;
+}
+
+uint32_t turkc_ir_use_count(const struct turkc_ir_func *f, uint32_t value)
+{
+    uint32_t u, n = 0;
+
+    for (u = f->insns[value].uses; u; u = f->uses[u].next)
+        n++;
+    return n;
+}
+
+uint32_t turkc_ir_count(const struct turkc_ir_func *f)
+{
+    uint32_t b, i, n = 0;
+
+    for (b = 1; b < f->nblocks; b++) {
+        for (i = f->blocks[b].first; i; i = f->insns[i].next)
+            n++;
+    }
+    return n;
+}
+
+int turkc_ir_is_void(int op)
+{
+    switch (op) {
+    case IR_NOP:
+    case IR_STOREG:
+    case IR_YAZ:
+    case IR_YAZS:
+    case IR_JMP:
+    case IR_BR:
+    case IR_RET:
+        return 1;
+    }
+    return 0;
+}
+
+int turkc_ir_has_effect(const struct turkc_ir_func *f, uint32_t insn)
+{
+    const struct turkc_ir_insn *in = &f->insns[insn], *d;
+
+    switch (in->op) {
+    case IR_STOREG:
+    case IR_CALL:
+    case IR_YAZ:
+    case IR_YAZS:
+    case IR_JMP:
+    case IR_BR:
+    case IR_RET:
+        return 1;
+    case IR_DIV:
+    case IR_MOD:
+        /* sabit ve sıfır olmayan bölen hata veremez */
+        d = &f->insns[f->uses[in->args + 1].value];
+        return d->op != IR_CONST || d->k == 0;
+    }
+    return 0;
+}
+
+/* Analizler */
+
+void turkc_ir_cfg(struct turkc_ir_func *f)
+{
+    struct turkc_ir_block *b;
+    uint32_t i, s, total = 0;
+
+    for (i = 1; i < f->nblocks; i++)
+        f->blocks[i].npreds = 0;
+    for (i = 1; i < f->nblocks; i++) {
+        b = &f->blocks[i];
+        for (s = 0; s < 2 && !b->dead; s++) {
+            if (b->succ[s])
+                f->blocks[b->succ[s]].npreds++;
+        }
+    }
+    for (i = 1; i < f->nblocks; i++) {
+        f->blocks[i].preds = total;
+        total += f->blocks[i].npreds;
+        f->blocks[i].npreds = 0;
+    }
+    if (grow((void **)&f->preds, &f->preds_cap, total ? total : 1, sizeof(*f->preds)) != 0) {
+        f->oom = 1;
+        return;
+    }
+    f->npreds = total;
+    for (i = 1; i < f->nblocks; i++) {
+        b = &f->blocks[i];
+        for (s = 0; s < 2 && !b->dead; s++) {
+            if (b->succ[s]) {
+                struct turkc_ir_block *t = &f->blocks[b->succ[s]];
+
+                f->preds[t->preds + t->npreds++] = i;
+            }
+        }
+    }
+}
+
+/* order ve rpo: girişten derinlik öncelikli arama, yığınla */
+static void number(struct turkc_ir_func *f)
+{
+    uint32_t *stack, *next, sp = 0, b, s, n = 0, i;
+
+    f->norder = 0;
+    for (b = 1; b < f->nblocks; b++)
+        f->blocks[b].rpo = 0;
+    stack = malloc(f->nblocks * sizeof(*stack));
+    next = calloc(f->nblocks, sizeof(*next));
+    free(f->order);
+    f->order = malloc(f->nblocks * sizeof(*f->order));
+    if (!stack || !next || !f->order) {
+        free(stack);
+        free(next);
+        f->oom = 1;
+        return;
+    }
+    /* rpo önce "görüldü" işareti, sonra sıra numarası */
+    stack[sp++] = 1;
+    f->blocks[1].rpo = 1;
+    while (sp) {
+        b = stack[sp - 1];
+        if (next[b] < 2) {
+            s = f->blocks[b].succ[next[b]++];
+            if (s && !f->blocks[s].rpo) {
+                f->blocks[s].rpo = 1;
+                stack[sp++] = s;
+            }
+            continue;
+        }
+        f->order[n++] = b;      /* sonradan sıra */
+        sp--;
+    }
+    for (i = 0; i < n / 2; i++) {
+        b = f->order[i];
+        f->order[i] = f->order[n - 1 - i];
+        f->order[n - 1 - i] = b;
+    }
+    for (i = 0; i < n; i++)
+        f->blocks[f->order[i]].rpo = i + 1;
+    f->norder = n;
+    free(stack);
+    free(next);
+}
+
+int turkc_ir_prune(struct turkc_ir_func *f)
+{
+    uint32_t b;
+    int changed = 0;
+
+    number(f);
+    if (f->oom)
+        return 0;
+    for (b = 1; b < f->nblocks; b++) {
+        if (!f->blocks[b].dead && !f->blocks[b].rpo) {
+            turkc_ir_block_remove(f, b);
+            changed = 1;
+        }
+    }
+    turkc_ir_cfg(f);
+    return changed;
+}
+
+static uint32_t intersect(const struct turkc_ir_block *bl, uint32_t a, uint32_t b)
+{
+    while (a != b) {
+        while (bl[a].rpo > bl[b].rpo)
+            a = bl[a].idom;
+        while (bl[b].rpo > bl[a].rpo)
+            b = bl[b].idom;
+    }
+    return a;
+}
+
+/* Cooper, Harvey, Kennedy: "A Simple, Fast Dominance Algorithm" */
+void turkc_ir_dominators(struct turkc_ir_func *f)
+{
+    struct turkc_ir_block *bl;
+    uint32_t *child, *sib, *stack, i, j, b, p, d, sp = 0, clock = 0;
+    int changed = 1;
+
+    number(f);
+    if (f->oom)
+        return;
+    bl = f->blocks;
+    for (b = 1; b < f->nblocks; b++)
+        bl[b].idom = bl[b].dpre = bl[b].dpost = 0;
+    bl[1].idom = 1;
+    while (changed) {
+        changed = 0;
+        for (i = 1; i < f->norder; i++) {
+            b = f->order[i];
+            d = 0;
+            for (j = 0; j < bl[b].npreds; j++) {
+                p = f->preds[bl[b].preds + j];
+                if (!bl[p].rpo || !bl[p].idom)
+                    continue;
+                d = d ? intersect(bl, p, d) : p;
+            }
+            if (bl[b].idom != d) {
+                bl[b].idom = d;
+                changed = 1;
+            }
+        }
+    }
+    bl[1].idom = 0;
+
+    /* ağaçta giriş/çıkış sırası: dominates sabit zamanda */
+    child = calloc(f->nblocks, sizeof(*child));
+    sib = calloc(f->nblocks, sizeof(*sib));
+    stack = malloc(f->nblocks * sizeof(*stack));
+    if (!child || !sib || !stack) {
+        f->oom = 1;
+    } else {
+        for (i = f->norder; i-- > 1;) {
+            b = f->order[i];
+            sib[b] = child[bl[b].idom];
+            child[bl[b].idom] = b;
+        }
+        stack[sp++] = 1;
+        bl[1].dpre = ++clock;
+        while (sp) {
+            b = stack[sp - 1];
+            if (child[b]) {
+                d = child[b];
+                child[b] = sib[d];
+                bl[d].dpre = ++clock;
+                stack[sp++] = d;
+            } else {
+                bl[b].dpost = ++clock;
+                sp--;
+            }
+        }
+    }
+    free(child);
+    free(sib);
+    free(stack);
+}
+
+int turkc_ir_dominates(const struct turkc_ir_func *f, uint32_t a, uint32_t b)
+{
+    const struct turkc_ir_block *x = &f->blocks[a], *y = &f->blocks[b];
+
+    if (a == b)
+        return 1;
+    return x->dpre && y->dpre && x->dpre < y->dpre && y->dpost < x->dpost;
+}
+
+/* Kurulum: Braun ve ark. Bir blok, tüm öncülleri belli olunca "mühürlenir";
+ * mühürlenmemiş blokta okunan değişken için işlenensiz phi konur
+ * (insn.mark = 1) ve işlenenleri mühürlenince eklenir.
+ */
+
+struct build {
+    struct turkc_ir_func *f;
+    const struct turkc_program *prog;
+    const struct turkc_node *nodes;
+    uint32_t nslots;
+    uint32_t cur;               /* komutların eklendiği blok */
+    uint32_t zero;              /* ilk değeri olmayan okumalar için 0 */
+
+    /* (blok, slot) -> değer, açık adresleme */
+    uint64_t *keys;
+    uint32_t *vals;
+    uint32_t hcap, hcount;
+
+    /* blok başına: mühür ve gelen kenar listesi */
+    uint8_t *sealed;
+    uint32_t *edges;
+    uint32_t bcap;
+    uint32_t *efrom, *enext;
+    uint32_t nedges, ecap;
+
+    /* silinen phi -> yerine geçen değer */
+    uint32_t *fwd;
+    uint32_t fcap;
+
+    /* çağrı argümanları */
+    uint32_t *args;
+    uint32_t nargs, acap;
+};
+
+static uint32_t hash_slot(uint64_t key, uint32_t cap)
+{
+    key *= 0x9e3779b97f4a7c15ull;
+    return (uint32_t)(key >> 32) & (cap - 1);
+}
+
+static void write_var(struct build *bd, uint32_t block, uint32_t slot, uint32_t value)
+{
+    uint64_t key = (uint64_t)block << 32 | slot, *nk;
+    uint32_t h, i, cap, *nv;
+
+    if (bd->f->oom)
+        return;
+    if ((bd->hcount + 1) * 2 > bd->hcap) {
+        cap = bd->hcap ? bd->hcap * 2 : 1024;
+        nk = calloc(cap, sizeof(*nk));
+        nv = malloc(cap * sizeof(*nv));
+        if (!nk || !nv) {
+            free(nk);
+            free(nv);
+            bd->f->oom = 1;
+            return;
+        }
+        for (i = 0; i < bd->hcap; i++) {
+            if (!bd->keys[i])
+                continue;
+            for (h = hash_slot(bd->keys[i], cap); nk[h]; h = (h + 1) & (cap - 1))
+                ;
+            nk[h] = bd->keys[i];
+            nv[h] = bd->vals[i];
+        }
+        free(bd->keys);
+        free(bd->vals);
+        bd->keys = nk;
+        bd->vals = nv;
+        bd->hcap = cap;
+    }
+    for (h = hash_slot(key, bd->hcap); bd->keys[h] && bd->keys[h] != key; h = (h + 1) & (bd->hcap - 1))
+        ;
+    if (!bd->keys[h]) {
+        bd->keys[h] = key;
+        bd->hcount++;
+    }
+    bd->vals[h] = value;
+}
+
+static uint32_t lookup_var(struct build *bd, uint32_t block, uint32_t slot)
+{
+    uint64_t key = (uint64_t)block << 32 | slot;
+    uint32_t h, v;
+
+    if (!bd->hcap)
+        return 0;
+    for (h = hash_slot(key, bd->hcap); bd->keys[h]; h = (h + 1) & (bd->hcap - 1)) {
+        if (bd->keys[h] == key) {
+            v = bd->vals[h];
+            while (v && bd->f->insns[v].op == IR_NOP)
+                v = bd->fwd[v];
+            return v;
+        }
+    }
+    return 0;
+}
+
+static uint32_t new_block(struct build *bd)
+{
+    uint32_t b = turkc_ir_block_new(bd->f), cap = bd->bcap;
+
+    if (!b)
+        return 0;
+    if (grow((void **)&bd->edges, &cap, b + 1, sizeof(*bd->edges)) != 0 ||
+        grow((void **)&bd->sealed, &bd->bcap, b + 1, sizeof(*bd->sealed)) != 0) {
+        bd->f->oom = 1;
+        return 0;
+    }
+    bd->edges[b] = 0;
+    bd->sealed[b] = 0;
+    return b;
+}
+
+static void add_edge(struct build *bd, uint32_t from, uint32_t to)
+{
+    uint32_t cap = bd->ecap, *e;
+
+    if (grow((void **)&bd->efrom, &cap, bd->nedges + 2, sizeof(*bd->efrom)) != 0 ||
+        grow((void **)&bd->enext, &bd->ecap, bd->nedges + 2, sizeof(*bd->enext)) != 0) {
+        bd->f->oom = 1;
+        return;
+    }
+    if (!bd->nedges)
+        bd->nedges = 1;
+    bd->efrom[bd->nedges] = from;
+    bd->enext[bd->nedges] = 0;
+    /* sona: phi işlenenleri kenarların sırasıyla */
+    for (e = &bd->edges[to]; *e; e = &bd->enext[*e])
+        ;
+    *e = bd->nedges++;
+}
+
+static uint32_t emit(struct build *bd, int op, int32_t k, uint32_t nargs, uint32_t node)
+{
+    uint32_t i = turkc_ir_insert(bd->f, bd->cur, 0, op, k, nargs);
+
+    if (i)
+        bd->f->insns[i].node = node;
+    return i;
+}
+
+static uint32_t zero(struct build *bd)
+{
+    if (!bd->zero)
+        bd->zero = turkc_ir_insert(bd->f, 1, bd->f->blocks[1].first, IR_CONST, 0, 0);
+    return bd->zero;
+}
+
+static uint32_t read_var(struct build *bd, uint32_t block, uint32_t slot);
+
+/* Tüm işlenenleri aynı (veya kendisi) olan phi yerine o değer konur */
+static uint32_t try_remove_trivial(struct build *bd, uint32_t phi)
+{
+    struct turkc_ir_func *f = bd->f;
+    uint32_t same = 0, v, i, u, n = 0, *users = NULL, cap = 0;
+
+    for (i = 0; i < f->insns[phi].nargs; i++) {
+        v = f->uses[f->insns[phi].args + i].value;
+        if (v == same || v == phi)
+            continue;
+        if (same)
+            return phi;
+        same = v;
+    }
+    if (!same)
+        same = zero(bd);
+    if (f->oom || grow((void **)&bd->fwd, &bd->fcap, f->ninsns, sizeof(*bd->fwd)) != 0) {
+        f->oom = 1;
+        return same;
+    }
+    for (u = f->insns[phi].uses; u; u = f->uses[u].next) {
+        i = f->uses[u].user;
+        if (i != phi && f->insns[i].op == IR_PHI) {
+            if (grow((void **)&users, &cap, n + 1, sizeof(*users)) != 0) {
+                f->oom = 1;
+                break;
+            }
+            users[n++] = i;
+        }
+    }
+    for (i = 0; i < f->insns[phi].nargs; i++)
+        turkc_ir_set_arg(f, phi, i, 0);
+    turkc_ir_replace(f, phi, same);
+    turkc_ir_remove(f, phi);
+    bd->fwd[phi] = same;
+    for (i = 0; i < n; i++) {
+        if (f->insns[users[i]].op == IR_PHI && !f->insns[users[i]].mark)
+            try_remove_trivial(bd, users[i]);
+    }
+    free(users);
+    while (f->insns[same].op == IR_NOP)
+        same = bd->fwd[same];
+    return same;
+}
+
+static uint32_t add_operands(struct build *bd, uint32_t phi, uint32_t slot)
+{
+    uint32_t block = bd->f->insns[phi].block, e, v;
+
+    for (e = bd->edges[block]; e && !bd->f->oom; e = bd->enext[e]) {
+        v = read_var(bd, bd->efrom[e], slot);
+        turkc_ir_phi_add(bd->f, phi, bd->efrom[e], v);
+    }
+    return bd->f->oom ? phi : try_remove_trivial(bd, phi);
+}
+
+static uint32_t read_var(struct build *bd, uint32_t block, uint32_t slot)
+{
+    struct turkc_ir_func *f = bd->f;
+    uint32_t v = lookup_var(bd, block, slot), e;
+
+    if (v || f->oom)
+        return v;
+    e = bd->edges[block];
+    if (!bd->sealed[block]) {
+        v = turkc_ir_insert(f, block, f->blocks[block].first, IR_PHI, (int32_t)slot, 0);
+        if (v)
+            f->insns[v].mark = 1;
+    } else if (!e) {
+        v = zero(bd);           /* giriş veya ulaşılamaz blok */
+    } else if (!bd->enext[e]) {
+        v = read_var(bd, bd->efrom[e], slot);
+    } else {
+        v = turkc_ir_insert(f, block, f->blocks[block].first, IR_PHI, (int32_t)slot, 0);
+        write_var(bd, block, slot, v);
+        if (v)
+            v = add_operands(bd, v, slot);
+    }
+    write_var(bd, block, slot, v);
+    return v;
+}
+
+static void seal(struct build *bd, uint32_t block)
+{
+    struct turkc_ir_func *f = bd->f;
+    uint32_t i, n = 0, *phis = NULL, cap = 0;
+
+    for (i = f->blocks[block].first; i && f->insns[i].op == IR_PHI; i = f->insns[i].next) {
+        if (!f->insns[i].mark)
+            continue;
+        if (grow((void **)&phis, &cap, n + 1, sizeof(*phis)) != 0) {
+            f->oom = 1;
+            break;
+        }
+        phis[n++] = i;
+    }
+    for (i = 0; i < n && !f->oom; i++) {
+        if (f->insns[phis[i]].op == IR_PHI) {
+            f->insns[phis[i]].mark = 0;
+            add_operands(bd, phis[i], (uint32_t)f->insns[phis[i]].k);
+        }
+    }
+    free(phis);
+    bd->sealed[block] = 1;
+}
+
+static void jump(struct build *bd, uint32_t target)
+{
+    if (!emit(bd, IR_JMP, 0, 0, 0))
+        return;
+    bd->f->blocks[bd->cur].succ[0] = target;
+    add_edge(bd, bd->cur, target);
+}
+
+static void branch(struct build *bd, uint32_t cond, uint32_t t, uint32_t e)
+{
+    uint32_t i = emit(bd, IR_BR, 0, 1, 0);
+
+    if (!i)
+        return;
+    turkc_ir_set_arg(bd->f, i, 0, cond);
+    bd->f->blocks[bd->cur].succ[0] = t;
+    bd->f->blocks[bd->cur].succ[1] = e;
+    add_edge(bd, bd->cur, t);
+    add_edge(bd, bd->cur, e);
+}
+
+static uint32_t expr(struct build *bd, uint32_t i)
+{
+    const struct turkc_node *n = &bd->nodes[i], *t;
+    uint32_t a, b, v, arg, base, k, j;
+
+    if (bd->f->oom)
+        return 0;
+    switch (n->kind) {
+    case ND_NUMBER:
+        return emit(bd, IR_CONST, (int32_t)n->a, 0, i);
+    case ND_NAME:
+        if (n->flags & TURKC_NF_GLOBAL)
+            return emit(bd, IR_LOADG, (int32_t)n->aux, 0, i);
+        return read_var(bd, bd->cur, n->aux);
+    case ND_ASSIGN:
+        v = expr(bd, n->b);
+        t = &bd->nodes[n->a];
+        if (t->flags & TURKC_NF_GLOBAL) {
+            if ((a = emit(bd, IR_STOREG, (int32_t)t->aux, 1, i)) != 0)
+                turkc_ir_set_arg(bd->f, a, 0, v);
+        } else {
+            write_var(bd, bd->cur, t->aux, v);
+        }
+        return v;
+    case ND_BINARY:
+        /* sola bağlı zincir döngüyle: dipten aux ile i'ye çıkılır */
+        j = turkc_chain_bottom(bd->nodes, i);
+        a = expr(bd, bd->nodes[j].a);
+        for (;;) {
+            n = &bd->nodes[j];
+            b = expr(bd, n->b);
+            for (k = 0; k < sizeof(binop_token) && binop_token[k] != n->op; k++)
+                ;
+            if ((v = emit(bd, IR_ADD + k, 0, 2, j)) != 0) {
+                turkc_ir_set_arg(bd->f, v, 0, a);
+                turkc_ir_set_arg(bd->f, v, 1, b);
+            }
+            if (j == i || bd->f->oom)
+                return v;
+            a = v;
+            j = n->aux;
+        }
+    case ND_NEG:
+        a = expr(bd, n->a);
+        if ((v = emit(bd, IR_NEG, 0, 1, i)) != 0)
+            turkc_ir_set_arg(bd->f, v, 0, a);
+        return v;
+    case ND_CALL:
+        if (n->aux == TURKC_FUNC_YAZ) {
+            t = &bd->nodes[n->b];
+            if (t->kind == ND_STRING) {
+                emit(bd, IR_YAZS, (int32_t)t->a, 0, i);
+            } else {
+                a = expr(bd, n->b);
+                if ((v = emit(bd, IR_YAZ, 0, 1, i)) != 0)
+                    turkc_ir_set_arg(bd->f, v, 0, a);
+            }
+            return 0;
+        }
+        base = bd->nargs;
+        for (arg = n->b; arg; arg = bd->nodes[arg].next) {
+            v = expr(bd, arg);
+            if (grow((void **)&bd->args, &bd->acap, bd->nargs + 1, sizeof(*bd->args)) != 0) {
+                bd->f->oom = 1;
+                return 0;
+            }
+            bd->args[bd->nargs++] = v;
+        }
+        v = emit(bd, IR_CALL, (int32_t)n->aux, bd->nargs - base, i);
+        for (k = base; v && k < bd->nargs; k++)
+            turkc_ir_set_arg(bd->f, v, k - base, bd->args[k]);
+        bd->nargs = base;
+        return v;
+    }
+    return 0;
+}
+
+static void stmt(struct build *bd, uint32_t i)
+{
+    const struct turkc_node *n = &bd->nodes[i];
+    uint32_t s, c, t, e, j, v;
+
+    if (bd->f->oom)
+        return;
+    switch (n->kind) {
+    case ND_BLOCK:
+        for (s = n->a; s; s = bd->nodes[s].next)
+            stmt(bd, s);
+        break;
+    case ND_VAR:
+        v = n->a ? expr(bd, n->a) : emit(bd, IR_CONST, 0, 0, i);
+        write_var(bd, bd->cur, n->aux, v);
+        break;
+    case ND_IF:
+        c = expr(bd, n->a);
+        t = new_block(bd);
+        e = n->c ? new_block(bd) : 0;
+        j = new_block(bd);
+        branch(bd, c, t, e ? e : j);
+        seal(bd, t);
+        bd->cur = t;
+        stmt(bd, n->b);
+        jump(bd, j);
+        if (e) {
+            seal(bd, e);
+            bd->cur = e;
+            stmt(bd, n->c);
+            jump(bd, j);
+        }
+        seal(bd, j);
+        bd->cur = j;
+        break;
+    case ND_WHILE:
+    case ND_FOR:
+        if (n->kind == ND_FOR && n->a)
+            stmt(bd, n->a);
+        j = new_block(bd);      /* başlık: koşul */
+        t = new_block(bd);      /* gövde */
+        e = new_block(bd);      /* çıkış */
+        jump(bd, j);
+        bd->cur = j;
+        c = n->kind == ND_WHILE ? n->a : n->b;
+        if (c)
+            branch(bd, expr(bd, c), t, e);
+        else
+            jump(bd, t);
+        seal(bd, t);
+        bd->cur = t;
+        stmt(bd, n->kind == ND_WHILE ? n->b : n->d);
+        if (n->kind == ND_FOR && n->c)
+            expr(bd, n->c);
+        jump(bd, j);
+        seal(bd, j);
+        seal(bd, e);
+        bd->cur = e;
+        break;
+    case ND_RETURN:
+        v = n->a ? expr(bd, n->a) : 0;
+        if ((s = emit(bd, IR_RET, 0, v ? 1 : 0, i)) != 0 && v)
+            turkc_ir_set_arg(bd->f, s, 0, v);
+        /* sonraki deyimler ulaşılamaz bir bloğa */
+        if ((bd->cur = new_block(bd)) != 0)
+            seal(bd, bd->cur);
+        break;
+    case ND_EXPR:
+        expr(bd, n->a);
+        break;
+    }
+}
+
+static int build_func(struct turkc_ir_func *f, const struct turkc_program *prog, uint32_t func)
+{
+    const struct turkc_function *fn = &prog->funcs[func];
+    struct build bd;
+    uint32_t p, v, i;
+
+    memset(f, 0, sizeof(*f));
+    f->func = func;
+    f->nparams = fn->nparams;
+    f->returns = fn->returns;
+    f->ninsns = f->nuses = f->nblocks = 1;
+    if (grow((void **)&f->insns, &f->insns_cap, 64, sizeof(*f->insns)) != 0 ||
+        grow((void **)&f->uses, &f->uses_cap, 64, sizeof(*f->uses)) != 0 ||
+        grow((void **)&f->blocks, &f->blocks_cap, 16, sizeof(*f->blocks)) != 0)
+        return -1;
+    memset(&f->insns[0], 0, sizeof(f->insns[0]));
+    memset(&f->uses[0], 0, sizeof(f->uses[0]));
+    memset(&f->blocks[0], 0, sizeof(f->blocks[0]));
+
+    memset(&bd, 0, sizeof(bd));
+    bd.f = f;
+    bd.prog = prog;
+    bd.nodes = prog->ast->nodes;
+    bd.nslots = fn->nslots;
+    bd.cur = new_block(&bd);
+    if (bd.cur)
+        seal(&bd, bd.cur);
+    for (p = 0; p < fn->nparams; p++) {
+        v = emit(&bd, IR_PARAM, (int32_t)p, 0, 0);
+        write_var(&bd, bd.cur, p, v);
+    }
+    stmt(&bd, bd.nodes[fn->node].b);
+    /* sona ulaşan fonksiyon 0 döndürür */
+    if (fn->returns) {
+        v = emit(&bd, IR_CONST, 0, 0, 0);
+        if ((i = emit(&bd, IR_RET, 0, 1, 0)) != 0)
+            turkc_ir_set_arg(f, i, 0, v);
+    } else {
+        emit(&bd, IR_RET, 0, 0, 0);
+    }
+    turkc_ir_prune(f);
+    /* ulaşılamaz öncüller gidince tek işlenenli kalan phi'ler */
+    for (i = 1; i < f->ninsns && !f->oom; i++) {
+        if (f->insns[i].op == IR_PHI)
+            try_remove_trivial(&bd, i);
+    }
+    if (bd.zero && !f->oom && !f->insns[bd.zero].uses)
+        turkc_ir_remove(f, bd.zero);
+    free(bd.keys);
+    free(bd.vals);
+    free(bd.sealed);
+    free(bd.edges);
+    free(bd.efrom);
+    free(bd.enext);
+    free(bd.fwd);
+    free(bd.args);
+    return f->oom ? -1 : 0;
+}
+
+static void free_func(struct turkc_ir_func *f)
+{
+    free(f->insns);
+    free(f->uses);
+    free(f->blocks);
+    free(f->preds);
+    free(f->order);
+}
+
+int turkc_ir_build(struct turkc_ir *ir, const struct turkc_program *prog,
+                   struct turkc_parse_error *err)
+{
+    uint32_t i;
+
+    ir->prog = prog;
+    ir->nfuncs = 0;
+    ir->funcs = calloc(prog->nfuncs ? prog->nfuncs : 1, sizeof(*ir->funcs));
+    if (!ir->funcs)
+        goto oom;
+    for (i = 0; i < prog->nfuncs; i++) {
+        ir->nfuncs = i + 1;
+        if (build_func(&ir->funcs[i], prog, i) != 0)
+            goto oom;
+    }
+    return 0;
+
+oom:
+    turkc_ir_free(ir);
+    snprintf(err->message, sizeof(err->message), "bellek yetersiz");
+    err->offset = err->line = err->column = 0;
+    return -1;
+}
+
+void turkc_ir_free(struct turkc_ir *ir)
+{
+    uint32_t i;
+
+    for (i = 0; i < ir->nfuncs; i++)
+        free_func(&ir->funcs[i]);
+    free(ir->funcs);
+    ir->funcs = NULL;
+    ir->nfuncs = 0;
+}
+
+/* Doğrulama */
+
+static int bad(struct turkc_parse_error *err, const char *fmt, ...)
+{
+    va_list ap;
+
+    if (err) {
+        va_start(ap, fmt);
+        vsnprintf(err->message, sizeof(err->message), fmt, ap);
+        va_end(ap);
+        err->offset = err->line = err->column = 0;
+    }
+    return -1;
+}
+
+static int check_arity(const struct turkc_ir *ir, const struct turkc_ir_func *f,
+                       const struct turkc_ir_insn *in)
+{
+    switch (in->op) {
+    case IR_CONST:
+    case IR_PARAM:
+    case IR_LOADG:
+    case IR_YAZS:
+    case IR_JMP:
+        return in->nargs == 0;
+    case IR_NEG:
+    case IR_STOREG:
+    case IR_YAZ:
+    case IR_BR:
+        return in->nargs == 1;
+    case IR_RET:
+        return in->nargs == (uint32_t)(f->returns ? 1 : 0);
+    case IR_CALL:
+        return (uint32_t)in->k < ir->nfuncs && in->nargs == ir->prog->funcs[in->k].nparams;
+    case IR_PHI:
+        return in->nargs == f->blocks[in->block].npreds;
+    }
+    return in->op >= IR_ADD && in->op <= IR_GE && in->nargs == 2;
+}
+
+int turkc_ir_verify(const struct turkc_ir *ir, struct turkc_ir_func *f,
+                    struct turkc_parse_error *err)
+{
+    const struct turkc_ir_block *bl;
+    const struct turkc_ir_insn *in, *d;
+    const struct turkc_ir_use *use;
+    uint32_t *pos = NULL, b, i, u, v, s, j, n, prev, nargs = 0, nlinks = 0;
+    int rc = -1;
+
+    if (f->oom)
+        return bad(err, "bellek yetersiz");
+    turkc_ir_dominators(f);
+    pos = calloc(f->ninsns, sizeof(*pos));
+    if (!pos || f->oom) {
+        free(pos);
+        return bad(err, "bellek yetersiz");
+    }
+    bl = f->blocks;
+
+    /* bloklar ve komut listeleri */
+    for (b = 1; b < f->nblocks; b++) {
+        if (bl[b].dead)
+            continue;
+        if (!bl[b].last) {
+            bad(err, "b%lu: bos blok", (unsigned long)b);
+            goto out;
+        }
+        for (i = bl[b].first, prev = 0, n = 0; i; prev = i, i = f->insns[i].next) {
+            in = &f->insns[i];
+            if (in->block != b || in->prev != prev || in->op == IR_NOP || in->op >= IR_OP_COUNT) {
+                bad(err, "b%lu: komut listesi bozuk (v%lu)", (unsigned long)b, (unsigned long)i);
+                goto out;
+            }
+            pos[i] = ++n;
+            if ((in->op == IR_JMP || in->op == IR_BR || in->op == IR_RET) != (i == bl[b].last)) {
+                bad(err, "b%lu: sonlandirici yalniz sonda olmali (v%lu)", (unsigned long)b, (unsigned long)i);
+                goto out;
+            }
+            if (in->op == IR_PHI && prev && f->insns[prev].op != IR_PHI) {
+                bad(err, "v%lu: phi blok basinda olmali", (unsigned long)i);
+                goto out;
+            }
+            if (in->op == IR_PARAM && b != 1) {
+                bad(err, "v%lu: param giris blogunda olmali", (unsigned long)i);
+                goto out;
+            }
+        }
+        if (prev != bl[b].last) {
+            bad(err, "b%lu: komut listesi bozuk", (unsigned long)b);
+            goto out;
+        }
+        in = &f->insns[bl[b].last];
+        n = in->op == IR_BR ? 2 : in->op == IR_JMP ? 1 : 0;
+        for (s = 0; s < 2; s++) {
+            if ((bl[b].succ[s] != 0) != (s < n) ||
+                (bl[b].succ[s] && (bl[b].succ[s] >= f->nblocks || bl[bl[b].succ[s]].dead))) {
+                bad(err, "b%lu: ardillar sonlandiriciyla uyusmuyor", (unsigned long)b);
+                goto out;
+            }
+        }
+        if (n == 2 && bl[b].succ[0] == bl[b].succ[1]) {
+            bad(err, "b%lu: br'nin iki ardili ayni", (unsigned long)b);
+            goto out;
+        }
+        for (s = 0; s < n; s++) {
+            const struct turkc_ir_block *t = &bl[bl[b].succ[s]];
+
+            for (j = 0; j < t->npreds && f->preds[t->preds + j] != b; j++)
+                ;
+            if (j == t->npreds) {
+                bad(err, "b%lu: oncul listesi guncel degil", (unsigned long)bl[b].succ[s]);
+                goto out;
+            }
+        }
+    }
+    if (bl[1].dead || bl[1].npreds) {
+        bad(err, "b1: giris blogunun onculu olamaz");
+        goto out;
+    }
+
+    /* işlenenler */
+    for (b = 1; b < f->nblocks; b++) {
+        if (bl[b].dead)
+            continue;
+        for (j = 0; j < bl[b].npreds; j++) {
+            s = f->preds[bl[b].preds + j];
+            if (bl[s].dead || (bl[s].succ[0] != b && bl[s].succ[1] != b)) {
+                bad(err, "b%lu: oncul listesi guncel degil", (unsigned long)b);
+                goto out;
+            }
+        }
+        for (i = bl[b].first; i; i = f->insns[i].next) {
+            in = &f->insns[i];
+            if (!check_arity(ir, f, in)) {
+                bad(err, "v%lu: %s icin islenen sayisi yanlis", (unsigned long)i, turkc_ir_op_name(in->op));
+                goto out;
+            }
+            nargs += in->nargs;
+            for (j = 0; j < in->nargs; j++) {
+                use = &f->uses[in->args + j];
+                v = use->value;
+                d = &f->insns[v];
+                if (use->user != i || !v || v >= f->ninsns || d->op == IR_NOP || turkc_ir_is_void(d->op)) {
+                    bad(err, "v%lu: %lu. islenen gecersiz", (unsigned long)i, (unsigned long)j + 1);
+                    goto out;
+                }
+                if (in->op == IR_PHI) {
+                    for (s = 0; s < bl[b].npreds && f->preds[bl[b].preds + s] != use->block; s++)
+                        ;
+                    if (s == bl[b].npreds || turkc_ir_phi_value(f, i, use->block) != v) {
+                        bad(err, "v%lu: phi islenenleri oncullerle uyusmuyor", (unsigned long)i);
+                        goto out;
+                    }
+                    /* değer, gelen bloğun sonunda tanımlı olmalı */
+                    if (bl[use->block].rpo && !turkc_ir_dominates(f, d->block, use->block)) {
+                        bad(err, "v%lu, v%lu kullanimina baskin degil", (unsigned long)v, (unsigned long)i);
+                        goto out;
+                    }
+                } else if (bl[b].rpo && (d->block == b ? pos[v] >= pos[i]
+                                                         : !turkc_ir_dominates(f, d->block, b))) {
+                    bad(err, "v%lu, v%lu kullanimina baskin degil", (unsigned long)v, (unsigned long)i);
+                    goto out;
+                }
+            }
+        }
+    }
+
+    /* kullanım listeleri işlenenlerle aynı */
+    for (i = 1; i < f->ninsns; i++) {
+        if (f->insns[i].op == IR_NOP) {
+            if (f->insns[i].uses) {
+                bad(err, "v%lu: silinmis deger kullaniliyor", (unsigned long)i);
+                goto out;
+            }
+            continue;
+        }
+        for (u = f->insns[i].uses, prev = 0; u; prev = u, u = f->uses[u].next) {
+            use = &f->uses[u];
+            in = &f->insns[use->user];
+            if (use->value != i || use->prev != prev || in->op == IR_NOP ||
+                u < in->args || u >= in->args + in->nargs) {
+                bad(err, "v%lu: kullanim listesi bozuk", (unsigned long)i);
+                goto out;
+            }
+            nlinks++;
+        }
+    }
+    if (nlinks != nargs) {
+        bad(err, "kullanim listeleri islenenlerle uyusmuyor");
+        goto out;
+    }
+    rc = 0;
+
+out:
+    free(pos);
+    return rc;
+}
+
+/* Döküm */
+
+void turkc_ir_print(const struct turkc_ir *ir, uint32_t func, FILE *out)
+{
+    const struct turkc_ir_func *f = &ir->funcs[func];
+    const struct turkc_ast *ast = ir->prog->ast;
+    const struct turkc_ir_insn *in;
+    const struct turkc_ir_use *a;
+    uint32_t b, i, j, nblocks = 0;
+    const char *text;
+    size_t len;
+
+    for (b = 1; b < f->nblocks; b++)
+        nblocks += !f->blocks[b].dead;
+    fprintf(out, "%s: %lu parametre, %lu komut, %lu blok\n",
+            turkc_ast_symbol(ast, ir->prog->funcs[f->func].name), (unsigned long)f->nparams,
+            (unsigned long)turkc_ir_count(f), (unsigned long)nblocks);
+    for (b = 1; b < f->nblocks; b++) {
+        if (f->blocks[b].dead)
+            continue;
+        fprintf(out, "b%lu:", (unsigned long)b);
+        for (j = 0; j < f->blocks[b].npreds; j++)
+            fprintf(out, "%s b%lu", j ? "," : "    ; oncul", (unsigned long)f->preds[f->blocks[b].preds + j]);
+        fputc('\n', out);
+        for (i = f->blocks[b].first; i; i = f->insns[i].next) {
+            in = &f->insns[i];
+            a = &f->uses[in->args];
+            fputs("    ", out);
+            if (!turkc_ir_is_void(in->op))
+                fprintf(out, "v%lu = ", (unsigned long)i);
+            fputs(turkc_ir_op_name(in->op), out);
+            switch (in->op) {
+            case IR_CONST:
+            case IR_PARAM:
+                fprintf(out, " %ld", (long)in->k);
+                break;
+            case IR_LOADG:
+                fprintf(out, " g%ld", (long)in->k);
+                break;
+            case IR_STOREG:
+                fprintf(out, " g%ld, v%lu", (long)in->k, (unsigned long)a[0].value);
+                break;
+            case IR_CALL:
+                fprintf(out, " %s(", turkc_ast_symbol(ast, ir->prog->funcs[in->k].name));
+                for (j = 0; j < in->nargs; j++)
+                    fprintf(out, "%sv%lu", j ? ", " : "", (unsigned long)a[j].value);
+                fputc(')', out);
+                break;
+            case IR_PHI:
+                for (j = 0; j < in->nargs; j++)
+                    fprintf(out, "%s [b%lu: v%lu]", j ? "," : "", (unsigned long)a[j].block,
+                            (unsigned long)a[j].value);
+                break;
+            case IR_YAZS:
+                text = turkc_intern_text(ast->syms, (uint32_t)in->k, &len);
+                fprintf(out, " %.*s", (int)len, text);
+                break;
+            case IR_JMP:
+                fprintf(out, " b%lu", (unsigned long)f->blocks[b].succ[0]);
+                break;
+            case IR_BR:
+                fprintf(out, " v%lu, b%lu, b%lu", (unsigned long)a[0].value,
+                        (unsigned long)f->blocks[b].succ[0], (unsigned long)f->blocks[b].succ[1]);
+                break;
+            default:
+                for (j = 0; j < in->nargs; j++)
+                    fprintf(out, "%s v%lu", j ? "," : "", (unsigned long)a[j].value);
+                break;
+            }
+            fputc('\n', out);
+        }
+    }
+}
+
+/* Yorumlama */
+
+struct run {
+    const struct turkc_ir *ir;
+    int32_t *globals;
+    int32_t *stack, *sp, *end;  /* sp: çağrılanın argümanları */
+    uintptr_t c_stack;          /* turkc_stack_run'ın yığınında başlangıç */
+    size_t c_limit;             /* oradan inilebilecek byte */
+    uint32_t depth;             /* etkin çağrılar */
+    uint64_t steps;
+    FILE *out;
+    struct turkc_parse_error *err;
+    jmp_buf fail;
+};
+
+static void run_fail(struct run *r, uint32_t node, const char *msg)
+{
+    if (r->err) {
+        snprintf(r->err->message, sizeof(r->err->message), "%s", msg);
+        r->err->offset = node ? r->ir->prog->ast->nodes[node].offset : 0;
+        r->err->line = 0;
+        r->err->column = 0;
+    }
+    longjmp(r->fail, 1);
+}
+
+/* Çerçeve: argümanlar, komut başına bir değer, phi'ler için geçici alan */
+static int32_t run_func(struct run *r, uint32_t func, uint32_t node)
+{
+    const struct turkc_ir_func *f = &r->ir->funcs[func];
+    const struct turkc_ir_insn *ins = f->insns, *in;
+    const struct turkc_ir_use *us = f->uses;
+    const struct turkc_ir_block *bl = f->blocks;
+    int32_t *args = r->sp, *v = args + f->nparams, *tmp = v + f->ninsns, x, y;
+    uintptr_t here = (uintptr_t)&args;
+    uint32_t b = 1, prev = 0, i, j, n;
+    const char *text;
+    size_t len;
+
+    if ((uintptr_t)(r->end - args) < f->nparams + 2 * (uintptr_t)f->ninsns)
+        run_fail(r, node, "yigin tasmasi");
+    /* C yığını sınırı yalnız çok derin ifadeli özyinelemede önce dolar */
+    if (r->depth >= TURKC_MAX_CALL_DEPTH ||
+        (here < r->c_stack ? r->c_stack - here : here - r->c_stack) > r->c_limit)
+        run_fail(r, node, "cok derin ozyineleme");
+    r->depth++;
+    for (;;) {
+        /* phi'ler paralel atanır: önce hepsi okunur */
+        n = 0;
+        for (i = bl[b].first; ins[i].op == IR_PHI; i = ins[i].next) {
+            for (j = ins[i].args; us[j].block != prev; j++)
+                ;
+            tmp[n++] = v[us[j].value];
+        }
+        r->steps += n;
+        n = 0;
+        for (i = bl[b].first; ins[i].op == IR_PHI; i = ins[i].next)
+            v[i] = tmp[n++];
+
+        for (; i; i = ins[i].next) {
+            in = &ins[i];
+            r->steps++;
+            switch (in->op) {
+            case IR_CONST:
+                v[i] = in->k;
+                break;
+            case IR_PARAM:
+                v[i] = args[in->k];
+                break;
+            case IR_ADD: case IR_SUB: case IR_MUL: case IR_DIV: case IR_MOD:
+            case IR_EQ: case IR_NE: case IR_LT: case IR_GT: case IR_LE: case IR_GE:
+                x = v[us[in->args].value];
+                y = v[us[in->args + 1].value];
+                if (y == 0 && (in->op == IR_DIV || in->op == IR_MOD))
+                    run_fail(r, in->node, "sifira bolme");
+                v[i] = turkc_binop(binop_token[in->op - IR_ADD], x, y);
+                break;
+            case IR_NEG:
+                v[i] = (int32_t)(0u - (uint32_t)v[us[in->args].value]);
+                break;
+            case IR_LOADG:
+                v[i] = r->globals[in->k];
+                break;
+            case IR_STOREG:
+                r->globals[in->k] = v[us[in->args].value];
+                break;
+            case IR_CALL:
+                r->sp = tmp;
+                for (j = 0; j < in->nargs; j++)
+                    tmp[j] = v[us[in->args + j].value];
+                v[i] = run_func(r, (uint32_t)in->k, in->node);
+                break;
+            case IR_YAZ:
+                fprintf(r->out, "%ld\n", (long)v[us[in->args].value]);
+                break;
+            case IR_YAZS:
+                text = turkc_intern_text(r->ir->prog->ast->syms, (uint32_t)in->k, &len);
+                fwrite(text + 1, 1, len - 2, r->out);   /* tırnaklar hariç */
+                fputc('\n', r->out);
+                break;
+            case IR_JMP:
+                prev = b;
+                b = bl[b].succ[0];
+                goto next;
+            case IR_BR:
+                prev = b;
+                b = bl[b].succ[v[us[in->args].value] ? 0 : 1];
+                goto next;
+            case IR_RET:
+                r->sp = args;
+                r->depth--;
+                return in->nargs ? v[us[in->args].value] : 0;
+            }
+        }
+        run_fail(r, node, "sonlandirici yok");
+next:;
+    }
+}
+
+struct run_call {
+    struct run *r;
+    uint32_t func;
+    int32_t value;
+    int rc;
+};
+
+/* turkc_stack_run'ın açtığı yığında */
+static void run_main(void *arg, size_t limit)
+{
+    struct run_call *c = arg;
+    struct run *r = c->r;
+
+    r->c_stack = (uintptr_t)&c;
+    r->c_limit = limit;
+    c->rc = -1;
+    if (setjmp(r->fail))
+        return;
+    c->value = run_func(r, c->func, r->ir->prog->funcs[c->func].node);
+    c->rc = 0;
+}
+
+int turkc_ir_run(const struct turkc_ir *ir, uint32_t func, const int32_t *args,
+                 int32_t *result, FILE *out, uint64_t *steps,
+                 struct turkc_parse_error *err)
+{
+    const struct turkc_program *prog = ir->prog;
+    struct run r;
+    struct run_call c;
+
+    memset(&r, 0, sizeof(r));
+    r.ir = ir;
+    r.out = out;
+    r.err = err;
+    r.globals = malloc((prog->nglobals ? prog->nglobals : 1) * sizeof(int32_t));
+    r.stack = malloc(TURKC_IR_STACK_SLOTS * sizeof(int32_t));
+    if (!r.globals || !r.stack) {
+        free(r.globals);
+        free(r.stack);
+        return bad(err, "bellek yetersiz");
+    }
+    memcpy(r.globals, prog->globals, prog->nglobals * sizeof(int32_t));
+    r.sp = r.stack;
+    r.end = r.stack + TURKC_IR_STACK_SLOTS;
+    if (ir->funcs[func].nparams)
+        memcpy(r.stack, args, ir->funcs[func].nparams * sizeof(int32_t));
+    c.r = &r;
+    c.func = func;
+    c.value = 0;
+    turkc_stack_run(run_main, &c);
+    if (steps)
+        *steps += r.steps;
+    if (result)
+        *result = c.value;
+    free(r.globals);
+    free(r.stack);
+    return c.rc;
+}
@@ -0,0 +1,212 @@
+#ifndef TURKC_IR_H
+#define TURKC_IR_H
+
+/* SSA ara gösterimi (IR).
+ *
+ * turkc_ir_build çözümlenmiş programın (turkc_resolve.h) her fonksiyonunu
+ * temel bloklara ve SSA değerlerine çevirir. Yerel değişkenler değer olur:
+ * her atama yeni bir değerdir, birleşme noktalarında phi üretilir. Phi'ler
+ * ağaç dolaşılırken kurulur (Braun ve ark., "Simple and Efficient
+ * Construction of Static Single Assignment Form"); gereksiz phi hemen
+ * silinir. Globaller bellekte kalır (LOADG/STOREG), çağrılar onları
+ * değiştirebilir.
+ *
+ * Her şey fonksiyon başına düz dizilerdedir ve 32 bit indeksle gösterilir,
+ * 0 "yok" anlamındadır:
+ *
+ *   insns   komutlar; değer üreten komutun indeksi değerin adıdır (vN).
+ *           Bloktaki sıra prev/next ile tutulur; silinen komut IR_NOP olur
+ *           ve yeri boş kalır.
+ *   uses    işlenenler. Komutun işlenenleri ardışık bir aralıktır (args,
+ *           nargs); her işlenen ayrıca kullandığı değerin kullanım
+ *           listesine bağlıdır (def-use zinciri: insn.uses, use.next).
+ *   blocks  temel bloklar. Son komut sonlandırıcıdır (JMP, BR, RET),
+ *           ardıllar succ'tadır. Öncüller preds dizisindedir ve
+ *           turkc_ir_cfg ile ardıllardan yeniden hesaplanır.
+ *
+ * Phi işleneni gelen bloğu da taşır (use.block), bu yüzden öncüllerin
+ * sırası önemsizdir. Giriş bloğu 1'dir.
+ *
+ * turkc_ir_run IR'ı doğrudan yorumlar; anlam turkc_interp ile aynıdır ve
+ * geçişlerin programın davranışını değiştirmediğini denetlemeye yarar.
+ * Onun gibi ayrı bir yığında çalışır ve derinlik TURKC_MAX_CALL_DEPTH
+ * çağrıyla sınırlıdır (turkc_stack.h).
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "turkc_parse.h"
+#include "turkc_resolve.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TURKC_IR_STACK_SLOTS    (1u << 22)      /* turkc_ir_run değer yığını, 16 MB */
+
+/* a, b: ilk ve ikinci işlenen */
+enum turkc_ir_op {
+    IR_NOP,         /* silinmiş */
+    IR_CONST,       /* k */
+    IR_PARAM,       /* k. parametre, giriş bloğunda */
+    IR_PHI,         /* gelen blok başına bir işlenen; k: değişken slotu */
+    IR_ADD, IR_SUB, IR_MUL, IR_DIV, IR_MOD,     /* a op b */
+    IR_EQ, IR_NE, IR_LT, IR_GT, IR_LE, IR_GE,   /* a op b (0/1) */
+    IR_NEG,         /* -a */
+    IR_LOADG,       /* global[k] */
+    IR_STOREG,      /* global[k] = a */
+    IR_CALL,        /* funcs[k](işlenenler) */
+    IR_YAZ,         /* yaz(a) */
+    IR_YAZS,        /* yaz(string sembolü k) */
+    IR_JMP,         /* succ[0] */
+    IR_BR,          /* a != 0 ise succ[0], değilse succ[1] */
+    IR_RET,         /* a'yı döndür, işlenen yoksa 0 */
+
+    IR_OP_COUNT
+};
+
+struct turkc_ir_insn {
+    uint8_t op;
+    uint8_t mark;               /* geçişlerin serbest kullanımı */
+    uint16_t pad;
+    uint32_t block;
+    uint32_t prev, next;        /* bloktaki komutlar */
+    uint32_t args, nargs;       /* işlenenler: uses[args .. args + nargs) */
+    uint32_t uses;              /* bu değerin ilk kullanımı */
+    int32_t k;
+    uint32_t node;              /* AST düğümü (hata konumu için), 0 olabilir */
+};
+
+struct turkc_ir_use {
+    uint32_t value;             /* kullanılan değer, 0: boş */
+    uint32_t user;              /* kullanan komut */
+    uint32_t block;             /* phi'de gelen blok */
+    uint32_t prev, next;        /* value'nun kullanım listesi */
+};
+
+struct turkc_ir_block {
+    uint32_t first, last;       /* komutlar, last sonlandırıcı */
+    uint32_t succ[2];           /* 0: yok */
+    uint32_t preds, npreds;     /* öncüller: preds[preds .. preds + npreds) */
+    uint32_t idom;              /* turkc_ir_dominators; giriş ve ulaşılmazlarda 0 */
+    uint32_t rpo;               /* ters sonradan sıra, 1'den; ulaşılmazsa 0 */
+    uint32_t dpre, dpost;       /* baskınlık ağacında giriş/çıkış sırası */
+    uint8_t dead;               /* silinmiş */
+    uint8_t mark;               /* geçişlerin serbest kullanımı */
+    uint16_t pad;
+};
+
+struct turkc_ir_func {
+    uint32_t func;              /* prog->funcs indeksi */
+    uint32_t nparams;
+    int returns;
+    struct turkc_ir_insn *insns;
+    uint32_t ninsns, insns_cap;
+    struct turkc_ir_use *uses;
+    uint32_t nuses, uses_cap;
+    struct turkc_ir_block *blocks;
+    uint32_t nblocks, blocks_cap;
+    uint32_t *preds;
+    uint32_t npreds, preds_cap;
+    uint32_t *order;            /* ulaşılabilir bloklar ters sonradan sırada */
+    uint32_t norder;
+    int oom;                    /* bellek yetmedi, IR geçersiz */
+};
+
+struct turkc_ir {
+    const struct turkc_program *prog;
+    struct turkc_ir_func *funcs;    /* prog->funcs ile aynı sırada */
+    uint32_t nfuncs;
+};
+
+/* prog'u IR'a çevirir; ir prog'u gösterir ama sahiplenmez. Başarıda 0,
+ * bellek yetmezse -1 ve err.
+ */
+int turkc_ir_build(struct turkc_ir *ir, const struct turkc_program *prog,
+                   struct turkc_parse_error *err);
+void turkc_ir_free(struct turkc_ir *ir);
+
+/* Düzenleme. Bellek yetmezse f->oom kurulur ve 0 döner. */
+
+/* Boş blok */
+uint32_t turkc_ir_block_new(struct turkc_ir_func *f);
+
+/* block'ta before'dan önceye (0: sona) nargs boş işlenenli komut ekler */
+uint32_t turkc_ir_insert(struct turkc_ir_func *f, uint32_t block, uint32_t before,
+                         int op, int32_t k, uint32_t nargs);
+
+/* Komutu bloğundan çıkarır ve başka bir yere koyar (before 0: sona) */
+void turkc_ir_move(struct turkc_ir_func *f, uint32_t insn, uint32_t block, uint32_t before);
+
+/* insn'in i. işleneni value olur */
+void turkc_ir_set_arg(struct turkc_ir_func *f, uint32_t insn, uint32_t i, uint32_t value);
+
+/* Phi'ye from bloğundan gelen işlenen ekler / çıkarır */
+void turkc_ir_phi_add(struct turkc_ir_func *f, uint32_t phi, uint32_t from, uint32_t value);
+void turkc_ir_phi_drop(struct turkc_ir_func *f, uint32_t phi, uint32_t from);
+
+/* Phi'nin from'dan gelen değeri, yoksa 0 */
+uint32_t turkc_ir_phi_value(const struct turkc_ir_func *f, uint32_t phi, uint32_t from);
+
+/* old'un tüm kullanımları new'i kullanır */
+void turkc_ir_replace(struct turkc_ir_func *f, uint32_t old, uint32_t new_);
+
+/* Komutu siler (IR_NOP); değeri kullanılmıyor olmalı */
+void turkc_ir_remove(struct turkc_ir_func *f, uint32_t insn);
+
+/* Bloğu ve komutlarını siler; ardıllarındaki phi işlenenleri de gider */
+void turkc_ir_block_remove(struct turkc_ir_func *f, uint32_t block);
+
+/* Değeri kullanan işlenen sayısı */
+uint32_t turkc_ir_use_count(const struct turkc_ir_func *f, uint32_t value);
+
+/* Canlı komut sayısı */
+uint32_t turkc_ir_count(const struct turkc_ir_func *f);
+
+/* Analizler */
+
+/* preds'i ardıllardan yeniden hesaplar */
+void turkc_ir_cfg(struct turkc_ir_func *f);
+
+/* Girişten ulaşılamayan blokları siler ve preds'i günceller. Silinen varsa 1. */
+int turkc_ir_prune(struct turkc_ir_func *f);
+
+/* order, rpo ve idom'u hesaplar (preds güncel olmalı) */
+void turkc_ir_dominators(struct turkc_ir_func *f);
+
+/* a, b'ye baskın mı (a == b dahil); turkc_ir_dominators'tan sonra */
+int turkc_ir_dominates(const struct turkc_ir_func *f, uint32_t a, uint32_t b);
+
+/* Değer üretmeyen komut mu (STOREG, YAZ, YAZS, sonlandırıcılar) */
+int turkc_ir_is_void(int op);
+
+/* Silinmesi programı değiştirebilir mi (çağrı, yazma, bölme, sonlandırıcı) */
+int turkc_ir_has_effect(const struct turkc_ir_func *f, uint32_t insn);
+
+/* Yapıyı denetler: sonlandırıcılar, öncüller, phi işlenenleri, işlenen
+ * sayıları, def-use zincirleri ve her değerin kullanımlarına baskın
+ * olması. Sağlamsa 0; değilse -1 ve err'de message (offset 0).
+ */
+int turkc_ir_verify(const struct turkc_ir *ir, struct turkc_ir_func *f,
+                    struct turkc_parse_error *err);
+
+/* "add", "phi", ... */
+const char *turkc_ir_op_name(int op);
+
+/* Fonksiyonun okunabilir dökümü */
+void turkc_ir_print(const struct turkc_ir *ir, uint32_t func, FILE *out);
+
+/* turkc_interp_call gibi: ir->funcs[func]'ı args ile çağırır, yaz() out'a
+ * gider. steps NULL değilse çalıştırılan komut sayısı eklenir. Globaller
+ * her çağrıda ilk değerlerinden başlar.
+ */
+int turkc_ir_run(const struct turkc_ir *ir, uint32_t func, const int32_t *args,
+                 int32_t *result, FILE *out, uint64_t *steps,
+                 struct turkc_parse_error *err);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
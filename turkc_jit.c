@@ -0,0 +1,496 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "turkc_jit.h"
+#include "turkc_stack.h"
+#include "turkc_time.h"
+
+#if defined(__x86_64__) && !defined(_WIN32)
+#define JIT 1
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#ifdef JIT
+
+enum { RAX = 0, RCX = 1, RDX = 2, RBX = 3, RSP = 4, RSI = 6, RDI = 7, R12 = 12, R13 = 13, R14 = 14 };
+
+/* jcc koşul kodları */
+enum { CC_B = 0x2, CC_E = 0x4, CC_NE = 0x5, CC_A = 0x7, CC_L = 0xc, CC_GE = 0xd, CC_LE = 0xe, CC_G = 0xf };
+
+/* Atlama: at'teki rel32, komut indeksine veya hata koduna */
+struct fixup {
+    uint32_t at;
+    uint32_t insn;
+    uint32_t error;             /* hata koduna atlıyorsa TURKC_JIT_*, değilse NONE */
+};
+
+#define NONE    UINT32_MAX
+
+/* C'den giriş kalıbının boyu; derlenmiş koddan çağrılar bunun arkasına girer */
+#define ENTRY   14
+
+struct jit {
+    uint8_t *p;
+    size_t n, cap;
+    int oom;
+    uint32_t *pos;              /* komut başına makine kodu ofseti */
+    struct fixup *fix;
+    size_t nfix, fixcap;
+};
+
+static void grow(struct jit *j, size_t more)
+{
+    uint8_t *p;
+    size_t cap;
+
+    if (j->n + more <= j->cap)
+        return;
+    cap = j->cap ? j->cap * 2 : 4096;
+    while (cap < j->n + more)
+        cap *= 2;
+    p = realloc(j->p, cap);
+    if (!p) {
+        j->oom = 1;
+        j->n = 0;               /* yazmaya devam et, sonuç atılır */
+        return;
+    }
+    j->p = p;
+    j->cap = cap;
+}
+
+static void byte(struct jit *j, int b)
+{
+    grow(j, 1);
+    if (!j->oom)
+        j->p[j->n++] = (uint8_t)b;
+}
+
+static void imm32(struct jit *j, uint32_t v)
+{
+    byte(j, v & 0xff);
+    byte(j, (v >> 8) & 0xff);
+    byte(j, (v >> 16) & 0xff);
+    byte(j, v >> 24);
+}
+
+static void imm64(struct jit *j, uint64_t v)
+{
+    imm32(j, (uint32_t)v);
+    imm32(j, (uint32_t)(v >> 32));
+}
+
+/* op reg, [base + disp]; w: 64 bit işlem (REX.W). op 0x0f ile başlıyorsa
+ * iki byte'tır.
+ */
+static void mem(struct jit *j, int w, int op, int reg, int base, int32_t disp)
+{
+    int rex = 0x40 | w << 3 | (reg & 8) >> 1 | (base & 8) >> 3, mod;
+
+    if (rex != 0x40)
+        byte(j, rex);
+    if (op > 0xff)
+        byte(j, op >> 8);
+    byte(j, op & 0xff);
+    if (disp == 0 && (base & 7) != 5)
+        mod = 0;
+    else if (disp >= -128 && disp <= 127)
+        mod = 1;
+    else
+        mod = 2;
+    byte(j, mod << 6 | (reg & 7) << 3 | (base & 7));
+    if ((base & 7) == 4)
+        byte(j, 0x24);                          /* SIB: [r12] */
+    if (mod == 1)
+        byte(j, disp & 0xff);
+    else if (mod == 2)
+        imm32(j, (uint32_t)disp);
+}
+
+/* Çerçevedeki yazmaç */
+#define SLOT(r)     ((int32_t)(r) * 4)
+
+static void load(struct jit *j, int reg, uint32_t r)
+{
+    mem(j, 0, 0x8b, reg, RBX, SLOT(r));         /* mov reg, [rbx + 4r] */
+}
+
+static void store(struct jit *j, uint32_t r, int reg)
+{
+    mem(j, 0, 0x89, reg, RBX, SLOT(r));         /* mov [rbx + 4r], reg */
+}
+
+static void fixup(struct jit *j, uint32_t insn, uint32_t error)
+{
+    struct fixup *f;
+
+    if (j->nfix == j->fixcap) {
+        j->fixcap = j->fixcap ? j->fixcap * 2 : 64;
+        f = realloc(j->fix, j->fixcap * sizeof(*f));
+        if (!f) {
+            j->oom = 1;
+            j->nfix = 0;
+            return;
+        }
+        j->fix = f;
+    }
+    f = &j->fix[j->nfix++];
+    f->at = (uint32_t)j->n;
+    f->insn = insn;
+    f->error = error;
+    imm32(j, 0);
+}
+
+static void jump(struct jit *j, uint32_t target)
+{
+    byte(j, 0xe9);
+    fixup(j, target, NONE);
+}
+
+static void jcc(struct jit *j, int cc, uint32_t target)
+{
+    byte(j, 0x0f);
+    byte(j, 0x80 | cc);
+    fixup(j, target, NONE);
+}
+
+/* insn'deki hatada kaçış; komut indeksi ve hata kodu kaçış kodunda */
+static void jcc_fail(struct jit *j, int cc, uint32_t insn, uint32_t error)
+{
+    byte(j, 0x0f);
+    byte(j, 0x80 | cc);
+    fixup(j, insn, error);
+}
+
+/* mov rax, imm64; call rax */
+static void call_abs(struct jit *j, const void *fn)
+{
+    byte(j, 0x48);
+    byte(j, 0xb8);
+    imm64(j, (uint64_t)(uintptr_t)fn);
+    byte(j, 0xff);
+    byte(j, 0xd0);
+}
+
+static void mov_rdi_r13(struct jit *j)
+{
+    byte(j, 0x4c);
+    byte(j, 0x89);
+    byte(j, 0xef);
+}
+
+static void mov_imm(struct jit *j, int reg, uint32_t v)
+{
+    byte(j, 0xb8 + reg);                        /* mov r32, imm32 (reg < 8) */
+    imm32(j, v);
+}
+
+static int compare_cc(int op, int base)
+{
+    static const int cc[6] = { CC_E, CC_NE, CC_L, CC_G, CC_LE, CC_GE };
+
+    return cc[op - base];
+}
+
+/* Komutların hepsinin kalıbı var mı */
+static int supported(const struct turkc_vm_func *fn)
+{
+    uint32_t i;
+
+    for (i = 0; i < fn->ncode; i++) {
+        if (fn->code[i].op >= OP_COUNT)
+            return 0;
+    }
+    return 1;
+}
+
+static void translate(struct jit *j, struct turkc_vm_func *funcs, uint32_t func,
+                      const struct turkc_jit_helpers *h)
+{
+    const struct turkc_vm_func *fn = &funcs[func], *callee;
+    const struct turkc_insn *in;
+    uint32_t i, target;
+    size_t skip;
+    int div;
+
+    /* C'den giriş: r14d'de kalan çağrı sayısı (ctx->calls_left) tutulur.
+     * push r14; mov r14d, [rsi + 24]; call iç giriş; pop r14; ret
+     */
+    byte(j, 0x41); byte(j, 0x56);
+    mem(j, 0, 0x8b, R14, RSI, 24);
+    byte(j, 0xe8);
+    imm32(j, 3);
+    byte(j, 0x41); byte(j, 0x5e);
+    byte(j, 0xc3);
+
+    /* iç giriş, ENTRY'de. push rbx; push r12; push r13: rsp 16'ya hizalanır */
+    byte(j, 0x53);
+    byte(j, 0x41);
+    byte(j, 0x54);
+    byte(j, 0x41);
+    byte(j, 0x55);
+    byte(j, 0x48); byte(j, 0x89); byte(j, 0xfb);        /* mov rbx, rdi */
+    byte(j, 0x49); byte(j, 0x89); byte(j, 0xf5);        /* mov r13, rsi */
+    mem(j, 1, 0x8b, R12, R13, 0);                       /* mov r12, [r13] */
+
+    for (i = 0; i < fn->ncode; i++) {
+        in = &fn->code[i];
+        j->pos[i] = (uint32_t)j->n;
+        switch (in->op) {
+        case OP_MOVE:
+            load(j, RAX, in->b);
+            store(j, in->a, RAX);
+            break;
+        case OP_LOADK:
+            mem(j, 0, 0xc7, 0, RBX, SLOT(in->a));       /* mov dword [m], imm32 */
+            imm32(j, (uint32_t)in->k);
+            break;
+        case OP_GGET:
+            mem(j, 0, 0x8b, RAX, R12, in->k * 4);
+            store(j, in->a, RAX);
+            break;
+        case OP_GSET:
+            load(j, RAX, in->a);
+            mem(j, 0, 0x89, RAX, R12, in->k * 4);
+            break;
+        case OP_ADD:
+        case OP_SUB:
+        case OP_MUL:
+            load(j, RAX, in->b);
+            mem(j, 0, in->op == OP_ADD ? 0x03 : in->op == OP_SUB ? 0x2b : 0x0faf,
+                RAX, RBX, SLOT(in->c));
+            store(j, in->a, RAX);
+            break;
+        case OP_DIV:
+        case OP_MOD:
+            /* sıfır hata; -1'de idiv INT32_MIN için taşar, sonuç -x veya 0 */
+            div = in->op == OP_DIV;
+            load(j, RCX, in->c);
+            load(j, RAX, in->b);
+            byte(j, 0x85); byte(j, 0xc9);               /* test ecx, ecx */
+            jcc_fail(j, CC_E, i, TURKC_JIT_DIV0);
+            byte(j, 0x83); byte(j, 0xf9); byte(j, 0xff); /* cmp ecx, -1 */
+            byte(j, 0x75); byte(j, 0x04);               /* jne +4 */
+            if (div) {
+                byte(j, 0xf7); byte(j, 0xd8);           /* neg eax */
+            } else {
+                byte(j, 0x31); byte(j, 0xc0);           /* xor eax, eax */
+            }
+            byte(j, 0xeb);                              /* jmp bitiş */
+            skip = j->n;
+            byte(j, 0);
+            byte(j, 0x99);                              /* cdq */
+            byte(j, 0xf7); byte(j, 0xf9);               /* idiv ecx */
+            if (!div) {
+                byte(j, 0x89); byte(j, 0xd0);           /* mov eax, edx */
+            }
+            if (!j->oom)
+                j->p[skip] = (uint8_t)(j->n - skip - 1);
+            store(j, in->a, RAX);
+            break;
+        case OP_EQ: case OP_NE: case OP_LT: case OP_GT: case OP_LE: case OP_GE:
+            load(j, RAX, in->b);
+            mem(j, 0, 0x3b, RAX, RBX, SLOT(in->c));     /* cmp eax, [m] */
+            byte(j, 0x0f); byte(j, 0x90 | compare_cc(in->op, OP_EQ)); byte(j, 0xc0);
+            byte(j, 0x0f); byte(j, 0xb6); byte(j, 0xc0); /* movzx eax, al */
+            store(j, in->a, RAX);
+            break;
+        case OP_NEG:
+            load(j, RAX, in->b);
+            byte(j, 0xf7); byte(j, 0xd8);
+            store(j, in->a, RAX);
+            break;
+        case OP_ADDK:
+            load(j, RAX, in->b);
+            byte(j, 0x05);                              /* add eax, imm32 */
+            imm32(j, (uint32_t)in->k);
+            store(j, in->a, RAX);
+            break;
+        case OP_JMP:
+            jump(j, (uint32_t)in->k);
+            break;
+        case OP_JZ:
+        case OP_JNZ:
+            mem(j, 0, 0x83, 7, RBX, SLOT(in->a));       /* cmp dword [m], 0 */
+            byte(j, 0);
+            jcc(j, in->op == OP_JZ ? CC_E : CC_NE, (uint32_t)in->k);
+            break;
+        case OP_JEQ: case OP_JNE: case OP_JLT: case OP_JGT: case OP_JLE: case OP_JGE:
+            load(j, RAX, in->a);
+            mem(j, 0, 0x3b, RAX, RBX, SLOT(in->b));
+            jcc(j, compare_cc(in->op, OP_JEQ), (uint32_t)in->k);
+            break;
+        case OP_JEQK: case OP_JNEK: case OP_JLTK: case OP_JGTK: case OP_JLEK: case OP_JGEK:
+            target = (uint32_t)in->b | (uint32_t)in->c << 16;
+            mem(j, 0, 0x81, 7, RBX, SLOT(in->a));       /* cmp dword [m], imm32 */
+            imm32(j, (uint32_t)in->k);
+            jcc(j, compare_cc(in->op, OP_JEQK), target);
+            break;
+        case OP_CALL:
+            /* derinlik çağrı yerinde: hata çağrının konumunu verir */
+            callee = &funcs[in->k];
+            byte(j, 0x41); byte(j, 0x83); byte(j, 0xee); byte(j, 1);   /* sub r14d, 1 */
+            jcc_fail(j, CC_B, i, TURKC_JIT_DEEP);
+            mem(j, 1, 0x8d, RDI, RBX, SLOT(in->b));     /* lea rdi, [rbx + 4b] */
+            if ((uint32_t)in->k == func || callee->native) {
+                /* derlenmiş çağrılan: yazmaç yığını denetimi ve doğrudan çağrı */
+                mem(j, 1, 0x8d, RAX, RDI, SLOT(callee->nregs));
+                mem(j, 1, 0x3b, RAX, R13, 8);           /* cmp rax, [r13 + 8] */
+                jcc_fail(j, CC_A, i, TURKC_JIT_STACK);
+                byte(j, 0x4c); byte(j, 0x89); byte(j, 0xee);    /* mov rsi, r13 */
+                if ((uint32_t)in->k == func) {
+                    byte(j, 0xe8);                      /* call rel32: kendi iç girişi */
+                    imm32(j, (uint32_t)(ENTRY - (j->n + 4)));
+                } else {
+                    call_abs(j, (const uint8_t *)callee->native + ENTRY);
+                }
+            } else {
+                mem(j, 0, 0x89, R14, R13, 24);          /* mov [r13 + 24], r14d: VM okur */
+                byte(j, 0x48); byte(j, 0x89); byte(j, 0xfa);    /* mov rdx, rdi */
+                mov_rdi_r13(j);
+                mov_imm(j, RSI, (uint32_t)in->k);
+                call_abs(j, (const void *)h->call);
+            }
+            byte(j, 0x41); byte(j, 0x83); byte(j, 0xc6); byte(j, 1);   /* add r14d, 1 */
+            store(j, in->a, RAX);
+            break;
+        case OP_YAZ:
+            mov_rdi_r13(j);
+            mem(j, 0, 0x8b, RSI, RBX, SLOT(in->a));
+            call_abs(j, (const void *)h->yaz);
+            break;
+        case OP_YAZS:
+            mov_rdi_r13(j);
+            mov_imm(j, RSI, (uint32_t)in->k);
+            call_abs(j, (const void *)h->yazs);
+            break;
+        case OP_RET:
+        case OP_RET0:
+            if (in->op == OP_RET)
+                load(j, RAX, in->a);
+            else {
+                byte(j, 0x31); byte(j, 0xc0);
+            }
+            byte(j, 0x41); byte(j, 0x5d);               /* pop r13 */
+            byte(j, 0x41); byte(j, 0x5c);               /* pop r12 */
+            byte(j, 0x5b);                              /* pop rbx */
+            byte(j, 0xc3);
+            break;
+        }
+    }
+}
+
+/* Atlama hedefleri; hata kaçışları kodun sonuna */
+static void patch_jumps(struct jit *j, uint32_t func, const struct turkc_jit_helpers *h)
+{
+    struct fixup *f;
+    uint32_t to;
+    size_t k;
+
+    for (k = 0; k < j->nfix && !j->oom; k++) {
+        f = &j->fix[k];
+        if (f->error == NONE) {
+            to = j->pos[f->insn];
+        } else {
+            to = (uint32_t)j->n;
+            mov_rdi_r13(j);
+            mov_imm(j, RSI, func);
+            mov_imm(j, RDX, f->insn);
+            mov_imm(j, RCX, f->error);
+            call_abs(j, (const void *)h->fail);
+            if (j->oom)
+                return;
+        }
+        to -= f->at + 4;
+        memcpy(j->p + f->at, &to, 4);
+    }
+}
+
+int turkc_jit_supported(void)
+{
+    return 1;
+}
+
+int turkc_jit_compile(struct turkc_vm_func *funcs, uint32_t func,
+                      const struct turkc_jit_helpers *helpers)
+{
+    struct turkc_vm_func *fn = &funcs[func];
+    struct jit j;
+    size_t page = (size_t)sysconf(_SC_PAGESIZE), size;
+    double t0 = turkc_now();
+    void *mem_;
+
+    if (fn->native)
+        return 0;
+    if (fn->jit_failed || !supported(fn))
+        goto fail;
+    memset(&j, 0, sizeof(j));
+    j.pos = malloc((fn->ncode + 1) * sizeof(*j.pos));
+    if (!j.pos)
+        goto fail;
+    translate(&j, funcs, func, helpers);
+    patch_jumps(&j, func, helpers);
+    if (j.oom) {
+        free(j.pos);
+        free(j.fix);
+        free(j.p);
+        goto fail;
+    }
+
+    /* yazılabilir sayfalara kopyala, sonra salt okunur + çalıştırılabilir */
+    size = (j.n + page - 1) & ~(page - 1);
+    mem_ = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mem_ != MAP_FAILED) {
+        memcpy(mem_, j.p, j.n);
+        if (mprotect(mem_, size, PROT_READ | PROT_EXEC) != 0) {
+            munmap(mem_, size);
+            mem_ = MAP_FAILED;
+        }
+    }
+    free(j.pos);
+    free(j.fix);
+    free(j.p);
+    if (mem_ == MAP_FAILED)
+        goto fail;
+    fn->native = mem_;
+    fn->native_size = (uint32_t)j.n;
+    fn->jit_seconds = turkc_now() - t0;
+    return 0;
+
+fail:
+    fn->jit_failed = 1;
+    return -1;
+}
+
+void turkc_jit_release(struct turkc_vm_func *fn)
+{
+    size_t page;
+
+    if (!fn->native)
+        return;
+    page = (size_t)sysconf(_SC_PAGESIZE);
+    munmap(fn->native, (fn->native_size + page - 1) & ~(page - 1));
+    fn->native = NULL;
+}
+
+#else /* JIT yok: her şey yorumlanır */
+
+int turkc_jit_supported(void)
+{
+    return 0;
+}
+
+int turkc_jit_compile(struct turkc_vm_func *funcs, uint32_t func,
+                      const struct turkc_jit_helpers *helpers)
+{
+    (void)helpers;
+    funcs[func].jit_failed = 1;
+    return -1;
+}
+
+void turkc_jit_release(struct turkc_vm_func *fn)
+{
+    (void)fn;
+}
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef TURKC_JIT_H
+#define TURKC_JIT_H
+
+/* x86-64 JIT: bytecode VM'inin (turkc_vm.h) sık çağrılan fonksiyonlarını
+ * çalışırken makine koduna çevirir.
+ *
+ * Her komut sabit bir kalıba dönüşür; yazmaçlar bellekte kalır (rbx
+ * çerçeve, r12 globaller, r13 bağlam, r14d kalan çağrı sayısı). Kod önce yazılabilir sayfalara
+ * yazılır, sonra sayfalar salt okunur + çalıştırılabilir yapılır (W^X).
+ *
+ * Derlenmiş kod, derlenmiş çağrılanı doğrudan çağırır; diğer çağrılar,
+ * yaz() ve çalışma hataları turkc_jit_helpers'taki C fonksiyonlarına
+ * gider. Her çağrı yeri r14d'den bir düşer (C'den girişte
+ * ctx->calls_left'ten yüklenir, C'ye çağrıdan önce oraya yazılır); sayaç
+ * biterse (TURKC_MAX_CALL_DEPTH, turkc_stack.h) hata VM'deki gibi
+ * çağrının konumunu verir. Platform x86-64 System V değilse, çalıştırılabilir bellek
+ * alınamazsa veya fonksiyonda kalıbı olmayan bir komut varsa derleme
+ * başarısız olur ve fonksiyon yorumlanır.
+ */
+
+#include <stdint.h>
+
+#include "turkc_vm.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TURKC_JIT_THRESHOLD     100             /* varsayılan çağrı eşiği */
+
+/* Derlenmiş kodun gördüğü bağlam; alanların yeri koda gömülüdür */
+struct turkc_jit_ctx {
+    int32_t *globals;
+    int32_t *end;               /* yazmaç yığınının sonu */
+    uintptr_t stack_limit;      /* C'ye dönüp tekrar girerken yığın bunun altındaysa hata */
+    uint32_t calls_left;        /* TURKC_MAX_CALL_DEPTH'e kalan çağrı */
+};
+
+/* regs: fonksiyonun çerçevesi (parametreler ilk yazmaçlarda) */
+typedef int32_t (*turkc_jit_fn)(int32_t *regs, struct turkc_jit_ctx *ctx);
+
+enum {
+    TURKC_JIT_DIV0,             /* sifira bolme */
+    TURKC_JIT_DEEP,             /* cok derin ozyineleme */
+    TURKC_JIT_STACK             /* yigin tasmasi */
+};
+
+struct turkc_jit_helpers {
+    /* derlenmemiş (veya sonradan derlenmiş) fonksiyonu çağırır */
+    int32_t (*call)(struct turkc_jit_ctx *ctx, uint32_t func, int32_t *regs);
+    void (*yaz)(struct turkc_jit_ctx *ctx, int32_t value);
+    void (*yazs)(struct turkc_jit_ctx *ctx, uint32_t sym);
+    /* dönmez (longjmp) */
+    void (*fail)(struct turkc_jit_ctx *ctx, uint32_t func, uint32_t insn, uint32_t error);
+};
+
+/* Bu platformda JIT var mı */
+int turkc_jit_supported(void);
+
+/* funcs[func]'ı derler: native, native_size ve jit_seconds dolar. Başarıda
+ * 0; desteklenmiyorsa veya bellek yoksa -1 ve jit_failed.
+ */
+int turkc_jit_compile(struct turkc_vm_func *funcs, uint32_t func,
+                      const struct turkc_jit_helpers *helpers);
+
+/* Makine kodunu serbest bırakır */
+void turkc_jit_release(struct turkc_vm_func *fn);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,452 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "turkc_json.h"
+
+struct reader {
+    struct turkc_json *js;
+    const char *src, *p, *end;
+    unsigned depth;
+};
+
+static void skip_ws(struct reader *r)
+{
+    while (r->p < r->end && (*r->p == ' ' || *r->p == '\t' || *r->p == '\n' || *r->p == '\r'))
+        r->p++;
+}
+
+static uint32_t add(struct reader *r, int type)
+{
+    struct turkc_json *js = r->js;
+    struct turkc_json_value *v;
+    uint32_t n;
+
+    if (js->count >= js->cap) {
+        n = js->cap ? js->cap * 2 : 256;
+        if (n < js->cap || !(v = realloc(js->vals, (size_t)n * sizeof(*v))))
+            return 0;
+        js->vals = v;
+        js->cap = n;
+    }
+    v = &js->vals[js->count];
+    memset(v, 0, sizeof(*v));
+    v->type = (uint8_t)type;
+    v->start = (uint32_t)(r->p - r->src);
+    return js->count++;
+}
+
+/* '"'dan kapanış '"'ının arkasına */
+static int string_end(struct reader *r)
+{
+    r->p++;
+    while (r->p < r->end && *r->p != '"') {
+        if ((unsigned char)*r->p < 0x20)
+            return -1;
+        if (*r->p == '\\' && ++r->p == r->end)
+            return -1;
+        r->p++;
+    }
+    if (r->p == r->end)
+        return -1;
+    r->p++;
+    return 0;
+}
+
+static int literal(struct reader *r, const char *word)
+{
+    size_t n = strlen(word);
+
+    if ((size_t)(r->end - r->p) < n || memcmp(r->p, word, n) != 0)
+        return -1;
+    r->p += n;
+    return 0;
+}
+
+static int digits(struct reader *r)
+{
+    const char *start = r->p;
+
+    while (r->p < r->end && *r->p >= '0' && *r->p <= '9')
+        r->p++;
+    return r->p > start ? 0 : -1;
+}
+
+static int number(struct reader *r)
+{
+    if (r->p < r->end && *r->p == '-')
+        r->p++;
+    if (digits(r) != 0)
+        return -1;
+    if (r->p < r->end && *r->p == '.') {
+        r->p++;
+        if (digits(r) != 0)
+            return -1;
+    }
+    if (r->p < r->end && (*r->p == 'e' || *r->p == 'E')) {
+        r->p++;
+        if (r->p < r->end && (*r->p == '+' || *r->p == '-'))
+            r->p++;
+        if (digits(r) != 0)
+            return -1;
+    }
+    return 0;
+}
+
+static uint32_t value(struct reader *r);
+
+/* Dizi veya nesnenin elemanları; object ise her elemandan önce anahtar */
+static int members(struct reader *r, uint32_t parent, int object, char close)
+{
+    uint32_t last = 0, v, key = 0, key_length = 0;
+
+    if (++r->depth > TURKC_JSON_MAX_DEPTH)
+        return -1;
+    r->p++;
+    skip_ws(r);
+    if (r->p < r->end && *r->p == close) {
+        r->p++;
+        r->depth--;
+        return 0;
+    }
+    for (;;) {
+        skip_ws(r);
+        if (object) {
+            if (r->p == r->end || *r->p != '"')
+                return -1;
+            key = (uint32_t)(r->p - r->src) + 1;
+            if (string_end(r) != 0)
+                return -1;
+            key_length = (uint32_t)(r->p - r->src) - 1 - key;
+            skip_ws(r);
+            if (r->p == r->end || *r->p != ':')
+                return -1;
+            r->p++;
+        }
+        v = value(r);
+        if (!v)
+            return -1;
+        r->js->vals[v].key = key;
+        r->js->vals[v].key_length = key_length;
+        if (last)
+            r->js->vals[last].next = v;
+        else
+            r->js->vals[parent].child = v;
+        last = v;
+        skip_ws(r);
+        if (r->p < r->end && *r->p == ',') {
+            r->p++;
+            continue;
+        }
+        if (r->p < r->end && *r->p == close) {
+            r->p++;
+            r->depth--;
+            return 0;
+        }
+        return -1;
+    }
+}
+
+static uint32_t value(struct reader *r)
+{
+    uint32_t v;
+    int rc;
+
+    skip_ws(r);
+    if (r->p == r->end)
+        return 0;
+    switch (*r->p) {
+    case '{':
+        if (!(v = add(r, TURKC_JSON_OBJECT)))
+            return 0;
+        rc = members(r, v, 1, '}');
+        break;
+    case '[':
+        if (!(v = add(r, TURKC_JSON_ARRAY)))
+            return 0;
+        rc = members(r, v, 0, ']');
+        break;
+    case '"':
+        if (!(v = add(r, TURKC_JSON_STRING)))
+            return 0;
+        rc = string_end(r);
+        break;
+    case 't':
+        if (!(v = add(r, TURKC_JSON_TRUE)))
+            return 0;
+        rc = literal(r, "true");
+        break;
+    case 'f':
+        if (!(v = add(r, TURKC_JSON_FALSE)))
+            return 0;
+        rc = literal(r, "false");
+        break;
+    case 'n':
+        if (!(v = add(r, TURKC_JSON_NULL)))
+            return 0;
+        rc = literal(r, "null");
+        break;
+    default:
+        if (!(v = add(r, TURKC_JSON_NUMBER)))
+            return 0;
+        rc = number(r);
+        break;
+    }
+    if (rc != 0)
+        return 0;
+    r->js->vals[v].length = (uint32_t)(r->p - r->src) - r->js->vals[v].start;
+    return v;
+}
+
+int turkc_json_parse(struct turkc_json *js, const char *src, size_t len)
+{
+    struct reader r;
+
+    if (len > UINT32_MAX - 1)
+        return -1;
+    js->src = src;
+    js->count = 1;
+    r.js = js;
+    r.src = r.p = src;
+    r.end = src + len;
+    r.depth = 0;
+    if (value(&r) != 1)
+        return -1;
+    skip_ws(&r);
+    return r.p == r.end ? 0 : -1;
+}
+
+void turkc_json_free(struct turkc_json *js)
+{
+    free(js->vals);
+    memset(js, 0, sizeof(*js));
+}
+
+uint32_t turkc_json_get(const struct turkc_json *js, uint32_t obj, const char *key)
+{
+    size_t n = strlen(key);
+    uint32_t v;
+
+    if (!obj || js->vals[obj].type != TURKC_JSON_OBJECT)
+        return 0;
+    for (v = js->vals[obj].child; v; v = js->vals[v].next)
+        if (js->vals[v].key_length == n && memcmp(js->src + js->vals[v].key, key, n) == 0)
+            return v;
+    return 0;
+}
+
+long long turkc_json_int(const struct turkc_json *js, uint32_t v, long long def)
+{
+    char buf[32];
+    size_t n;
+
+    if (!v || js->vals[v].type != TURKC_JSON_NUMBER)
+        return def;
+    n = js->vals[v].length < sizeof(buf) - 1 ? js->vals[v].length : sizeof(buf) - 1;
+    memcpy(buf, js->src + js->vals[v].start, n);
+    buf[n] = '\0';
+    return strtoll(buf, NULL, 10);
+}
+
+int turkc_json_equals(const struct turkc_json *js, uint32_t v, const char *s)
+{
+    size_t n = strlen(s);
+
+    return v && js->vals[v].type == TURKC_JSON_STRING && js->vals[v].length == n + 2 &&
+           memcmp(js->src + js->vals[v].start + 1, s, n) == 0;
+}
+
+static int hex4(const char *p, unsigned *out)
+{
+    unsigned x = 0, d;
+    int i;
+
+    for (i = 0; i < 4; i++) {
+        if (p[i] >= '0' && p[i] <= '9')
+            d = p[i] - '0';
+        else if ((p[i] | 0x20) >= 'a' && (p[i] | 0x20) <= 'f')
+            d = (p[i] | 0x20) - 'a' + 10;
+        else
+            return -1;
+        x = x << 4 | d;
+    }
+    *out = x;
+    return 0;
+}
+
+static char *utf8(char *q, unsigned c)
+{
+    if (c < 0x80) {
+        *q++ = (char)c;
+    } else if (c < 0x800) {
+        *q++ = (char)(0xc0 | c >> 6);
+        *q++ = (char)(0x80 | (c & 0x3f));
+    } else if (c < 0x10000) {
+        *q++ = (char)(0xe0 | c >> 12);
+        *q++ = (char)(0x80 | (c >> 6 & 0x3f));
+        *q++ = (char)(0x80 | (c & 0x3f));
+    } else {
+        *q++ = (char)(0xf0 | c >> 18);
+        *q++ = (char)(0x80 | (c >> 12 & 0x3f));
+        *q++ = (char)(0x80 | (c >> 6 & 0x3f));
+        *q++ = (char)(0x80 | (c & 0x3f));
+    }
+    return q;
+}
+
+char *turkc_json_string(const struct turkc_json *js, uint32_t v, size_t *len)
+{
+    const char *p, *end;
+    char *out, *q;
+    unsigned c, lo;
+
+    if (!v || js->vals[v].type != TURKC_JSON_STRING)
+        return NULL;
+    p = js->src + js->vals[v].start + 1;
+    end = js->src + js->vals[v].start + js->vals[v].length - 1;
+    /* çözülmüş metin hiçbir zaman ham metinden uzun değildir */
+    out = malloc(end - p + 1);
+    if (!out)
+        return NULL;
+    for (q = out; p < end; p++) {
+        if (*p != '\\') {
+            *q++ = *p;
+            continue;
+        }
+        switch (*++p) {
+        case 'b': *q++ = '\b'; break;
+        case 'f': *q++ = '\f'; break;
+        case 'n': *q++ = '\n'; break;
+        case 'r': *q++ = '\r'; break;
+        case 't': *q++ = '\t'; break;
+        case 'u':
+            if (end - p < 5 || hex4(p + 1, &c) != 0)
+                goto bad;
+            p += 4;
+            /* vekil çifti */
+            if (c >= 0xd800 && c < 0xdc00 && end - p >= 7 && p[1] == '\\' && p[2] == 'u' &&
+                hex4(p + 3, &lo) == 0 && lo >= 0xdc00 && lo < 0xe000) {
+                c = 0x10000 + ((c - 0xd800) << 10) + (lo - 0xdc00);
+                p += 6;
+            }
+            q = utf8(q, c);
+            break;
+        default:
+            *q++ = *p;
+            break;
+        }
+    }
+    *q = '\0';
+    if (len)
+        *len = q - out;
+    return out;
+
+bad:
+    free(out);
+    return NULL;
+}
+
+/* ---- Yazıcı ---- */
+
+char *turkc_json_reserve(struct turkc_json_buf *b, size_t n)
+{
+    size_t cap;
+    char *p;
+
+    if (b->oom)
+        return NULL;
+    if (b->cap - b->len < n) {
+        cap = b->cap ? b->cap : 4096;
+        while (cap - b->len < n)
+            cap *= 2;
+        p = realloc(b->data, cap);
+        if (!p) {
+            b->oom = 1;
+            return NULL;
+        }
+        b->data = p;
+        b->cap = cap;
+    }
+    return b->data + b->len;
+}
+
+void turkc_json_put(struct turkc_json_buf *b, const char *s, size_t n)
+{
+    char *p = turkc_json_reserve(b, n);
+
+    if (p) {
+        memcpy(p, s, n);
+        b->len += n;
+    }
+}
+
+void turkc_json_puts(struct turkc_json_buf *b, const char *s)
+{
+    turkc_json_put(b, s, strlen(s));
+}
+
+void turkc_json_printf(struct turkc_json_buf *b, const char *fmt, ...)
+{
+    va_list ap;
+    char *p;
+    int n;
+
+    va_start(ap, fmt);
+    n = vsnprintf(NULL, 0, fmt, ap);
+    va_end(ap);
+    if (n < 0 || !(p = turkc_json_reserve(b, (size_t)n + 1)))
+        return;
+    va_start(ap, fmt);
+    vsnprintf(p, (size_t)n + 1, fmt, ap);
+    va_end(ap);
+    b->len += n;
+}
+
+void turkc_json_quote(struct turkc_json_buf *b, const char *s, size_t n)
+{
+    static const char hex[] = "0123456789abcdef";
+    const char *end = s + n;
+    unsigned char c;
+    char *p;
+
+    /* en kötü durum: her byte \u00XX */
+    if (!(p = turkc_json_reserve(b, n * 6 + 2)))
+        return;
+    *p++ = '"';
+    for (; s < end; s++) {
+        c = (unsigned char)*s;
+        if (c == '"' || c == '\\') {
+            *p++ = '\\';
+            *p++ = (char)c;
+        } else if (c == '\n') {
+            *p++ = '\\';
+            *p++ = 'n';
+        } else if (c < 0x20 || c == 0x7f) {
+            *p++ = '\\';
+            *p++ = 'u';
+            *p++ = '0';
+            *p++ = '0';
+            *p++ = hex[c >> 4];
+            *p++ = hex[c & 15];
+        } else {
+            *p++ = (char)c;
+        }
+    }
+    *p++ = '"';
+    b->len = p - b->data;
+}
+
+void turkc_json_raw(struct turkc_json_buf *b, const struct turkc_json *js, uint32_t v)
+{
+    if (v)
+        turkc_json_put(b, js->src + js->vals[v].start, js->vals[v].length);
+    else
+        turkc_json_puts(b, "null");
+}
+
+void turkc_json_buf_free(struct turkc_json_buf *b)
+{
+    free(b->data);
+    memset(b, 0, sizeof(*b));
+}
@@ -0,0 +1,96 @@
+#ifndef TURKC_JSON_H
+#define TURKC_JSON_H
+
+/* LSP sunucusu (turkc_lsp.h) için küçük JSON okuyucu ve yazıcı.
+ *
+ * Okuyucu metni kopyalamaz: değerler tek bir dizide durur, kaynaktaki
+ * aralıklarını ve birbirlerini 32 bit indeksle gösterir (0: yok, kök 1).
+ * Dizi ve nesne elemanları child ve next ile bağlıdır; nesne üyesinin
+ * anahtarı değerin key alanındadır. String'ler istenince çözülür.
+ *
+ *   struct turkc_json js = {0};
+ *   if (turkc_json_parse(&js, msg, len) == 0)
+ *       id = turkc_json_get(&js, 1, "id");
+ *
+ * Yazıcı büyüyen bir buffer'a ekler; bellek yetmezse oom kurulur ve
+ * sonraki eklemeler yok sayılır.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum turkc_json_type {
+    TURKC_JSON_NULL,
+    TURKC_JSON_FALSE,
+    TURKC_JSON_TRUE,
+    TURKC_JSON_NUMBER,
+    TURKC_JSON_STRING,
+    TURKC_JSON_ARRAY,
+    TURKC_JSON_OBJECT
+};
+
+#define TURKC_JSON_MAX_DEPTH 256
+
+struct turkc_json_value {
+    uint8_t type;
+    uint32_t start, length;     /* kaynaktaki ham metin (string'de tırnaklarla) */
+    uint32_t key, key_length;   /* nesne üyesinde anahtar (tırnaksız, ham) */
+    uint32_t child, next;       /* ilk eleman, sonraki kardeş */
+};
+
+struct turkc_json {
+    const char *src;
+    struct turkc_json_value *vals;      /* vals[0] kullanılmaz */
+    uint32_t count, cap;
+};
+
+/* src'yi ayrıştırır (src yaşadıkça geçerli). Başarıda 0; sözdizim
+ * hatasında, çok derin iç içelikte veya bellek yetmezse -1. js tekrar
+ * kullanılabilir, dizi korunur.
+ */
+int turkc_json_parse(struct turkc_json *js, const char *src, size_t len);
+void turkc_json_free(struct turkc_json *js);
+
+/* Nesnenin key üyesi, yoksa (veya obj nesne değilse) 0 */
+uint32_t turkc_json_get(const struct turkc_json *js, uint32_t obj, const char *key);
+
+/* Tamsayı değer, sayı değilse def */
+long long turkc_json_int(const struct turkc_json *js, uint32_t v, long long def);
+
+/* String değer s'ye eşit mi (kaçışsız karşılaştırma) */
+int turkc_json_equals(const struct turkc_json *js, uint32_t v, const char *s);
+
+/* Çözülmüş string (malloc, NUL ile biter), string değilse veya bellek
+ * yetmezse NULL. \uXXXX UTF-8'e çevrilir.
+ */
+char *turkc_json_string(const struct turkc_json *js, uint32_t v, size_t *len);
+
+struct turkc_json_buf {
+    char *data;
+    size_t len, cap;
+    int oom;
+};
+
+/* n byte'lık yer ayırır ve başını verir (len değişmez), yetmezse NULL */
+char *turkc_json_reserve(struct turkc_json_buf *b, size_t n);
+void turkc_json_put(struct turkc_json_buf *b, const char *s, size_t n);
+void turkc_json_puts(struct turkc_json_buf *b, const char *s);
+void turkc_json_printf(struct turkc_json_buf *b, const char *fmt, ...);
+
+/* s'yi tırnaklı ve kaçışlı JSON string'i olarak yazar */
+void turkc_json_quote(struct turkc_json_buf *b, const char *s, size_t n);
+
+/* v'nin ham metnini olduğu gibi yazar (örn. istek id'si) */
+void turkc_json_raw(struct turkc_json_buf *b, const struct turkc_json *js, uint32_t v);
+
+void turkc_json_buf_free(struct turkc_json_buf *b);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
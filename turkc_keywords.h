@@ -0,0 +1,55 @@
+/* Bu dosya gen_keywords.c tarafından üretilir, elle değiştirmeyin. */
+#ifndef TURKC_KEYWORDS_H
+#define TURKC_KEYWORDS_H
+
+#include <stddef.h>
+#include <string.h>
+
+#include "turkc_token.h"
+
+#define TURKC_KEYWORD_MIN_LEN 3
+#define TURKC_KEYWORD_MAX_LEN 7
+
+/* Metin tabloda durur: hash'ten sonra tek bir cache satırı okunur */
+static const struct {
+    char text[7];
+    unsigned char length, kind;
+} turkc_keyword_table[16] = {
+    [0] = { "eger", 4, TK_EGER },
+    [4] = { "icin", 4, TK_ICIN },
+    [9] = { "dondur", 6, TK_DONDUR },
+    [10] = { "int", 3, TK_INT },
+    [11] = { "void", 4, TK_VOID },
+    [12] = { "iken", 4, TK_IKEN },
+    [15] = { "degilse", 7, TK_DEGILSE },
+};
+
+/* Identifier ise TK_IDENTIFIER, anahtar kelime ise türü. Tek hash,
+ * tek karşılaştırma; s NUL ile bitmek zorunda değil.
+ */
+static inline int turkc_keyword(const char *s, size_t len)
+{
+    const char *k;
+    unsigned h;
+    int eq;
+
+    if (len < TURKC_KEYWORD_MIN_LEN || len > TURKC_KEYWORD_MAX_LEN)
+        return TK_IDENTIFIER;
+    h = ((unsigned char)s[0] * 1u + (unsigned char)s[1] * 3u +
+         (unsigned char)s[len - 1] + (unsigned)len) & 15u;
+    if (turkc_keyword_table[h].length != len)
+        return TK_IDENTIFIER;
+    /* sabit boylu memcmp'ler çağrı yerine birkaç load/compare olur */
+    k = turkc_keyword_table[h].text;
+    switch (len) {
+    case 3: eq = memcmp(k, s, 3) == 0; break;
+    case 4: eq = memcmp(k, s, 4) == 0; break;
+    case 5: eq = memcmp(k, s, 5) == 0; break;
+    case 6: eq = memcmp(k, s, 6) == 0; break;
+    case 7: eq = memcmp(k, s, 7) == 0; break;
+    default: eq = 0;
+    }
+    return eq ? turkc_keyword_table[h].kind : TK_IDENTIFIER;
+}
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef TURKC_LEXER_H
+#define TURKC_LEXER_H
+
+/* Gömülebilir TurkC lexer API'si (scanner.l, %option reentrant).
+ *
+ * Her turkc_lexer kendi flex durumunu taşır; global değişken yoktur.
+ * Farklı lexer'lar farklı thread'lerde aynı anda kullanılabilir,
+ * tek bir lexer ise aynı anda sadece bir thread'den kullanılmalıdır.
+ *
+ *   turkc_lexer *lx = turkc_lexer_open(stdin);
+ *   struct turkc_token tok;
+ *   while (turkc_lexer_next(lx, &tok) > 0)
+ *       printf("%s: %s\n", turkc_token_category(tok.kind), tok.text);
+ *   turkc_lexer_close(lx);
+ *
+ * turkc_lexer_open_fd/open_path normal dosyaları mmap ile açar: flex
+ * sayfaları yerinde tarar, tok.text ve tok.offset mapping'i gösterir.
+ * Pipe ve terminal girişinde otomatik olarak stream okumaya döner.
+ *
+ * String ve yorumlar parça parça okunur: kapanmasalar da giriş bir kez
+ * taranır ve flex buffer'ı büyümez (stream okumada sadece string metni
+ * kendi boyunda bir buffer'da birleştirilir).
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+
+#include "turkc_token.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct turkc_lexer turkc_lexer;
+
+struct turkc_token {
+    int kind;                   /* enum turkc_token_kind */
+    const char *text;           /* NUL ile biten lexeme, sonraki next'e kadar geçerli */
+    size_t length;
+    unsigned long offset;       /* girişteki byte ofseti */
+    unsigned long line;         /* 1'den başlar */
+    unsigned long column;       /* 1'den başlar, satır başından byte sayısı + 1 */
+};
+
+/* FILE'dan okuyan lexer; dosyayı kapatmak çağırana aittir */
+turkc_lexer *turkc_lexer_open(FILE *in);
+
+/* Bellekteki kaynağı tarar (kopyasını alır) */
+turkc_lexer *turkc_lexer_open_string(const char *src, size_t len);
+
+/* buf[0..len) kopyalanmadan taranır; buf[len] ve buf[len + 1] '\0' olmalı,
+ * len en fazla INT_MAX - 2 olabilir. flex tarama sırasında buffer'a geçici
+ * NUL'lar yazar: buffer close'a kadar başka bir lexer'la paylaşılmamalı.
+ * Giriş bitmeden kapatılırsa son token'ın bittiği byte '\0' olarak kalır.
+ */
+turkc_lexer *turkc_lexer_open_buffer(char *buf, size_t len);
+
+/* fd'den okuyan lexer. fd normal bir dosyaysa mmap edilir (kopyasız),
+ * değilse fd'nin kopyası üzerinden stream okunur. fd çağırana aittir,
+ * open_fd döndükten sonra kapatılabilir.
+ */
+turkc_lexer *turkc_lexer_open_fd(int fd);
+
+/* Dosyayı açıp turkc_lexer_open_fd ile okur; açılamazsa NULL (errno) */
+turkc_lexer *turkc_lexer_open_path(const char *path);
+
+/* Map'lenen kaynak ve boyu; stream okumada NULL döner.
+ * Token ofsetleri bu adrese göredir, close'a kadar geçerlidir. flex son
+ * token'ın bittiği byte'a sonraki next çağrısına kadar '\0' yazar.
+ */
+const char *turkc_lexer_source(const turkc_lexer *lx, size_t *len);
+
+/* Sonraki token: tok->kind (> 0) döner, giriş bitince 0 (TK_EOF),
+ * hata olursa -1 (bkz. turkc_lexer_error). Kapanmayan string/yorum da
+ * hatadır ("kapanmamis string", "kapanmamis yorum"); hatada tok->offset,
+ * line ve column literal'in başını gösterir. Hatadan sonra lexer
+ * kullanılamaz.
+ */
+int turkc_lexer_next(turkc_lexer *lx, struct turkc_token *tok);
+
+/* Son hatanın mesajı, hata yoksa NULL */
+const char *turkc_lexer_error(const turkc_lexer *lx);
+
+void turkc_lexer_close(turkc_lexer *lx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,596 @@
+/* Döngü geçişleri: licm, ivsr, unroll (turkc_opt.h).
+ *
+ * Döngüler geri kenarlardan bulunur: t -> h kenarında h t'ye baskınsa h
+ * döngü başlığı, t arka bloktur. Döngünün blokları arka bloklardan h'ye
+ * kadar geriye doğru ulaşılan bloklardır. Başlıklar ters sonradan sıranın
+ * tersinde gezilir, böylece iç döngü dıştakinden önce gelir. Her geçiş
+ * önce her döngüye bir önbaşlık verir: başlığın döngü dışındaki tek
+ * öncülü, jmp ile biter.
+ */
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "turkc_opt.h"
+
+/* Açılan kopyaların toplam komut sınırı (döngü başına) */
+#define UNROLL_MAX_INSNS        256
+
+struct loops {
+    struct turkc_ir_func *f;
+    uint32_t *headers, nheaders;    /* iç döngüler önce */
+    uint32_t *in, stamp;            /* in[b] == stamp: b şu anki döngüde */
+    uint32_t *body, nbody;          /* şu anki döngünün blokları */
+    uint32_t latch, nlatches;       /* arka bloklar; latch sonuncusu */
+    uint32_t *tmp;
+};
+
+static void loops_free(struct loops *l)
+{
+    free(l->headers);
+    free(l->in);
+    free(l->body);
+    free(l->tmp);
+}
+
+/* Döngü başlıklarını bulur; bellek yetmezse -1 */
+static int loops_find(struct loops *l, struct turkc_ir_func *f)
+{
+    uint32_t i, j, b, p, n;
+
+    turkc_ir_prune(f);
+    turkc_ir_dominators(f);
+    n = f->nblocks;
+    free(l->headers);
+    free(l->in);
+    free(l->body);
+    free(l->tmp);
+    l->f = f;
+    l->nheaders = l->stamp = 0;
+    l->in = l->body = l->tmp = NULL;
+    if (!(l->headers = malloc(n * sizeof(*l->headers))))
+        goto oom;
+    for (i = f->norder; i-- > 0;) {
+        b = f->order[i];
+        for (j = 0; j < f->blocks[b].npreds; j++) {
+            p = f->preds[f->blocks[b].preds + j];
+            if (turkc_ir_dominates(f, b, p)) {
+                l->headers[l->nheaders++] = b;
+                break;
+            }
+        }
+    }
+    /* loops_prepare döngü başına en çok bir blok ekler */
+    n += l->nheaders;
+    l->in = calloc(n, sizeof(*l->in));
+    l->body = malloc(n * sizeof(*l->body));
+    l->tmp = malloc(n * sizeof(*l->tmp));
+    if (l->in && l->body && l->tmp)
+        return 0;
+
+oom:
+    f->oom = 1;
+    return -1;
+}
+
+/* Başlığı h olan döngünün bloklarını body'ye yazar ve in'de işaretler */
+static void loop_body(struct loops *l, uint32_t h)
+{
+    struct turkc_ir_func *f = l->f;
+    uint32_t sp = 0, b, p, j;
+
+    l->stamp++;
+    l->in[h] = l->stamp;
+    l->body[0] = h;
+    l->nbody = 1;
+    l->latch = l->nlatches = 0;
+    for (j = 0; j < f->blocks[h].npreds; j++) {
+        p = f->preds[f->blocks[h].preds + j];
+        if (!turkc_ir_dominates(f, h, p))
+            continue;
+        if (p != l->latch)
+            l->nlatches++;
+        l->latch = p;
+        if (l->in[p] != l->stamp) {
+            l->in[p] = l->stamp;
+            l->body[l->nbody++] = p;
+            l->tmp[sp++] = p;
+        }
+    }
+    while (sp) {
+        b = l->tmp[--sp];
+        for (j = 0; j < f->blocks[b].npreds; j++) {
+            p = f->preds[f->blocks[b].preds + j];
+            if (l->in[p] != l->stamp) {
+                l->in[p] = l->stamp;
+                l->body[l->nbody++] = p;
+                l->tmp[sp++] = p;
+            }
+        }
+    }
+}
+
+static int by_rpo(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+/* body'yi ters sonradan sıraya koyar: tanımlar kullanımlardan önce gelir */
+static void sort_body(struct loops *l)
+{
+    uint32_t i;
+
+    for (i = 0; i < l->nbody; i++)
+        l->body[i] = l->f->blocks[l->body[i]].rpo;
+    qsort(l->body, l->nbody, sizeof(*l->body), by_rpo);
+    for (i = 0; i < l->nbody; i++)
+        l->body[i] = l->f->order[l->body[i] - 1];
+}
+
+/* loop_body'den sonra: önbaşlık, yoksa 0 */
+static uint32_t preheader(const struct loops *l, uint32_t h)
+{
+    const struct turkc_ir_func *f = l->f;
+    uint32_t j, p, found = 0;
+
+    for (j = 0; j < f->blocks[h].npreds; j++) {
+        p = f->preds[f->blocks[h].preds + j];
+        if (l->in[p] == l->stamp)
+            continue;
+        if (found || f->blocks[p].succ[1])
+            return 0;
+        found = p;
+    }
+    return found;
+}
+
+/* Dış öncülleri yeni bir bloğa yönlendirir; phi'lerin dıştan gelen
+ * işlenenleri o blokta bir phi'de toplanır. preds'i günceller.
+ */
+static uint32_t make_preheader(struct loops *l, uint32_t h)
+{
+    struct turkc_ir_func *f = l->f;
+    uint32_t n = 0, j, k, p, ph, i, q;
+
+    for (j = 0; j < f->blocks[h].npreds; j++) {
+        p = f->preds[f->blocks[h].preds + j];
+        for (k = 0; k < n && l->tmp[k] != p; k++)
+            ;
+        if (l->in[p] != l->stamp && k == n)
+            l->tmp[n++] = p;
+    }
+    /* giriş bloğu başlıksa dış öncül yoktur */
+    if (n == 0)
+        return 0;
+    ph = turkc_ir_block_new(f);
+    if (!ph || !turkc_ir_insert(f, ph, 0, IR_JMP, 0, 0))
+        return 0;
+    f->blocks[ph].succ[0] = h;
+    for (i = f->blocks[h].first; f->insns[i].op == IR_PHI; i = f->insns[i].next) {
+        if (n == 1) {
+            for (j = 0; j < f->insns[i].nargs; j++) {
+                if (f->uses[f->insns[i].args + j].block == l->tmp[0])
+                    f->uses[f->insns[i].args + j].block = ph;
+            }
+            continue;
+        }
+        q = turkc_ir_insert(f, ph, f->blocks[ph].first, IR_PHI, f->insns[i].k, 0);
+        if (!q)
+            return 0;
+        f->insns[q].node = f->insns[i].node;
+        for (k = 0; k < n; k++) {
+            turkc_ir_phi_add(f, q, l->tmp[k], turkc_ir_phi_value(f, i, l->tmp[k]));
+            turkc_ir_phi_drop(f, i, l->tmp[k]);
+        }
+        turkc_ir_phi_add(f, i, ph, q);
+    }
+    for (k = 0; k < n; k++) {
+        for (j = 0; j < 2; j++) {
+            if (f->blocks[l->tmp[k]].succ[j] == h)
+                f->blocks[l->tmp[k]].succ[j] = ph;
+        }
+    }
+    turkc_ir_cfg(f);
+    return f->oom ? 0 : ph;
+}
+
+/* Başlıkları bulur ve önbaşlığı olmayan döngülere ekler; sonra baskınlık
+ * bilgisi günceldir. Bellek yetmezse -1.
+ */
+static int loops_prepare(struct loops *l, struct turkc_ir_func *f)
+{
+    uint32_t i, made = 0;
+
+    if (loops_find(l, f) != 0)
+        return -1;
+    for (i = 0; i < l->nheaders; i++) {
+        loop_body(l, l->headers[i]);
+        if (preheader(l, l->headers[i]))
+            continue;
+        if (make_preheader(l, l->headers[i]))
+            made = 1;
+        else if (f->oom)
+            return -1;
+    }
+    return made ? loops_find(l, f) : 0;
+}
+
+static int invariant(const struct loops *l, uint32_t v)
+{
+    return l->in[l->f->insns[v].block] != l->stamp;
+}
+
+/* licm: döngüde her turda aynı sonucu veren komutları önbaşlığa taşır.
+ * Etkisi olmayan (turkc_ir_has_effect) ve işlenenleri döngü dışında
+ * tanımlı komutlar taşınır; taşınan komut sonrakilerin işleneni olarak
+ * döngü dışı sayılır. Bu komutlar hata veremez, bu yüzden her turda
+ * çalışmayan bir daldan da taşınabilirler. loadg, döngüde çağrı ve aynı
+ * globale storeg yoksa taşınır. İç döngüden taşınan komut dış döngünün
+ * gövdesine düşer ve orada yeniden denenir.
+ */
+int turkc_opt_licm(const struct turkc_ir *ir, struct turkc_ir_func *f, int arg)
+{
+    struct loops l;
+    uint32_t h, ph, n, b, i, j, next, nstores;
+    int changed = 0, calls;
+
+    (void)ir;
+    (void)arg;
+    memset(&l, 0, sizeof(l));
+    if (loops_prepare(&l, f) != 0)
+        goto out;
+    for (h = 0; h < l.nheaders; h++) {
+        loop_body(&l, l.headers[h]);
+        if (!(ph = preheader(&l, l.headers[h])))
+            continue;
+        sort_body(&l);
+        /* yazılan globaller tmp'ye */
+        calls = 0;
+        nstores = 0;
+        for (n = 0; n < l.nbody; n++) {
+            for (i = f->blocks[l.body[n]].first; i; i = f->insns[i].next) {
+                if (f->insns[i].op == IR_CALL)
+                    calls = 1;
+                else if (f->insns[i].op == IR_STOREG && nstores < f->nblocks)
+                    l.tmp[nstores++] = (uint32_t)f->insns[i].k;
+            }
+        }
+        for (n = 0; n < l.nbody; n++) {
+            b = l.body[n];
+            for (i = f->blocks[b].first; i; i = next) {
+                next = f->insns[i].next;
+                if (f->insns[i].op == IR_PHI || turkc_ir_is_void(f->insns[i].op) ||
+                    turkc_ir_has_effect(f, i))
+                    continue;
+                if (f->insns[i].op == IR_LOADG) {
+                    for (j = 0; j < nstores && l.tmp[j] != (uint32_t)f->insns[i].k; j++)
+                        ;
+                    if (calls || j < nstores || nstores == f->nblocks)
+                        continue;
+                }
+                for (j = 0; j < f->insns[i].nargs; j++) {
+                    if (!invariant(&l, f->uses[f->insns[i].args + j].value))
+                        break;
+                }
+                if (j < f->insns[i].nargs)
+                    continue;
+                turkc_ir_move(f, i, ph, f->blocks[ph].last);
+                changed = 1;
+            }
+        }
+    }
+
+out:
+    loops_free(&l);
+    return changed;
+}
+
+/* Başlıktaki phi temel tümevarım değişkeni mi: [önbaşlık: ilk],
+ * [arka blok: phi + c veya phi - c], c sabit. Öyleyse artışı yapan komut,
+ * değilse 0.
+ */
+static uint32_t induction(const struct loops *l, uint32_t phi, uint32_t ph, int32_t *step)
+{
+    const struct turkc_ir_func *f = l->f;
+    const struct turkc_ir_insn *in;
+    uint32_t next, a, b;
+
+    if (f->insns[phi].op != IR_PHI || f->insns[phi].nargs != 2 || l->nlatches != 1)
+        return 0;
+    if (!turkc_ir_phi_value(f, phi, ph) || !(next = turkc_ir_phi_value(f, phi, l->latch)))
+        return 0;
+    in = &f->insns[next];
+    if ((in->op != IR_ADD && in->op != IR_SUB) || invariant(l, next))
+        return 0;
+    a = f->uses[in->args].value;
+    b = f->uses[in->args + 1].value;
+    if (in->op == IR_ADD && b == phi) {
+        b = a;
+        a = phi;
+    }
+    if (a != phi || f->insns[b].op != IR_CONST)
+        return 0;
+    *step = in->op == IR_ADD ? f->insns[b].k : (int32_t)(0u - (uint32_t)f->insns[b].k);
+    return next;
+}
+
+/* a op b'yi block'ta before'dan önce kurar */
+static uint32_t binary(struct turkc_ir_func *f, uint32_t block, uint32_t before, int op,
+                       uint32_t a, uint32_t b, uint32_t node)
+{
+    uint32_t i = turkc_ir_insert(f, block, before, op, 0, 2);
+
+    if (i) {
+        turkc_ir_set_arg(f, i, 0, a);
+        turkc_ir_set_arg(f, i, 1, b);
+        f->insns[i].node = node;
+    }
+    return i;
+}
+
+/* ivsr: tümevarım değişkeninin sabit adımla değiştiği döngüde i * k
+ * (k döngü dışında tanımlı) yerine yeni bir değişken tutulur: önbaşlıkta
+ * ilk * k ile başlar, her turda adım * k eklenir. Çarpma toplamaya
+ * döner; 32 bit taşmada da (a + b) * k = a * k + b * k olduğundan sonuç
+ * aynıdır. Aynı k için tek değişken kurulur.
+ */
+int turkc_opt_ivsr(const struct turkc_ir *ir, struct turkc_ir_func *f, int arg)
+{
+    struct loops l;
+    uint32_t h, ph, iv, next, u, user, k, j, nk, c, init, step, phi, upd, x;
+    int32_t s;
+    int changed = 0;
+
+    (void)ir;
+    (void)arg;
+    memset(&l, 0, sizeof(l));
+    if (loops_prepare(&l, f) != 0)
+        goto out;
+    for (h = 0; h < l.nheaders && !f->oom; h++) {
+        loop_body(&l, l.headers[h]);
+        if (!(ph = preheader(&l, l.headers[h])))
+            continue;
+        for (iv = f->blocks[l.headers[h]].first; f->insns[iv].op == IR_PHI; iv = f->insns[iv].next) {
+            if (!(next = induction(&l, iv, ph, &s)))
+                continue;
+            /* tmp: (k, yeni phi) çiftleri */
+            nk = 0;
+            for (u = f->insns[iv].uses; u; u = x) {
+                x = f->uses[u].next;
+                user = f->uses[u].user;
+                if (f->insns[user].op != IR_MUL || invariant(&l, user))
+                    continue;
+                k = f->uses[f->insns[user].args].value;
+                if (k == iv)
+                    k = f->uses[f->insns[user].args + 1].value;
+                if (k == iv || !invariant(&l, k))
+                    continue;
+                for (j = 0; j < nk && l.tmp[j] != k; j += 2)
+                    ;
+                if (j == nk) {
+                    if (nk + 2 > f->nblocks)
+                        continue;
+                    init = binary(f, ph, f->blocks[ph].last, IR_MUL,
+                                  turkc_ir_phi_value(f, iv, ph), k, f->insns[user].node);
+                    c = turkc_ir_insert(f, ph, f->blocks[ph].last, IR_CONST, s, 0);
+                    step = c ? binary(f, ph, f->blocks[ph].last, IR_MUL, c, k, f->insns[user].node) : 0;
+                    phi = turkc_ir_insert(f, l.headers[h], f->blocks[l.headers[h]].first, IR_PHI,
+                                          f->insns[iv].k, 0);
+                    upd = phi && step ? binary(f, f->insns[next].block, f->insns[next].next, IR_ADD,
+                                               phi, step, f->insns[next].node) : 0;
+                    if (!init || !upd)
+                        goto out;
+                    turkc_ir_phi_add(f, phi, ph, init);
+                    turkc_ir_phi_add(f, phi, l.latch, upd);
+                    l.tmp[nk++] = k;
+                    l.tmp[nk++] = phi;
+                }
+                turkc_ir_replace(f, user, l.tmp[j + 1]);
+                turkc_ir_remove(f, user);
+                changed = 1;
+            }
+        }
+    }
+
+out:
+    loops_free(&l);
+    return changed;
+}
+
+/* Sayılan döngünün tur sayısı: başlıkta tek koşul "iv op sabit", iv
+ * sabitten başlar ve sabit adımla ilerler, değerleri int'te kalır. Değilse
+ * -1.
+ */
+static int64_t trip_count(const struct loops *l, uint32_t h, uint32_t ph)
+{
+    const struct turkc_ir_func *f = l->f;
+    uint32_t br = f->blocks[h].last, cond, a, b, iv;
+    int64_t init, bound, step, n, last;
+    int32_t s;
+    int op;
+
+    if (f->insns[br].op != IR_BR || l->in[f->blocks[h].succ[0]] != l->stamp ||
+        l->in[f->blocks[h].succ[1]] == l->stamp)
+        return -1;
+    cond = f->uses[f->insns[br].args].value;
+    op = f->insns[cond].op;
+    if (op < IR_LT || op > IR_GE || f->insns[cond].block != h)
+        return -1;
+    a = f->uses[f->insns[cond].args].value;
+    b = f->uses[f->insns[cond].args + 1].value;
+    if (f->insns[a].op == IR_CONST) {
+        /* sabit op iv -> iv op' sabit */
+        iv = a;
+        a = b;
+        b = iv;
+        op = op == IR_LT ? IR_GT : op == IR_GT ? IR_LT : op == IR_LE ? IR_GE : IR_LE;
+    }
+    if (f->insns[a].block != h || f->insns[b].op != IR_CONST || !induction(l, a, ph, &s))
+        return -1;
+    iv = turkc_ir_phi_value(f, a, ph);
+    if (f->insns[iv].op != IR_CONST)
+        return -1;
+    init = f->insns[iv].k;
+    bound = f->insns[b].k;
+    step = s;
+    if (op == IR_LE || op == IR_GE)
+        bound += op == IR_LE ? 1 : -1;
+    if ((op == IR_LT || op == IR_LE) && step > 0)
+        n = init < bound ? (bound - init + step - 1) / step : 0;
+    else if ((op == IR_GT || op == IR_GE) && step < 0)
+        n = init > bound ? (init - bound - step - 1) / -step : 0;
+    else
+        return -1;
+    last = init + n * step;
+    if (last < INT32_MIN || last > INT32_MAX)
+        return -1;
+    return n;
+}
+
+/* Başlığın ve gövdenin komutlarının map kayıtlarını siler */
+static void map_clear(const struct turkc_ir_func *f, uint32_t *map, uint32_t nmap,
+                      uint32_t h, uint32_t body)
+{
+    uint32_t b, i;
+
+    for (b = h; b; b = b == h ? body : 0) {
+        for (i = f->blocks[b].first; i; i = f->insns[i].next) {
+            if (i < nmap)
+                map[i] = 0;
+        }
+    }
+}
+
+/* Bir turun komutlarını (list: başlığın phi olmayan komutları ve gövde,
+ * sonlandırıcılar hariç) block'ta before'dan önce bir kez daha kurar.
+ * map[phi] bu turun girişindeki değerlerdir; çıkışta map[phi] sonraki
+ * turunkilerdir. Diğer kayıtlar 0 (döngü dışı değer) veya bu kopyadır.
+ */
+static int copy_iteration(struct loops *l, uint32_t h, uint32_t body, uint32_t *map,
+                          const uint32_t *list, uint32_t nlist, uint32_t block, uint32_t before)
+{
+    struct turkc_ir_func *f = l->f;
+    uint32_t i, j, k, v, c, phi, n = 0;
+
+    for (k = 0; k < nlist; k++) {
+        i = list[k];
+        c = turkc_ir_insert(f, block, before, f->insns[i].op, f->insns[i].k, f->insns[i].nargs);
+        if (!c)
+            return -1;
+        f->insns[c].node = f->insns[i].node;
+        for (j = 0; j < f->insns[i].nargs; j++) {
+            v = f->uses[f->insns[i].args + j].value;
+            turkc_ir_set_arg(f, c, j, map[v] ? map[v] : v);
+        }
+        map[i] = c;
+    }
+    /* phi'lerin yeni değerleri aynı anda */
+    for (phi = f->blocks[h].first; f->insns[phi].op == IR_PHI; phi = f->insns[phi].next) {
+        v = turkc_ir_phi_value(f, phi, body);
+        l->tmp[n++] = map[v] ? map[v] : v;
+    }
+    n = 0;
+    for (phi = f->blocks[h].first; f->insns[phi].op == IR_PHI; phi = f->insns[phi].next)
+        map[phi] = l->tmp[n++];
+    return 0;
+}
+
+/* Phi'nin from'dan gelen işleneni value olur */
+static void phi_set(struct turkc_ir_func *f, uint32_t phi, uint32_t from, uint32_t value)
+{
+    uint32_t j;
+
+    for (j = 0; j < f->insns[phi].nargs; j++) {
+        if (f->uses[f->insns[phi].args + j].block == from)
+            turkc_ir_set_arg(f, phi, j, value);
+    }
+}
+
+/* unroll: tur sayısı T derlemede bilinen, gövdesi tek blok olan döngüyü
+ * arg kez açar (varsayılan TURKC_OPT_UNROLL). T % arg tur önbaşlığa
+ * kopyalanır; kalan tur sayısı arg'ın katı olduğundan koşul arg turda bir
+ * sınanır ve gövde arg kopya olur. T < arg ise tüm turlar önbaşlıktadır,
+ * döngü hiç çalışmaz ve sonraki sccp onu siler. Başlığın phi olmayan
+ * komutları da kopyalanır; kullanılmayan koşul kopyalarını dce siler.
+ * Kopyaların toplamı UNROLL_MAX_INSNS'i aşacaksa döngü açılmaz.
+ */
+int turkc_opt_unroll(const struct turkc_ir *ir, struct turkc_ir_func *f, int arg)
+{
+    struct loops l;
+    uint32_t list[UNROLL_MAX_INSNS], h, hd, ph, body, i, n, size, peel, copies, *map = NULL, nmap;
+    int64_t trips;
+    int changed = 0;
+
+    (void)ir;
+    if (arg <= 0)
+        arg = TURKC_OPT_UNROLL;
+    memset(&l, 0, sizeof(l));
+    if (arg == 1 || loops_prepare(&l, f) != 0)
+        goto out;
+    nmap = f->ninsns;
+    map = calloc(nmap, sizeof(*map));
+    if (!map) {
+        f->oom = 1;
+        goto out;
+    }
+    for (h = 0; h < l.nheaders; h++) {
+        hd = l.headers[h];
+        loop_body(&l, hd);
+        ph = preheader(&l, hd);
+        body = f->blocks[hd].succ[0];
+        if (!ph || l.nbody != 2 || l.nlatches != 1 || l.latch != body || f->insns[f->blocks[body].last].op != IR_JMP)
+            continue;
+        if ((trips = trip_count(&l, hd, ph)) <= 0)
+            continue;
+        /* başlıkta etkili komut varsa (ör. koşulda çağrı) kopyalanamaz;
+         * bu geçişte kurulan komutların map kaydı yok
+         */
+        size = 0;
+        for (i = f->blocks[hd].first; i != f->blocks[hd].last && size < UNROLL_MAX_INSNS;
+             i = f->insns[i].next) {
+            if (i >= nmap || (f->insns[i].op != IR_PHI && turkc_ir_has_effect(f, i)))
+                break;
+            if (f->insns[i].op != IR_PHI)
+                list[size++] = i;
+        }
+        if (i != f->blocks[hd].last)
+            continue;
+        for (i = f->blocks[body].first; i != f->blocks[body].last && i < nmap && size < UNROLL_MAX_INSNS;
+             i = f->insns[i].next)
+            list[size++] = i;
+        if (i != f->blocks[body].last)
+            continue;
+        peel = (uint32_t)(trips % arg);
+        copies = trips < arg ? peel : peel + (uint32_t)arg - 1;
+        if ((uint64_t)size * copies > UNROLL_MAX_INSNS)
+            continue;
+        for (i = f->blocks[hd].first; f->insns[i].op == IR_PHI; i = f->insns[i].next)
+            map[i] = turkc_ir_phi_value(f, i, ph);
+        for (n = 0; n < peel; n++) {
+            if (copy_iteration(&l, hd, body, map, list, size, ph, f->blocks[ph].last) != 0)
+                goto out;
+        }
+        for (i = f->blocks[hd].first; f->insns[i].op == IR_PHI; i = f->insns[i].next)
+            phi_set(f, i, ph, map[i]);
+        if (trips >= arg) {
+            map_clear(f, map, nmap, hd, body);
+            for (i = f->blocks[hd].first; f->insns[i].op == IR_PHI; i = f->insns[i].next)
+                map[i] = turkc_ir_phi_value(f, i, body);
+            for (n = 1; n < (uint32_t)arg; n++) {
+                if (copy_iteration(&l, hd, body, map, list, size, body, f->blocks[body].last) != 0)
+                    goto out;
+            }
+            for (i = f->blocks[hd].first; f->insns[i].op == IR_PHI; i = f->insns[i].next)
+                phi_set(f, i, body, map[i]);
+        }
+        map_clear(f, map, nmap, hd, body);
+        changed = 1;
+    }
+
+out:
+    free(map);
+    loops_free(&l);
+    return changed;
+}
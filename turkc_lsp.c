@@ -0,0 +1,1348 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "turkc_ast.h"
+#include "turkc_lsp.h"
+#include "turkc_parse.h"
+#include "turkc_relex.h"
+#include "turkc_resolve.h"
+#include "turkc_time.h"
+#include "turkc_token.h"
+
+/* Semantik token türleri ve değiştiricileri (legend ile aynı sırada) */
+enum {
+    ST_KEYWORD, ST_FUNCTION, ST_PARAMETER, ST_VARIABLE, ST_NUMBER, ST_STRING, ST_OPERATOR,
+    ST_NONE = 0xff
+};
+
+#define SM_DECLARATION  1
+#define SM_LIBRARY      2
+
+static const char legend[] =
+    "\"legend\":{\"tokenTypes\":[\"keyword\",\"function\",\"parameter\",\"variable\","
+    "\"number\",\"string\",\"operator\"],\"tokenModifiers\":[\"declaration\","
+    "\"defaultLibrary\"]}";
+
+/* Token dizisine paralel */
+struct info {
+    uint32_t sym;               /* identifier/string sembolü, yoksa TURKC_INTERN_NONE */
+    uint8_t type, mods;
+    uint16_t pad;
+};
+
+/* Üst düzey bildirim: token'ları [tok, sonraki birimin tok'u), düğümleri
+ * [lo, hi). Ayrıştırılamayan parçada node 0'dır ve düğümü yoktur.
+ */
+struct unit {
+    uint32_t tok;
+    uint32_t node;
+    uint32_t lo, hi;
+};
+
+struct doc {
+    char *uri;
+    long long version;
+    struct turkc_relex rx;
+    struct info *info;
+    uint32_t info_cap;
+    struct turkc_ast *ast;
+    struct unit *units;
+    uint32_t nunits, units_cap;
+    uint32_t live;              /* birimlerin düğüm sayısı */
+    uint32_t broken;            /* ayrıştırılamayan birimler */
+    int parsed;                 /* birimler geçerli */
+    int has_error;
+    struct turkc_parse_error err;
+    uint32_t reparsed, reused;  /* son değişiklikte */
+    int full;
+};
+
+struct scope {
+    uint32_t sym, node;
+    uint8_t type;
+};
+
+struct turkc_lsp {
+    struct doc *docs;
+    uint32_t ndocs, docs_cap;
+    int initialized, shutdown, utf8, check;
+    unsigned long mismatches;
+    FILE *trace;
+    struct turkc_json js;
+    struct turkc_json_buf body;
+    struct turkc_json_buf *out;
+    struct scope *scope;        /* sınıflandırma ve tanım arama */
+    uint32_t nscope, scope_cap;
+    struct unit *tmp;
+    uint32_t tmp_cap;
+};
+
+static int grow(void **p, uint32_t *cap, uint32_t need, size_t size)
+{
+    uint32_t n = *cap ? *cap : 16;
+    void *q;
+
+    if (need <= *cap)
+        return 0;
+    while (n < need) {
+        if (n > UINT32_MAX / 2)
+            return -1;
+        n *= 2;
+    }
+    q = realloc(*p, (size_t)n * size);
+    if (!q)
+        return -1;
+    *p = q;
+    *cap = n;
+    return 0;
+}
+
+#define NODE(d, i)  (&(d)->ast->nodes[i])
+
+/* ---- Konumlar ---- */
+
+/* UTF-8 byte'larının UTF-16 birim sayısı */
+static unsigned long utf16_units(const char *p, size_t n)
+{
+    unsigned long units = 0;
+    size_t i;
+
+    for (i = 0; i < n; i++) {
+        unsigned char c = (unsigned char)p[i];
+
+        if ((c & 0xc0) != 0x80)
+            units += c >= 0xf0 ? 2 : 1;
+    }
+    return units;
+}
+
+/* 0'dan başlayan satırın sonu ('\n' veya metin sonu) */
+static size_t line_end(const struct turkc_relex *rx, uint32_t line)
+{
+    return line + 1 < rx->nlines ? rx->lines[line + 1] - 1 : rx->len;
+}
+
+static void position(const struct turkc_lsp *s, const struct doc *d, size_t offset,
+                     unsigned long *line, unsigned long *character)
+{
+    unsigned long l, c;
+
+    turkc_relex_position(&d->rx, offset, &l, &c);
+    *line = l - 1;
+    *character = s->utf8 ? c - 1 : utf16_units(d->rx.text + d->rx.lines[l - 1], c - 1);
+}
+
+static size_t offset_of(const struct turkc_lsp *s, const struct doc *d,
+                        long long line, long long character)
+{
+    const struct turkc_relex *rx = &d->rx;
+    size_t start, end, p;
+    long long units = 0;
+
+    if (line < 0 || character < 0)
+        return 0;
+    if (line >= rx->nlines)
+        return rx->len;
+    start = rx->lines[line];
+    end = line_end(rx, (uint32_t)line);
+    if (s->utf8)
+        return (size_t)character < end - start ? start + (size_t)character : end;
+    for (p = start; p < end && units < character; p++) {
+        unsigned char c = (unsigned char)rx->text[p];
+
+        if ((c & 0xc0) != 0x80)
+            units += c >= 0xf0 ? 2 : 1;
+    }
+    while (p < end && ((unsigned char)rx->text[p] & 0xc0) == 0x80)
+        p++;
+    return p;
+}
+
+static void put_position(struct turkc_lsp *s, const struct doc *d, size_t offset)
+{
+    unsigned long line, character;
+
+    position(s, d, offset, &line, &character);
+    turkc_json_printf(&s->body, "{\"line\":%lu,\"character\":%lu}", line, character);
+}
+
+/* offset'teki token'ın aralığı (tek satıra kırpılır), token yoksa boş */
+static void put_range(struct turkc_lsp *s, const struct doc *d, size_t offset)
+{
+    const struct turkc_relex *rx = &d->rx;
+    uint32_t t = turkc_relex_find(rx, offset);
+    unsigned long line, column;
+    size_t end = offset;
+
+    if (t < rx->ntoks && rx->toks[t].offset == offset) {
+        turkc_relex_position(rx, offset, &line, &column);
+        end = offset + rx->toks[t].length;
+        if (end > line_end(rx, (uint32_t)line - 1))
+            end = line_end(rx, (uint32_t)line - 1);
+    }
+    turkc_json_puts(&s->body, "{\"start\":");
+    put_position(s, d, offset);
+    turkc_json_puts(&s->body, ",\"end\":");
+    put_position(s, d, end);
+    turkc_json_puts(&s->body, "}");
+}
+
+/* ---- Token bilgisi ---- */
+
+static uint8_t base_type(int kind)
+{
+    if (kind >= TK_EGER && kind <= TK_VOID)
+        return ST_KEYWORD;
+    if (kind >= TK_PLUS && kind <= TK_ASSIGN)
+        return ST_OPERATOR;
+    switch (kind) {
+    case TK_IDENTIFIER: return ST_VARIABLE;
+    case TK_NUMBER:     return ST_NUMBER;
+    case TK_STRING:     return ST_STRING;
+    }
+    return ST_NONE;
+}
+
+/* info[first .. first + n)'i token'lardan doldurur */
+static int fill_info(struct doc *d, uint32_t first, uint32_t n)
+{
+    const struct turkc_relex_token *t;
+    struct info *in;
+    uint32_t i;
+
+    for (i = first; i < first + n; i++) {
+        t = &d->rx.toks[i];
+        in = &d->info[i];
+        in->type = base_type(t->kind);
+        in->mods = 0;
+        in->sym = TURKC_INTERN_NONE;
+        if (t->kind == TK_IDENTIFIER || t->kind == TK_STRING) {
+            in->sym = turkc_intern(d->ast->syms, d->rx.text + t->offset, t->length);
+            if (in->sym == TURKC_INTERN_NONE)
+                return -1;
+        }
+    }
+    return 0;
+}
+
+/* Düzenlemeden sonra info'yu token dizisiyle hizalar */
+static int splice_info(struct doc *d, const struct turkc_relex_change *ch)
+{
+    uint32_t ntoks = d->rx.ntoks;
+
+    if (grow((void **)&d->info, &d->info_cap, ntoks ? ntoks : 1, sizeof(*d->info)) != 0)
+        return -1;
+    memmove(d->info + ch->first + ch->inserted, d->info + ch->first + ch->removed,
+            (ntoks - ch->first - ch->inserted) * sizeof(*d->info));
+    return fill_info(d, ch->first, ch->inserted);
+}
+
+/* ---- Ayrıştırıcıya token kaynağı ---- */
+
+struct source {
+    const struct turkc_relex *rx;
+    uint32_t i, end;
+    unsigned long line;         /* rx->lines[line - 1] sıradaki token'ın satırı */
+};
+
+static int source_next(void *lexer, struct turkc_token *tok)
+{
+    struct source *src = lexer;
+    const struct turkc_relex *rx = src->rx;
+    int kind = TK_EOF;
+
+    if (src->i < src->end) {
+        tok->offset = rx->toks[src->i].offset;
+        tok->length = rx->toks[src->i].length;
+        kind = rx->toks[src->i++].kind;
+    } else if (src->end == rx->ntoks && rx->error) {
+        tok->offset = rx->error_offset;
+        tok->length = 0;
+        kind = -1;
+    } else {
+        tok->offset = src->end < rx->ntoks ? rx->toks[src->end].offset : rx->len;
+        tok->length = 0;
+    }
+    while (src->line < rx->nlines && rx->lines[src->line] <= tok->offset)
+        src->line++;
+    tok->kind = kind;
+    tok->text = rx->text + tok->offset;
+    tok->line = src->line;
+    tok->column = tok->offset - rx->lines[src->line - 1] + 1;
+    return kind;
+}
+
+static const char *source_error(void *lexer)
+{
+    return ((struct source *)lexer)->rx->error;
+}
+
+/* toks[first .. end)'i bildirim listesi olarak ayrıştırır. ast->root
+ * korunur; başarıda *list ilk bildirim.
+ */
+static int parse_tokens(struct doc *d, uint32_t first, uint32_t end, uint32_t *list,
+                        struct turkc_parse_error *err)
+{
+    struct source src;
+    struct turkc_token_source ts = { source_next, source_error, &src };
+    unsigned long column;
+    uint32_t root = d->ast->root;
+    int rc;
+
+    src.rx = &d->rx;
+    src.i = first;
+    src.end = end;
+    turkc_relex_position(&d->rx, first < d->rx.ntoks ? d->rx.toks[first].offset : d->rx.len,
+                         &src.line, &column);
+    rc = turkc_parse(d->ast, &ts, err);
+    *list = rc == 0 ? NODE(d, d->ast->root)->a : 0;
+    d->ast->root = root;
+    return rc;
+}
+
+/* ---- Sınıflandırma ve tanım arama ---- */
+
+struct walk {
+    struct turkc_lsp *s;
+    struct doc *d;
+    uint32_t yaz;               /* "yaz" sembolü */
+    uint32_t target;            /* aranan token, UINT32_MAX: yok */
+    uint32_t found;             /* target'ın tanımı (düğüm) */
+    int global;                 /* target yerel değil: global aranmalı */
+    unsigned depth;
+};
+
+static uint32_t token_of(const struct doc *d, uint32_t node)
+{
+    return turkc_relex_find(&d->rx, NODE(d, node)->offset);
+}
+
+/* Bildirimin (FUNC, VAR, PARAM) isim token'ı: tür token'ından sonraki
+ * identifier ('\r' token'ları atlanır)
+ */
+static uint32_t name_token(const struct doc *d, uint32_t node)
+{
+    uint32_t t = token_of(d, node) + 1;
+
+    while (t < d->rx.ntoks && d->rx.toks[t].kind != TK_IDENTIFIER)
+        t++;
+    return t;
+}
+
+static void mark(struct walk *w, uint32_t tok, int type, int mods)
+{
+    if (tok < w->d->rx.ntoks && w->d->rx.toks[tok].kind == TK_IDENTIFIER) {
+        w->d->info[tok].type = (uint8_t)type;
+        w->d->info[tok].mods = (uint8_t)mods;
+    }
+}
+
+static int declare(struct walk *w, uint32_t node, int type)
+{
+    struct turkc_lsp *s = w->s;
+    uint32_t t = name_token(w->d, node);
+
+    mark(w, t, type, SM_DECLARATION);
+    if (t == w->target)
+        w->found = node;
+    if (grow((void **)&s->scope, &s->scope_cap, s->nscope + 1, sizeof(*s->scope)) != 0)
+        return -1;
+    s->scope[s->nscope].sym = NODE(w->d, node)->c;
+    s->scope[s->nscope].node = node;
+    s->scope[s->nscope].type = (uint8_t)type;
+    s->nscope++;
+    return 0;
+}
+
+static const struct scope *lookup(const struct walk *w, uint32_t sym)
+{
+    uint32_t i = w->s->nscope;
+
+    while (i-- > 0)
+        if (w->s->scope[i].sym == sym)
+            return &w->s->scope[i];
+    return NULL;
+}
+
+static void expression(struct walk *w, uint32_t n)
+{
+    struct turkc_node *node;
+    const struct scope *sc;
+    uint32_t t, arg;
+
+    /* turkc_resolve'dan derin ifadeler zaten hatadır */
+    if (!n || ++w->depth > TURKC_RESOLVE_MAX_DEPTH) {
+        if (n)
+            w->depth--;
+        return;
+    }
+    /* sola bağlı zincir (i + 1 + 1 ...) döngüyle iner, resolve'daki gibi tek seviye */
+    while (NODE(w->d, n)->kind == ND_BINARY) {
+        expression(w, NODE(w->d, n)->b);
+        n = NODE(w->d, n)->a;
+    }
+    node = NODE(w->d, n);
+    switch (node->kind) {
+    case ND_NAME:
+        t = token_of(w->d, n);
+        sc = lookup(w, node->a);
+        mark(w, t, sc ? sc->type : ST_VARIABLE, 0);
+        if (t == w->target) {
+            w->found = sc ? sc->node : 0;
+            w->global = !sc;
+        }
+        break;
+    case ND_CALL:
+        t = token_of(w->d, n);
+        mark(w, t, ST_FUNCTION, node->a == w->yaz ? SM_LIBRARY : 0);
+        if (t == w->target)
+            w->global = 1;
+        for (arg = node->b; arg; arg = NODE(w->d, arg)->next)
+            expression(w, arg);
+        break;
+    case ND_ASSIGN:
+        expression(w, node->a);
+        expression(w, NODE(w->d, n)->b);
+        break;
+    case ND_NEG:
+        expression(w, node->a);
+        break;
+    }
+    w->depth--;
+}
+
+static int statement(struct walk *w, uint32_t n);
+
+/* Dal ve döngü gövdesi kendi kapsamındadır (blok olmasa da) */
+static int scoped(struct walk *w, uint32_t n)
+{
+    uint32_t mark = w->s->nscope;
+    int rc = statement(w, n);
+
+    w->s->nscope = mark;
+    return rc;
+}
+
+static int statement(struct walk *w, uint32_t n)
+{
+    uint32_t mark = w->s->nscope, s;
+    struct turkc_node *node;
+    int rc;
+
+    if (!n)
+        return 0;
+    node = NODE(w->d, n);
+    switch (node->kind) {
+    case ND_BLOCK:
+        for (s = node->a; s; s = NODE(w->d, s)->next)
+            if (statement(w, s) != 0)
+                return -1;
+        w->s->nscope = mark;
+        return 0;
+    case ND_VAR:
+        expression(w, node->a);
+        return declare(w, n, ST_VARIABLE);
+    case ND_IF:
+        expression(w, node->a);
+        if (scoped(w, NODE(w->d, n)->b) != 0)
+            return -1;
+        return scoped(w, NODE(w->d, n)->c);
+    case ND_WHILE:
+        expression(w, node->a);
+        return scoped(w, NODE(w->d, n)->b);
+    case ND_FOR:
+        if (statement(w, node->a) != 0)
+            return -1;
+        expression(w, NODE(w->d, n)->b);
+        expression(w, NODE(w->d, n)->c);
+        rc = scoped(w, NODE(w->d, n)->d);
+        w->s->nscope = mark;
+        return rc;
+    case ND_RETURN:
+    case ND_EXPR:
+        expression(w, node->a);
+        return 0;
+    }
+    return 0;
+}
+
+/* Birimin identifier'larını sınıflandırır; target verilmişse tanımını bulur */
+static int walk_unit(struct walk *w, const struct unit *u)
+{
+    struct doc *d = w->d;
+    uint32_t n = u->node, p, s;
+
+    w->s->nscope = 0;
+    w->depth = 0;
+    if (NODE(d, n)->kind == ND_VAR) {
+        mark(w, name_token(d, n), ST_VARIABLE, SM_DECLARATION);
+        if (name_token(d, n) == w->target)
+            w->found = n;
+        expression(w, NODE(d, n)->a);
+        return 0;
+    }
+    mark(w, name_token(d, n), ST_FUNCTION, SM_DECLARATION);
+    if (name_token(d, n) == w->target)
+        w->found = n;
+    /* parametreler ve gövdenin dış bloğu aynı kapsamdadır */
+    for (p = NODE(d, n)->a; p; p = NODE(d, p)->next)
+        if (declare(w, p, ST_PARAMETER) != 0)
+            return -1;
+    for (s = NODE(d, NODE(d, n)->b)->a; s; s = NODE(d, s)->next)
+        if (statement(w, s) != 0)
+            return -1;
+    return 0;
+}
+
+static void walk_init(struct walk *w, struct turkc_lsp *s, struct doc *d)
+{
+    memset(w, 0, sizeof(*w));
+    w->s = s;
+    w->d = d;
+    w->target = UINT32_MAX;
+    w->yaz = turkc_intern(d->ast->syms, "yaz", 3);
+}
+
+/* Ağaçsız token'lar: identifier'lar sınıflandırılmamış kalır */
+static void unclassify(struct doc *d, uint32_t first, uint32_t end)
+{
+    uint32_t i;
+
+    for (i = first; i < end; i++) {
+        d->info[i].type = base_type(d->rx.toks[i].kind);
+        d->info[i].mods = 0;
+    }
+}
+
+static uint32_t unit_end(const struct doc *d, uint32_t i)
+{
+    return i + 1 < d->nunits ? d->units[i + 1].tok : d->rx.ntoks;
+}
+
+static int classify(struct turkc_lsp *s, struct doc *d, uint32_t first, uint32_t n)
+{
+    struct walk w;
+    uint32_t i;
+
+    walk_init(&w, s, d);
+    for (i = first; i < first + n; i++) {
+        if (!d->units[i].node)
+            unclassify(d, d->units[i].tok, unit_end(d, i));
+        else if (walk_unit(&w, &d->units[i]) != 0)
+            return -1;
+    }
+    return 0;
+}
+
+/* ---- Birimler ---- */
+
+/* list'teki bildirimleri s->tmp[*count ..]'a birim olarak ekler */
+static int collect_units(struct turkc_lsp *s, struct doc *d, uint32_t list, uint32_t *count)
+{
+    uint32_t n, k = *count;
+
+    for (n = list; n; n = NODE(d, n)->next) {
+        if (grow((void **)&s->tmp, &s->tmp_cap, k + 1, sizeof(*s->tmp)) != 0)
+            return -1;
+        s->tmp[k].node = n;
+        s->tmp[k].tok = token_of(d, n);
+        s->tmp[k].lo = n;
+        s->tmp[k].hi = NODE(d, n)->next ? NODE(d, n)->next : d->ast->count;
+        k++;
+    }
+    *count = k;
+    return 0;
+}
+
+/* toks[first .. end)'i s->tmp'ye birimler olarak ayrıştırır. Ayrıştırılamazsa
+ * *err doldurulur ve bölge parçalanır: derinlik 0'da ';' veya derinliği
+ * 0'a indiren '}' bir parçayı bitirir. Her parça ayrı ayrıştırılır,
+ * ayrıştırılamayanın düğümleri geri alınır ve node 0'lı birim olur.
+ * Böylece hata yalnız bozuk bildirimin sınıflandırmasını kaybettirir.
+ */
+static int parse_region(struct turkc_lsp *s, struct doc *d, uint32_t first, uint32_t end,
+                        uint32_t *count, struct turkc_parse_error *err)
+{
+    struct turkc_parse_error e;
+    uint32_t list, mark = d->ast->count, t, depth;
+    int kind;
+
+    *count = 0;
+    if (parse_tokens(d, first, end, &list, err) == 0)
+        return collect_units(s, d, list, count);
+    d->ast->count = mark;
+    for (t = first; first < end; first = t) {
+        for (depth = 0; t < end;) {
+            kind = d->rx.toks[t++].kind;
+            if (kind == TK_LBRACE)
+                depth++;
+            else if ((kind == TK_RBRACE && (depth == 0 || --depth == 0)) ||
+                     (kind == TK_SEMI && depth == 0))
+                break;
+        }
+        mark = d->ast->count;
+        if (parse_tokens(d, first, t, &list, &e) == 0) {
+            if (collect_units(s, d, list, count) != 0)
+                return -1;
+            continue;
+        }
+        d->ast->count = mark;
+        if (grow((void **)&s->tmp, &s->tmp_cap, *count + 1, sizeof(*s->tmp)) != 0)
+            return -1;
+        memset(&s->tmp[*count], 0, sizeof(*s->tmp));
+        s->tmp[(*count)++].tok = first;
+    }
+    return 0;
+}
+
+/* PROGRAM listesini birim sırasına göre yeniden bağlar; bozuk birimler atlanır */
+static void relink(struct doc *d)
+{
+    uint32_t i, prev = d->ast->root;
+
+    if (!prev)
+        return;
+    NODE(d, prev)->a = 0;
+    for (i = 0; i < d->nunits; i++) {
+        if (!d->units[i].node)
+            continue;
+        if (prev == d->ast->root)
+            NODE(d, prev)->a = d->units[i].node;
+        else
+            NODE(d, prev)->next = d->units[i].node;
+        prev = d->units[i].node;
+        NODE(d, prev)->next = 0;
+    }
+}
+
+static int parse_full(struct turkc_lsp *s, struct doc *d)
+{
+    uint32_t n, i;
+
+    d->ast->count = 1;
+    d->ast->root = 0;
+    d->nunits = 0;
+    d->live = 0;
+    d->broken = 0;
+    d->full = 1;
+    d->parsed = 0;
+    d->has_error = 0;
+    if (parse_region(s, d, 0, d->rx.ntoks, &n, &d->err) != 0 ||
+        grow((void **)&d->units, &d->units_cap, n, sizeof(*d->units)) != 0)
+        return -1;
+    /* ilk başarılı ayrıştırmanın PROGRAM düğümü; hiçbiri yoksa ağaç boş */
+    d->ast->root = d->ast->count > 1 ? 1 : 0;
+    if (n)
+        memcpy(d->units, s->tmp, n * sizeof(*d->units));
+    d->nunits = n;
+    for (i = 0; i < n; i++) {
+        d->live += d->units[i].hi - d->units[i].lo;
+        d->broken += !d->units[i].node;
+    }
+    d->has_error = d->broken > 0;
+    relink(d);
+    d->reparsed = n;
+    d->reused = 0;
+    d->parsed = 1;
+    return classify(s, d, 0, n);
+}
+
+/* İlk token'ı tok'tan büyük olmayan son birim */
+static uint32_t unit_of(const struct doc *d, uint32_t tok)
+{
+    uint32_t lo = 0, hi = d->nunits, mid;
+
+    while (lo < hi) {
+        mid = lo + (hi - lo) / 2;
+        if (d->units[mid].tok <= tok)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo ? lo - 1 : 0;
+}
+
+/* Düzenlemenin değdiği birimleri yeniden ayrıştırır (bkz. turkc_lsp.h) */
+static int reparse(struct turkc_lsp *s, struct doc *d, const struct turkc_relex_change *ch,
+                   uint32_t shift)
+{
+    struct turkc_parse_error err;
+    uint32_t old_ntoks = d->rx.ntoks - ch->inserted + ch->removed;
+    uint32_t dt = ch->inserted - ch->removed;
+    uint32_t a, b, start, end, list, n, i, k, dead = 0, mark;
+
+    d->full = 0;
+    if (!d->parsed || d->nunits == 0)
+        return parse_full(s, d);
+    if (ch->first >= old_ntoks) {
+        a = d->nunits;          /* dosya sonuna ekleme */
+        b = a;
+        start = ch->first;
+    } else {
+        a = unit_of(d, ch->first);
+        b = ch->removed ? unit_of(d, ch->first + ch->removed - 1) + 1 : a + 1;
+        start = a ? d->units[a].tok : 0;
+    }
+    /* bitişik bozuk birimler de: düzenleme onları tamamlayabilir */
+    if ((a > 0 && !d->units[a - 1].node) || (b < d->nunits && !d->units[b].node)) {
+        while (a > 0 && !d->units[a - 1].node)
+            a--;
+        while (b < d->nunits && !d->units[b].node)
+            b++;
+        start = a < d->nunits ? d->units[a].tok : ch->first;
+    }
+    end = b < d->nunits ? d->units[b].tok + dt : d->rx.ntoks;
+
+    /* ast->root belgenin PROGRAM düğümü olarak kalır; boşsa baştan kurulur */
+    if (!d->ast->root)
+        return parse_full(s, d);
+    if (parse_region(s, d, start, end, &n, &err) != 0)
+        return -1;
+
+    for (i = a; i < b; i++) {
+        dead += d->units[i].hi - d->units[i].lo;
+        d->broken -= !d->units[i].node;
+    }
+    k = d->nunits - b;
+    if (grow((void **)&d->units, &d->units_cap, a + n + k, sizeof(*d->units)) != 0)
+        return -1;
+    memmove(d->units + a + n, d->units + b, k * sizeof(*d->units));
+    if (n)
+        memcpy(d->units + a, s->tmp, n * sizeof(*d->units));
+    d->nunits = a + n + k;
+    for (i = a + n; i < d->nunits; i++) {
+        struct unit *u = &d->units[i];
+        uint32_t j;
+
+        u->tok += dt;
+        for (j = u->lo; j < u->hi; j++)
+            NODE(d, j)->offset += shift;
+    }
+    d->live -= dead;
+    for (i = a; i < a + n; i++) {
+        d->live += d->units[i].hi - d->units[i].lo;
+        d->broken += !d->units[i].node;
+    }
+    relink(d);
+    d->reparsed = n;
+    d->reused = d->nunits - n;
+    d->parsed = 1;
+    d->has_error = 0;
+    if (d->broken) {
+        /* hata tam ayrıştırmanınki olsun; belge artık ayrıştırılabiliyorsa
+         * bozuk parçaların sınırları eskimiştir, baştan kurulur
+         */
+        mark = d->ast->count;
+        if (parse_tokens(d, 0, d->rx.ntoks, &list, &d->err) == 0)
+            return parse_full(s, d);
+        d->ast->count = mark;
+        d->has_error = 1;
+    } else if (d->ast->count > 2 * d->live + 65536) {
+        /* ölü düğümler çoğalınca ağaç baştan kurulur */
+        return parse_full(s, d);
+    }
+    return classify(s, d, a, n);
+}
+
+/* İsim çözümleme; hatayı d->err'e yazar */
+static void resolve(struct doc *d)
+{
+    struct turkc_program prog;
+    uint32_t i;
+
+    if (!d->parsed || d->broken)
+        return;             /* sözdizim hatası kalır */
+    d->has_error = 0;
+    for (i = 1; i < d->ast->count; i++)
+        d->ast->nodes[i].flags = 0;
+    if (turkc_resolve(&prog, d->ast, &d->err) != 0)
+        d->has_error = 1;
+    turkc_program_free(&prog);
+}
+
+/* ---- Belgeler ---- */
+
+static struct doc *find_doc(struct turkc_lsp *s, uint32_t text_document)
+{
+    uint32_t v = turkc_json_get(&s->js, text_document, "uri");
+    char *uri = turkc_json_string(&s->js, v, NULL);
+    struct doc *d = NULL;
+    uint32_t i;
+
+    if (!uri)
+        return NULL;
+    for (i = 0; i < s->ndocs && !d; i++)
+        if (strcmp(s->docs[i].uri, uri) == 0)
+            d = &s->docs[i];
+    free(uri);
+    return d;
+}
+
+static void doc_free(struct doc *d)
+{
+    free(d->uri);
+    turkc_relex_free(&d->rx);
+    free(d->info);
+    turkc_ast_free(d->ast);
+    free(d->units);
+    memset(d, 0, sizeof(*d));
+}
+
+/* Metni baştan tarar ve ayrıştırır */
+static int doc_load(struct turkc_lsp *s, struct doc *d, const char *text, size_t len)
+{
+    turkc_relex_free(&d->rx);
+    if (turkc_relex_init(&d->rx, text, len, TURKC_SIMD_AUTO) != 0 ||
+        grow((void **)&d->info, &d->info_cap, d->rx.ntoks ? d->rx.ntoks : 1,
+             sizeof(*d->info)) != 0 ||
+        fill_info(d, 0, d->rx.ntoks) != 0 ||
+        parse_full(s, d) != 0)
+        return -1;
+    resolve(d);
+    return 0;
+}
+
+/* ---- Mesajlar ---- */
+
+static void frame(struct turkc_lsp *s)
+{
+    turkc_json_printf(s->out, "Content-Length: %lu\r\n\r\n", (unsigned long)s->body.len);
+    turkc_json_put(s->out, s->body.data, s->body.len);
+    s->body.len = 0;
+}
+
+static void begin_result(struct turkc_lsp *s, uint32_t id)
+{
+    s->body.len = 0;
+    turkc_json_puts(&s->body, "{\"jsonrpc\":\"2.0\",\"id\":");
+    turkc_json_raw(&s->body, &s->js, id);
+    turkc_json_puts(&s->body, ",\"result\":");
+}
+
+static void end_message(struct turkc_lsp *s)
+{
+    turkc_json_puts(&s->body, "}");
+    frame(s);
+}
+
+static void error_response(struct turkc_lsp *s, uint32_t id, int code, const char *message)
+{
+    s->body.len = 0;
+    turkc_json_puts(&s->body, "{\"jsonrpc\":\"2.0\",\"id\":");
+    turkc_json_raw(&s->body, &s->js, id);
+    turkc_json_printf(&s->body, ",\"error\":{\"code\":%d,\"message\":", code);
+    turkc_json_quote(&s->body, message, strlen(message));
+    turkc_json_puts(&s->body, "}");
+    end_message(s);
+}
+
+static void publish(struct turkc_lsp *s, const struct doc *d, const char *uri)
+{
+    const char *msg;
+
+    s->body.len = 0;
+    turkc_json_puts(&s->body, "{\"jsonrpc\":\"2.0\",\"method\":"
+                    "\"textDocument/publishDiagnostics\",\"params\":{\"uri\":");
+    turkc_json_quote(&s->body, uri, strlen(uri));
+    if (!d) {
+        turkc_json_puts(&s->body, ",\"diagnostics\":[]}");
+        end_message(s);
+        return;
+    }
+    turkc_json_printf(&s->body, ",\"version\":%lld,\"diagnostics\":[", d->version);
+    if (d->has_error) {
+        msg = d->err.message;
+        turkc_json_puts(&s->body, "{\"range\":");
+        put_range(s, d, d->err.offset < d->rx.len ? d->err.offset : d->rx.len);
+        turkc_json_puts(&s->body, ",\"severity\":1,\"source\":\"turkc\",\"message\":");
+        turkc_json_quote(&s->body, msg, strlen(msg));
+        turkc_json_puts(&s->body, "}");
+    }
+    turkc_json_puts(&s->body, "]}");
+    end_message(s);
+}
+
+static int initialize(struct turkc_lsp *s, uint32_t id, uint32_t params)
+{
+    uint32_t caps = turkc_json_get(&s->js, params, "capabilities");
+    uint32_t general = turkc_json_get(&s->js, caps, "general");
+    uint32_t enc = turkc_json_get(&s->js, general, "positionEncodings"), v;
+
+    s->initialized = 1;
+    if (enc && s->js.vals[enc].type == TURKC_JSON_ARRAY)
+        for (v = s->js.vals[enc].child; v; v = s->js.vals[v].next)
+            if (turkc_json_equals(&s->js, v, "utf-8"))
+                s->utf8 = 1;
+    begin_result(s, id);
+    turkc_json_printf(&s->body, "{\"capabilities\":{\"positionEncoding\":\"%s\","
+                      "\"textDocumentSync\":{\"openClose\":true,\"change\":2},"
+                      "\"definitionProvider\":true,"
+                      "\"semanticTokensProvider\":{%s,\"full\":true}},"
+                      "\"serverInfo\":{\"name\":\"tclsp\"}}",
+                      s->utf8 ? "utf-8" : "utf-16", legend);
+    end_message(s);
+    return 0;
+}
+
+static int did_open(struct turkc_lsp *s, uint32_t id, uint32_t params)
+{
+    uint32_t td = turkc_json_get(&s->js, params, "textDocument");
+    char *uri, *text;
+    struct doc *d;
+    size_t len;
+    int rc;
+
+    (void)id;
+    uri = turkc_json_string(&s->js, turkc_json_get(&s->js, td, "uri"), NULL);
+    text = turkc_json_string(&s->js, turkc_json_get(&s->js, td, "text"), &len);
+    if (!uri || !text) {
+        free(uri);
+        free(text);
+        return 0;
+    }
+    d = find_doc(s, td);
+    if (d) {
+        free(uri);
+    } else {
+        if (grow((void **)&s->docs, &s->docs_cap, s->ndocs + 1, sizeof(*s->docs)) != 0) {
+            free(uri);
+            free(text);
+            return -1;
+        }
+        d = &s->docs[s->ndocs++];
+        memset(d, 0, sizeof(*d));
+        d->uri = uri;
+        d->ast = turkc_ast_new();
+    }
+    d->version = turkc_json_int(&s->js, turkc_json_get(&s->js, td, "version"), 0);
+    rc = d->ast ? doc_load(s, d, text, len) : -1;
+    free(text);
+    if (rc != 0)
+        return -1;
+    publish(s, d, d->uri);
+    return 0;
+}
+
+/* Tek bir contentChanges elemanı */
+static int apply_change(struct turkc_lsp *s, struct doc *d, uint32_t change)
+{
+    struct turkc_relex_change ch;
+    uint32_t range = turkc_json_get(&s->js, change, "range"), start, end;
+    size_t from, to, len;
+    char *text = turkc_json_string(&s->js, turkc_json_get(&s->js, change, "text"), &len);
+    int rc;
+
+    if (!text)
+        return 0;
+    if (!range) {
+        rc = doc_load(s, d, text, len);
+        free(text);
+        return rc;
+    }
+    start = turkc_json_get(&s->js, range, "start");
+    end = turkc_json_get(&s->js, range, "end");
+    from = offset_of(s, d, turkc_json_int(&s->js, turkc_json_get(&s->js, start, "line"), 0),
+                     turkc_json_int(&s->js, turkc_json_get(&s->js, start, "character"), 0));
+    to = offset_of(s, d, turkc_json_int(&s->js, turkc_json_get(&s->js, end, "line"), 0),
+                   turkc_json_int(&s->js, turkc_json_get(&s->js, end, "character"), 0));
+    if (to < from)
+        to = from;
+    rc = turkc_relex_edit(&d->rx, from, to - from, text, len, &ch);
+    free(text);
+    if (rc != 0 || splice_info(d, &ch) != 0)
+        return -1;
+    return reparse(s, d, &ch, (uint32_t)(len - (to - from)));
+}
+
+/* Artımlı sonucu belgenin baştan yüklenmiş bir kopyasıyla karşılaştırır */
+static int check(struct turkc_lsp *s, struct doc *d)
+{
+    struct doc full;
+    uint32_t i;
+    int rc = 0;
+
+    memset(&full, 0, sizeof(full));
+    full.ast = turkc_ast_new();
+    if (!full.ast || doc_load(s, &full, d->rx.text, d->rx.len) != 0) {
+        doc_free(&full);
+        return -1;
+    }
+    if (full.rx.ntoks != d->rx.ntoks) {
+        fprintf(stderr, "tclsp: %s: %lu token, tam taramada %lu\n", d->uri,
+                (unsigned long)d->rx.ntoks, (unsigned long)full.rx.ntoks);
+        rc = 1;
+    }
+    /* sözdizim hatasında sınıflandırma düzenleme geçmişine bağlıdır: yalnız hata karşılaştırılır */
+    for (i = 0; i < d->rx.ntoks && !rc && !d->broken && !full.broken; i++)
+        if (d->info[i].type != full.info[i].type || d->info[i].mods != full.info[i].mods) {
+            fprintf(stderr, "tclsp: %s: token #%lu (ofset %lu) tur %d/%d, tam ayristirmada %d/%d\n",
+                    d->uri, (unsigned long)i, (unsigned long)d->rx.toks[i].offset,
+                    d->info[i].type, d->info[i].mods, full.info[i].type, full.info[i].mods);
+            rc = 1;
+        }
+    if (!rc && (d->has_error != full.has_error ||
+                (d->has_error && (d->err.offset != full.err.offset ||
+                                  strcmp(d->err.message, full.err.message) != 0)))) {
+        fprintf(stderr, "tclsp: %s: hata \"%s\" (%lu), tam ayristirmada \"%s\" (%lu)\n",
+                d->uri, d->has_error ? d->err.message : "", d->has_error ? d->err.offset : 0,
+                full.has_error ? full.err.message : "", full.has_error ? full.err.offset : 0);
+        rc = 1;
+    }
+    s->mismatches += rc;
+    doc_free(&full);
+    return 0;
+}
+
+static int did_change(struct turkc_lsp *s, uint32_t id, uint32_t params)
+{
+    uint32_t td = turkc_json_get(&s->js, params, "textDocument");
+    uint32_t changes = turkc_json_get(&s->js, params, "contentChanges"), c;
+    struct doc *d = find_doc(s, td);
+    uint32_t reparsed = 0;
+
+    (void)id;
+    if (!d || !changes || s->js.vals[changes].type != TURKC_JSON_ARRAY)
+        return 0;
+    d->version = turkc_json_int(&s->js, turkc_json_get(&s->js, td, "version"), d->version);
+    for (c = s->js.vals[changes].child; c; c = s->js.vals[c].next) {
+        if (apply_change(s, d, c) != 0)
+            return -1;
+        reparsed += d->reparsed;
+    }
+    d->reparsed = reparsed;
+    resolve(d);
+    if (s->check && check(s, d) != 0)
+        return -1;
+    publish(s, d, d->uri);
+    return 0;
+}
+
+static int did_close(struct turkc_lsp *s, uint32_t id, uint32_t params)
+{
+    uint32_t td = turkc_json_get(&s->js, params, "textDocument");
+    struct doc *d = find_doc(s, td);
+    char *uri;
+
+    (void)id;
+    if (!d)
+        return 0;
+    uri = d->uri;
+    d->uri = NULL;
+    doc_free(d);
+    *d = s->docs[--s->ndocs];
+    publish(s, NULL, uri);
+    free(uri);
+    return 0;
+}
+
+/* Üst düzey bildirim: isim çağrılıyorsa FUNC, değilse VAR */
+static uint32_t global_decl(const struct doc *d, uint32_t sym, int call)
+{
+    uint32_t i, n;
+
+    for (i = 0; i < d->nunits; i++) {
+        n = d->units[i].node;
+        if (n && NODE(d, n)->c == sym && NODE(d, n)->kind == (call ? ND_FUNC : ND_VAR))
+            return n;
+    }
+    return 0;
+}
+
+static int definition(struct turkc_lsp *s, uint32_t id, uint32_t params)
+{
+    uint32_t td = turkc_json_get(&s->js, params, "textDocument");
+    uint32_t pos = turkc_json_get(&s->js, params, "position");
+    struct doc *d = find_doc(s, td);
+    const struct turkc_relex *rx;
+    struct walk w;
+    uint32_t t, decl = 0;
+    size_t offset;
+
+    if (d && d->parsed) {
+        rx = &d->rx;
+        offset = offset_of(s, d, turkc_json_int(&s->js, turkc_json_get(&s->js, pos, "line"), 0),
+                           turkc_json_int(&s->js, turkc_json_get(&s->js, pos, "character"), 0));
+        t = turkc_relex_find(rx, offset);
+        /* imleç ismin hemen arkasındaysa */
+        if ((t == rx->ntoks || rx->toks[t].offset > offset) && t > 0 &&
+            rx->toks[t - 1].offset + rx->toks[t - 1].length == offset)
+            t--;
+        if (t < rx->ntoks && rx->toks[t].offset <= offset &&
+            rx->toks[t].kind == TK_IDENTIFIER && d->nunits && d->units[unit_of(d, t)].node) {
+            walk_init(&w, s, d);
+            w.target = t;
+            if (walk_unit(&w, &d->units[unit_of(d, t)]) != 0)
+                return -1;
+            decl = w.found;
+            if (!decl && w.global)
+                decl = global_decl(d, d->info[t].sym,
+                                   t + 1 < rx->ntoks && rx->toks[t + 1].kind == TK_LPAREN);
+        }
+    }
+    begin_result(s, id);
+    if (decl) {
+        turkc_json_puts(&s->body, "{\"uri\":");
+        turkc_json_quote(&s->body, d->uri, strlen(d->uri));
+        turkc_json_puts(&s->body, ",\"range\":");
+        put_range(s, d, d->rx.toks[name_token(d, decl)].offset);
+        turkc_json_puts(&s->body, "}");
+    } else {
+        turkc_json_puts(&s->body, "null");
+    }
+    end_message(s);
+    return 0;
+}
+
+static char *put_uint(char *p, unsigned long x)
+{
+    char tmp[24];
+    int n = 0;
+
+    if (x < 10) {
+        *p++ = (char)('0' + x);
+        return p;
+    }
+    do
+        tmp[n++] = (char)('0' + x % 10);
+    while ((x /= 10) != 0);
+    while (n > 0)
+        *p++ = tmp[--n];
+    return p;
+}
+
+/* Metinde 0x80 ve üstü byte yoksa UTF-16 sütunları byte sütunlarıdır */
+static int is_ascii(const char *p, size_t n)
+{
+    uint64_t acc = 0, w;
+    size_t i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        memcpy(&w, p + i, 8);
+        acc |= w;
+    }
+    for (; i < n; i++)
+        acc |= (unsigned char)p[i];
+    return (acc & 0x8080808080808080ULL) == 0;
+}
+
+/* Token başına 5 sayı: satır farkı, sütun farkı, uzunluk, tür, değiştirici */
+static int semantic_tokens(struct turkc_lsp *s, uint32_t id, uint32_t params)
+{
+    struct doc *d = find_doc(s, turkc_json_get(&s->js, params, "textDocument"));
+    const struct turkc_relex *rx;
+    unsigned long prev_line = 0, prev_char = 0, ch, len;
+    uint32_t i, line = 0;
+    size_t offset, end;
+    char *p, *start;
+    int utf16;
+
+    begin_result(s, id);
+    if (!d) {
+        turkc_json_puts(&s->body, "null");
+        end_message(s);
+        return 0;
+    }
+    rx = &d->rx;
+    utf16 = !s->utf8 && !is_ascii(rx->text, rx->len);
+    /* sayılar en fazla 10 hane + virgül */
+    start = p = turkc_json_reserve(&s->body, (size_t)rx->ntoks * 5 * 11 + 16);
+    if (!p)
+        return -1;
+    memcpy(p, "{\"data\":[", 9);
+    p += 9;
+    for (i = 0; i < rx->ntoks; i++) {
+        if (d->info[i].type == ST_NONE)
+            continue;
+        offset = rx->toks[i].offset;
+        while (line + 1 < rx->nlines && rx->lines[line + 1] <= offset)
+            line++;
+        ch = offset - rx->lines[line];
+        len = rx->toks[i].length;
+        end = line_end(rx, line);
+        if (offset + len > end)
+            len = end - offset;
+        if (utf16) {
+            ch = utf16_units(rx->text + rx->lines[line], ch);
+            len = utf16_units(rx->text + offset, len);
+        }
+        p = put_uint(p, line - prev_line);
+        *p++ = ',';
+        p = put_uint(p, line == prev_line ? ch - prev_char : ch);
+        *p++ = ',';
+        p = put_uint(p, len);
+        *p++ = ',';
+        *p++ = (char)('0' + d->info[i].type);
+        *p++ = ',';
+        *p++ = (char)('0' + d->info[i].mods);
+        *p++ = ',';
+        prev_line = line;
+        prev_char = ch;
+    }
+    if (p[-1] == ',')
+        p--;
+    *p++ = ']';
+    *p++ = '}';
+    s->body.len += p - start;
+    end_message(s);
+    return 0;
+}
+
+static int shutdown_(struct turkc_lsp *s, uint32_t id, uint32_t params)
+{
+    (void)params;
+    s->shutdown = 1;
+    begin_result(s, id);
+    turkc_json_puts(&s->body, "null");
+    end_message(s);
+    return 0;
+}
+
+static const struct {
+    const char *method;
+    int (*handle)(struct turkc_lsp *s, uint32_t id, uint32_t params);
+} handlers[] = {
+    { "initialize", initialize },
+    { "shutdown", shutdown_ },
+    { "textDocument/didOpen", did_open },
+    { "textDocument/didChange", did_change },
+    { "textDocument/didClose", did_close },
+    { "textDocument/definition", definition },
+    { "textDocument/semanticTokens/full", semantic_tokens },
+};
+
+struct turkc_lsp *turkc_lsp_new(FILE *trace, int check)
+{
+    struct turkc_lsp *s = calloc(1, sizeof(*s));
+
+    if (s) {
+        s->trace = trace;
+        s->check = check;
+    }
+    return s;
+}
+
+unsigned long turkc_lsp_mismatches(const struct turkc_lsp *s)
+{
+    return s->mismatches;
+}
+
+void turkc_lsp_free(struct turkc_lsp *s)
+{
+    uint32_t i;
+
+    if (!s)
+        return;
+    for (i = 0; i < s->ndocs; i++)
+        doc_free(&s->docs[i]);
+    free(s->docs);
+    turkc_json_free(&s->js);
+    turkc_json_buf_free(&s->body);
+    free(s->scope);
+    free(s->tmp);
+    free(s);
+}
+
+static void trace(struct turkc_lsp *s, uint32_t method, uint32_t params, double start)
+{
+    const struct turkc_json_value *m = &s->js.vals[method];
+    struct doc *d = find_doc(s, turkc_json_get(&s->js, params, "textDocument"));
+
+    fprintf(s->trace, "tclsp: %.*s %.3f ms", (int)m->length - 2, s->js.src + m->start + 1,
+            (turkc_now() - start) * 1e3);
+    if (d && (turkc_json_equals(&s->js, method, "textDocument/didOpen") ||
+              turkc_json_equals(&s->js, method, "textDocument/didChange"))) {
+        if (d->full)
+            fprintf(s->trace, " (tam ayristirma, %lu birim)", (unsigned long)d->nunits);
+        else
+            fprintf(s->trace, " (%lu birim yeniden ayristirildi, %lu korundu)",
+                    (unsigned long)d->reparsed, (unsigned long)d->reused);
+    }
+    if (d && turkc_json_equals(&s->js, method, "textDocument/semanticTokens/full"))
+        fprintf(s->trace, " (%lu token)", (unsigned long)d->rx.ntoks);
+    fputc('\n', s->trace);
+}
+
+int turkc_lsp_handle(struct turkc_lsp *s, const char *msg, size_t len,
+                     struct turkc_json_buf *out)
+{
+    double start = s->trace ? turkc_now() : 0;
+    uint32_t method, id, params;
+    size_t i;
+    int rc = 0;
+
+    s->out = out;
+    if (turkc_json_parse(&s->js, msg, len) != 0) {
+        s->js.count = 1;
+        error_response(s, 0, -32700, "gecersiz JSON");
+        return 0;
+    }
+    method = turkc_json_get(&s->js, 1, "method");
+    id = turkc_json_get(&s->js, 1, "id");
+    params = turkc_json_get(&s->js, 1, "params");
+    if (!method || s->js.vals[method].type != TURKC_JSON_STRING)
+        return 0;               /* istemcinin yanıtı; sunucu istek göndermez */
+    if (turkc_json_equals(&s->js, method, "exit"))
+        return 1;
+    for (i = 0; i < sizeof(handlers) / sizeof(handlers[0]); i++)
+        if (turkc_json_equals(&s->js, method, handlers[i].method))
+            break;
+    if (i == sizeof(handlers) / sizeof(handlers[0])) {
+        if (id)
+            error_response(s, id, -32601, "bilinmeyen metod");
+    } else if (!s->initialized && i != 0) {
+        if (id)
+            error_response(s, id, -32002, "sunucu baslatilmadi");
+    } else if (s->shutdown) {
+        if (id)
+            error_response(s, id, -32600, "sunucu kapaniyor");
+    } else {
+        rc = handlers[i].handle(s, id, params);
+        if (rc != 0 && id)
+            error_response(s, id, -32603, "bellek yetersiz");
+    }
+    if (s->trace)
+        trace(s, method, params, start);
+    return 0;
+}
+
+int turkc_lsp_serve(struct turkc_lsp *s, FILE *in, FILE *out)
+{
+    struct turkc_json_buf buf = {0};
+    char line[256], *msg = NULL, *p;
+    size_t cap = 0, len;
+    int rc = 1;
+
+    for (;;) {
+        /* başlıklar boş satırla biter; yalnız Content-Length kullanılır */
+        len = (size_t)-1;
+        while (fgets(line, sizeof(line), in) && line[0] != '\r' && line[0] != '\n')
+            if (strncmp(line, "Content-Length:", 15) == 0)
+                len = strtoul(line + 15, NULL, 10);
+        if (feof(in) || ferror(in))
+            break;
+        if (len == (size_t)-1)
+            continue;
+        if (len + 1 > cap) {
+            p = realloc(msg, len + 1);
+            if (!p)
+                break;
+            msg = p;
+            cap = len + 1;
+        }
+        if (fread(msg, 1, len, in) != len)
+            break;
+        buf.len = 0;
+        if (turkc_lsp_handle(s, msg, len, &buf) != 0) {
+            rc = s->shutdown ? 0 : 1;
+            break;
+        }
+        if (buf.oom)
+            break;
+        fwrite(buf.data, 1, buf.len, out);
+        fflush(out);
+    }
+    free(msg);
+    turkc_json_buf_free(&buf);
+    return rc;
+}
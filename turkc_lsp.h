@@ -0,0 +1,73 @@
+#ifndef TURKC_LSP_H
+#define TURKC_LSP_H
+
+/* TurkC dil sunucusu (Language Server Protocol, JSON-RPC); tclsp onu
+ * stdin/stdout'a bağlar.
+ *
+ * Desteklenenler: initialize, shutdown, exit, textDocument/didOpen,
+ * didChange (artımlı veya tam metin), didClose, textDocument/definition ve
+ * textDocument/semanticTokens/full. Her açma ve değişiklikten sonra
+ * publishDiagnostics gönderilir: ilk sözdizim, lexer veya isim çözümleme
+ * hatası (turkc_parse, turkc_resolve). İstemci "utf-8" konum kodlamasını
+ * destekliyorsa o seçilir, yoksa sütunlar UTF-16 birimidir.
+ *
+ * Belgeler bellekte durur. Metin ve token'lar turkc_relex'tedir, her
+ * değişiklik yalnız etkilediği token'ları yeniden tarar. Ağaçta her üst
+ * düzey bildirim (fonksiyon veya global) bir birimdir; değişikliğin
+ * değdiği birimler yeniden ayrıştırılır, diğerlerinin alt ağaçları aynen
+ * kalır, yalnız düğüm ofsetleri kaydırılır. Bir bildirim ';' veya '}' ile
+ * biter ve üst düzeyde ayrıştırma bağlamsızdır, bu yüzden sonuç tam
+ * ayrıştırmayla aynıdır. Bölge ayrıştırılamazsa ';' ve üst düzey '}'
+ * sonlarında parçalanıp parça parça ayrıştırılır; ayrıştırılamayan parça
+ * alt ağacı olmayan bozuk birim olur, bitişiğindeki düzenleme onu da
+ * yeniden ayrıştırır. Hata yine tam ayrıştırmanınkidir. Yeni düğümler dizinin
+ * sonuna eklenir; ölü düğümler canlılardan çok olunca ağaç baştan kurulur.
+ * İsim çözümleme her değişiklikten sonra tüm ağaçta çalışır; bozuk birim
+ * varken atlanır.
+ *
+ * Semantik token'lar token dizisine paralel bir diziden gelir: her token
+ * için interning tablosundaki sembolü (identifier ve string) ve türü
+ * (keyword, function, parameter, variable, number, string, operator).
+ * Identifier türleri yeniden ayrıştırılan birimler için ağaçtan
+ * doldurulur; yalnız bozuk birimlerinkiler sınıflandırılmamış kalır.
+ * İstek bu diziden tek geçişte kodlanır.
+ */
+
+#include <stdio.h>
+
+#include "turkc_json.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct turkc_lsp;
+
+/* trace NULL değilse her mesajın süresi ve ayrıştırma istatistiği oraya
+ * yazılır. check açıksa her değişiklikten sonra semantik token'lar ve hata
+ * belgenin baştan taranıp ayrıştırılmasıyla karşılaştırılır (sözdizim
+ * hatasında bozuk birimler geçmişe bağlı olduğundan yalnız hata); farklar
+ * stderr'e yazılır ve sayılır. Bellek yetmezse NULL.
+ */
+struct turkc_lsp *turkc_lsp_new(FILE *trace, int check);
+void turkc_lsp_free(struct turkc_lsp *s);
+
+/* check ile bulunan fark sayısı */
+unsigned long turkc_lsp_mismatches(const struct turkc_lsp *s);
+
+/* Tek bir JSON-RPC mesajını (başlıksız) işler. Yanıt ve bildirimler out'a
+ * Content-Length başlığıyla eklenir. exit gelince 1, yoksa 0 döner.
+ */
+int turkc_lsp_handle(struct turkc_lsp *s, const char *msg, size_t len,
+                     struct turkc_json_buf *out);
+
+/* in'den mesaj okuyup yanıtları out'a yazar; exit'e veya giriş sonuna
+ * kadar. Süreç çıkış kodu döner: shutdown'dan sonra exit ise 0, değilse 1.
+ */
+int turkc_lsp_serve(struct turkc_lsp *s, FILE *in, FILE *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
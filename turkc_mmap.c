@@ -0,0 +1,132 @@
+#include <fcntl.h>
+#include <stdlib.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "turkc_mmap.h"
+
+#ifdef _WIN32
+
+/* Windows'ta stream okuma kullanılır */
+int turkc_map_file(int fd, struct turkc_mapping *m)
+{
+    (void)fd;
+    m->data = NULL;
+    m->size = m->mapped_size = 0;
+    return -1;
+}
+
+void turkc_unmap_file(struct turkc_mapping *m)
+{
+    (void)m;
+}
+
+#else
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+int turkc_map_file(int fd, struct turkc_mapping *m)
+{
+    struct stat st;
+    size_t page, len, total;
+    char *base;
+
+    m->data = NULL;
+    m->size = m->mapped_size = 0;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode))
+        return -1;
+
+    len = (size_t)st.st_size;
+    page = (size_t)sysconf(_SC_PAGESIZE);
+    total = (len + 2 + page - 1) / page * page;
+
+    /* Önce dosya + 2 NUL'a yetecek sıfırlı bir alan ayır, sonra dosyayı
+     * başına map et. Dosya sayfa sınırında bitse bile sonraki sayfa sıfırdır.
+     */
+    base = mmap(NULL, total, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED)
+        return -1;
+    if (len > 0) {
+        if (mmap(base, len, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED) {
+            munmap(base, total);
+            return -1;
+        }
+        madvise(base, len, MADV_SEQUENTIAL);
+    }
+
+    m->data = base;
+    m->size = len;
+    m->mapped_size = total;
+    return 0;
+}
+
+void turkc_unmap_file(struct turkc_mapping *m)
+{
+    if (m->data)
+        munmap(m->data, m->mapped_size);
+    m->data = NULL;
+    m->size = m->mapped_size = 0;
+}
+
+#endif
+
+char *turkc_read_all(FILE *in, size_t *len)
+{
+    char *buf = NULL, *p;
+    size_t cap = 0, n;
+
+    *len = 0;
+    do {
+        if (*len == cap) {
+            cap = cap ? cap * 2 : 65536;
+            p = realloc(buf, cap);
+            if (!p) {
+                free(buf);
+                return NULL;
+            }
+            buf = p;
+        }
+        n = fread(buf + *len, 1, cap - *len, in);
+        *len += n;
+    } while (n > 0);
+    return buf;
+}
+
+int turkc_load_file(const char *path, struct turkc_file *f)
+{
+    int fd = path ? open(path, O_RDONLY) : fileno(stdin);
+    FILE *in;
+
+    f->data = f->buf = NULL;
+    f->size = 0;
+    f->map.data = NULL;
+    f->map.size = f->map.mapped_size = 0;
+    if (fd < 0)
+        return -1;
+    if (turkc_map_file(fd, &f->map) == 0) {
+        f->data = f->map.data;
+        f->size = f->map.size;
+    } else {
+        in = path ? fopen(path, "rb") : stdin;
+        f->data = f->buf = in ? turkc_read_all(in, &f->size) : NULL;
+        if (path && in)
+            fclose(in);
+    }
+    if (path)
+        close(fd);
+    return f->data ? 0 : -2;
+}
+
+void turkc_unload_file(struct turkc_file *f)
+{
+    turkc_unmap_file(&f->map);
+    free(f->buf);
+    f->data = f->buf = NULL;
+    f->size = 0;
+}
@@ -0,0 +1,55 @@
+#ifndef TURKC_MMAP_H
+#define TURKC_MMAP_H
+
+/* Kaynak dosyayı belleğe map eder (kopyasız okuma).
+ *
+ * Mapping'in sonunda en az iki NUL byte bulunur, böylece doğrudan
+ * yy_scan_buffer'a verilebilir. Sayfalar MAP_PRIVATE ve yazılabilir map
+ * edilir: flex'in yytext için yazdığı geçici NUL dosyaya yansımaz.
+ * Dosya map'liyken başka bir process tarafından kısaltılırsa SIGBUS alınır.
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct turkc_mapping {
+    char *data;             /* data[size] ve data[size + 1] == '\0' */
+    size_t size;            /* dosya boyu */
+    size_t mapped_size;     /* munmap için */
+};
+
+/* fd normal bir dosya değilse (pipe, terminal) veya mmap desteklenmiyorsa
+ * -1 döner; çağıran stream okumaya geri dönmelidir. fd kapatılabilir,
+ * mapping turkc_unmap_file'a kadar geçerli kalır.
+ */
+int turkc_map_file(int fd, struct turkc_mapping *m);
+
+void turkc_unmap_file(struct turkc_mapping *m);
+
+/* Araçların girdisi: map edilmiş dosya ya da okunmuş tampon */
+struct turkc_file {
+    const char *data;
+    size_t size;
+    struct turkc_mapping map;
+    char *buf;              /* okunduysa; sonunda NUL yoktur */
+};
+
+/* path'i (NULL ise stdin'i) yükler: normal dosya map edilir, pipe ve
+ * Windows'ta sonuna kadar okunur. Başarıda 0; dosya açılamazsa -1, bellek
+ * yetmezse -2. Her durumda turkc_unload_file çağrılabilir.
+ */
+int turkc_load_file(const char *path, struct turkc_file *f);
+void turkc_unload_file(struct turkc_file *f);
+
+/* in'i sonuna kadar malloc'la ayrılan tampona okur; bellek yetmezse NULL */
+char *turkc_read_all(FILE *in, size_t *len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,468 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "turkc_opt.h"
+#include "turkc_token.h"
+
+/* simplify */
+
+/* Tüm işlenenleri aynı değer (veya phi'nin kendisi) olan phi */
+static int trivial_phis(struct turkc_ir_func *f)
+{
+    uint32_t i, j, v, same;
+    int changed = 0, again = 1;
+
+    while (again) {
+        again = 0;
+        for (i = 1; i < f->ninsns; i++) {
+            if (f->insns[i].op != IR_PHI)
+                continue;
+            same = 0;
+            for (j = 0; j < f->insns[i].nargs; j++) {
+                v = f->uses[f->insns[i].args + j].value;
+                if (v == i || v == same)
+                    continue;
+                if (same)
+                    break;
+                same = v;
+            }
+            if (j < f->insns[i].nargs || !same)
+                continue;
+            for (j = 0; j < f->insns[i].nargs; j++)
+                turkc_ir_set_arg(f, i, j, 0);
+            turkc_ir_replace(f, i, same);
+            turkc_ir_remove(f, i);
+            changed = again = 1;
+        }
+    }
+    return changed;
+}
+
+/* Ardıllarının phi'lerinde gelen blok from yerine to olur */
+static void rename_pred(struct turkc_ir_func *f, uint32_t block, uint32_t from, uint32_t to)
+{
+    uint32_t i, j;
+
+    for (i = f->blocks[block].first; i && f->insns[i].op == IR_PHI; i = f->insns[i].next) {
+        for (j = 0; j < f->insns[i].nargs; j++) {
+            if (f->uses[f->insns[i].args + j].block == from)
+                f->uses[f->insns[i].args + j].block = to;
+        }
+    }
+}
+
+/* Tek öncüllü b, tek ardılı b olan öncülüne eklenir */
+static int merge_blocks(struct turkc_ir_func *f)
+{
+    struct turkc_ir_block *b;
+    uint32_t i, p, s, t, j;
+    int changed = 0;
+
+    for (i = 2; i < f->nblocks; i++) {
+        b = &f->blocks[i];
+        if (b->dead || b->npreds != 1)
+            continue;
+        p = f->preds[b->preds];
+        if (p == i || f->insns[f->blocks[p].last].op != IR_JMP)
+            continue;
+        /* tek işlenenli phi'ler */
+        while ((j = b->first) != 0 && f->insns[j].op == IR_PHI) {
+            turkc_ir_replace(f, j, f->uses[f->insns[j].args].value);
+            turkc_ir_remove(f, j);
+        }
+        turkc_ir_remove(f, f->blocks[p].last);
+        while ((j = b->first) != 0)
+            turkc_ir_move(f, j, p, 0);
+        for (s = 0; s < 2; s++) {
+            t = b->succ[s];
+            f->blocks[p].succ[s] = t;
+            if (!t)
+                continue;
+            rename_pred(f, t, i, p);
+            for (j = 0; j < f->blocks[t].npreds; j++) {
+                if (f->preds[f->blocks[t].preds + j] == i)
+                    f->preds[f->blocks[t].preds + j] = p;
+            }
+        }
+        b->succ[0] = b->succ[1] = 0;
+        b->npreds = 0;
+        b->dead = 1;
+        changed = 1;
+    }
+    return changed;
+}
+
+/* Sadece "jmp t" olan b'nin öncülleri doğrudan t'ye atlar. t'nin phi'leri
+ * varsa öncül t'nin öncülü olmamalıdır (aynı kenardan iki değer gelemez);
+ * b'den gelen değer öncülde de tanımlıdır, çünkü b'de komut yoktur. Boşta
+ * kalan b'yi prune siler.
+ */
+static int skip_empty(struct turkc_ir_func *f)
+{
+    struct turkc_ir_block *b;
+    uint32_t i, j, p, t, s, phi;
+    int changed = 0, phis;
+
+    for (i = 2; i < f->nblocks; i++) {
+        b = &f->blocks[i];
+        if (b->dead || b->first != b->last || f->insns[b->first].op != IR_JMP)
+            continue;
+        t = b->succ[0];
+        /* hedef de boşsa önce o atlanır; boş döngüde durur */
+        if (f->blocks[t].first == f->blocks[t].last && f->insns[f->blocks[t].last].op == IR_JMP)
+            continue;
+        phis = f->insns[f->blocks[t].first].op == IR_PHI;
+        for (j = 0; j < b->npreds; j++) {
+            p = f->preds[b->preds + j];
+            s = f->blocks[p].succ[0] == i ? 0 : 1;
+            if (f->blocks[p].succ[s] != i)
+                continue;       /* liste bu taramada eskidi */
+            if (f->blocks[p].succ[!s] == t) {
+                if (phis)
+                    continue;
+                /* br'nin iki ardılı aynı oldu: jmp */
+                turkc_ir_remove(f, f->blocks[p].last);
+                if (!turkc_ir_insert(f, p, 0, IR_JMP, 0, 0))
+                    return changed;
+                f->blocks[p].succ[0] = t;
+                f->blocks[p].succ[1] = 0;
+                changed = 1;
+                continue;
+            }
+            for (phi = f->blocks[t].first; f->insns[phi].op == IR_PHI; phi = f->insns[phi].next)
+                turkc_ir_phi_add(f, phi, p, turkc_ir_phi_value(f, phi, i));
+            f->blocks[p].succ[s] = t;
+            changed = 1;
+        }
+    }
+    if (changed)
+        turkc_ir_cfg(f);
+    return changed;
+}
+
+int turkc_opt_simplify(const struct turkc_ir *ir, struct turkc_ir_func *f, int arg)
+{
+    int changed = 0, again = 1;
+
+    (void)ir;
+    (void)arg;
+    turkc_ir_cfg(f);
+    while (again && !f->oom) {
+        again = turkc_ir_prune(f);
+        again |= trivial_phis(f);
+        again |= merge_blocks(f);
+        again |= skip_empty(f);
+        changed |= again;
+    }
+    return changed;
+}
+
+/* sccp: Wegman ve Zadeck, "Constant Propagation with Conditional
+ * Branches". Her değer TOP (henüz bilinmiyor), CONST veya BOTTOM (sabit
+ * değil) olur ve sadece aşağı iner. Sadece çalışabilir kenarlardan gelen
+ * phi işlenenleri sayılır, böylece sabit koşullu dalın ölü tarafı diğer
+ * değerleri bozmaz.
+ */
+
+enum { TOP, CONSTANT, BOTTOM };
+
+/* block.mark bitleri */
+#define EXEC_SUCC0      1
+#define EXEC_SUCC1      2
+#define EXEC_BLOCK      4
+#define VISITED         8
+#define TAKE_SUCC0      16      /* br koşulu sabit */
+#define TAKE_SUCC1      32
+
+struct sccp {
+    struct turkc_ir_func *f;
+    uint8_t *state;
+    int32_t *value;
+    uint32_t *blocks, nblocks;      /* ziyaret edilecek bloklar */
+    uint32_t *values, nvalues;      /* kullanıcıları yeniden hesaplanacak değerler */
+    uint8_t *queued;                /* values'ta mı */
+};
+
+static const uint8_t fold_token[] = {
+    TK_PLUS, TK_MINUS, TK_STAR, TK_SLASH, TK_PERCENT,
+    TK_EQ, TK_NE, TK_LT, TK_GT, TK_LE, TK_GE
+};
+
+static int edge_exec(const struct turkc_ir_func *f, uint32_t from, uint32_t to)
+{
+    const struct turkc_ir_block *b = &f->blocks[from];
+
+    return (b->succ[0] == to && (b->mark & EXEC_SUCC0)) ||
+           (b->succ[1] == to && (b->mark & EXEC_SUCC1));
+}
+
+static void mark_edge(struct sccp *c, uint32_t b, int s)
+{
+    struct turkc_ir_block *bl = &c->f->blocks[b], *t;
+
+    if (bl->mark & (s ? EXEC_SUCC1 : EXEC_SUCC0))
+        return;
+    bl->mark |= s ? EXEC_SUCC1 : EXEC_SUCC0;
+    t = &c->f->blocks[bl->succ[s]];
+    t->mark |= EXEC_BLOCK;
+    /* ilk ziyarette tüm blok, sonra sadece phi'ler yeniden hesaplanır */
+    c->blocks[c->nblocks++] = bl->succ[s];
+}
+
+static void lower(struct sccp *c, uint32_t i, int state, int32_t value)
+{
+    if (state == c->state[i] && (state != CONSTANT || value == c->value[i]))
+        return;
+    if (c->state[i] == CONSTANT && state == CONSTANT)
+        state = BOTTOM;     /* iki farklı sabit */
+    if (state < c->state[i])
+        return;
+    c->state[i] = (uint8_t)state;
+    c->value[i] = value;
+    if (!c->queued[i]) {
+        c->queued[i] = 1;
+        c->values[c->nvalues++] = i;
+    }
+}
+
+static void evaluate(struct sccp *c, uint32_t i)
+{
+    struct turkc_ir_func *f = c->f;
+    const struct turkc_ir_insn *in = &f->insns[i];
+    const struct turkc_ir_use *a = &f->uses[in->args];
+    uint32_t j, x, y;
+    int state = TOP;
+    int32_t value = 0;
+
+    switch (in->op) {
+    case IR_CONST:
+        lower(c, i, CONSTANT, in->k);
+        return;
+    case IR_PHI:
+        for (j = 0; j < in->nargs && state != BOTTOM; j++) {
+            x = a[j].value;
+            if (!edge_exec(f, a[j].block, in->block) || c->state[x] == TOP)
+                continue;
+            if (c->state[x] == BOTTOM || (state == CONSTANT && c->value[x] != value)) {
+                state = BOTTOM;
+            } else {
+                state = CONSTANT;
+                value = c->value[x];
+            }
+        }
+        if (state != TOP)
+            lower(c, i, state, value);
+        return;
+    case IR_ADD: case IR_SUB: case IR_MUL: case IR_DIV: case IR_MOD:
+    case IR_EQ: case IR_NE: case IR_LT: case IR_GT: case IR_LE: case IR_GE:
+        x = a[0].value;
+        y = a[1].value;
+        /* x * 0 = 0, x bilinmese de */
+        if (in->op == IR_MUL && ((c->state[x] == CONSTANT && c->value[x] == 0) ||
+                                 (c->state[y] == CONSTANT && c->value[y] == 0))) {
+            lower(c, i, CONSTANT, 0);
+            return;
+        }
+        if (c->state[x] == BOTTOM || c->state[y] == BOTTOM) {
+            lower(c, i, BOTTOM, 0);
+        } else if (c->state[x] == CONSTANT && c->state[y] == CONSTANT) {
+            /* sıfıra bölme çalışırken hata verir */
+            if (c->value[y] == 0 && (in->op == IR_DIV || in->op == IR_MOD))
+                lower(c, i, BOTTOM, 0);
+            else
+                lower(c, i, CONSTANT, turkc_binop(fold_token[in->op - IR_ADD], c->value[x], c->value[y]));
+        }
+        return;
+    case IR_NEG:
+        x = a[0].value;
+        if (c->state[x] != TOP)
+            lower(c, i, c->state[x], (int32_t)(0u - (uint32_t)c->value[x]));
+        return;
+    case IR_PARAM:
+    case IR_LOADG:
+    case IR_CALL:
+        lower(c, i, BOTTOM, 0);
+        return;
+    case IR_JMP:
+        mark_edge(c, in->block, 0);
+        return;
+    case IR_BR:
+        x = a[0].value;
+        if (c->state[x] == CONSTANT) {
+            mark_edge(c, in->block, c->value[x] ? 0 : 1);
+        } else if (c->state[x] == BOTTOM) {
+            mark_edge(c, in->block, 0);
+            mark_edge(c, in->block, 1);
+        }
+        return;
+    }
+}
+
+static void visit(struct sccp *c, uint32_t b)
+{
+    struct turkc_ir_func *f = c->f;
+    uint32_t i;
+    int all = !(f->blocks[b].mark & VISITED);
+
+    f->blocks[b].mark |= VISITED;
+    for (i = f->blocks[b].first; i; i = f->insns[i].next) {
+        if (!all && f->insns[i].op != IR_PHI)
+            break;
+        evaluate(c, i);
+    }
+}
+
+/* Sabit değerler, BR'ler ve ölü bloklar */
+static int rewrite(struct sccp *c)
+{
+    struct turkc_ir_func *f = c->f;
+    uint32_t b, i, next, at, k, s, n = f->ninsns;
+    int changed = 0;
+
+    /* koşullar aşağıda sabitle değişmeden, state dizisi yeni komutları kapsamaz */
+    for (b = 1; b < f->nblocks; b++) {
+        i = f->blocks[b].last;
+        if (f->blocks[b].dead || !(f->blocks[b].mark & EXEC_BLOCK) || f->insns[i].op != IR_BR)
+            continue;
+        k = f->uses[f->insns[i].args].value;
+        if (c->state[k] == CONSTANT)
+            f->blocks[b].mark |= c->value[k] ? TAKE_SUCC0 : TAKE_SUCC1;
+    }
+    for (b = 1; b < f->nblocks; b++) {
+        if (f->blocks[b].dead || !(f->blocks[b].mark & EXEC_BLOCK))
+            continue;
+        for (at = f->blocks[b].first; f->insns[at].op == IR_PHI; at = f->insns[at].next)
+            ;
+        for (i = f->blocks[b].first; i; i = next) {
+            next = f->insns[i].next;
+            /* phi için eklenen sabitler state'te yok */
+            if (i >= n || c->state[i] != CONSTANT || f->insns[i].op == IR_CONST ||
+                turkc_ir_is_void(f->insns[i].op))
+                continue;
+            /* phi'nin yerine gelen sabit phi'lerden sonra durur */
+            k = turkc_ir_insert(f, b, f->insns[i].op == IR_PHI ? at : i, IR_CONST, c->value[i], 0);
+            if (!k)
+                return changed;
+            f->insns[k].node = f->insns[i].node;
+            turkc_ir_replace(f, i, k);
+            turkc_ir_remove(f, i);
+            changed = 1;
+        }
+        if (!(f->blocks[b].mark & (TAKE_SUCC0 | TAKE_SUCC1)))
+            continue;
+        i = f->blocks[b].last;
+        s = (f->blocks[b].mark & TAKE_SUCC0) ? 0 : 1;
+        /* alınmayan taraf bu bloktan gelen phi işlenenlerini kaybeder */
+        for (k = f->blocks[f->blocks[b].succ[!s]].first; f->insns[k].op == IR_PHI; k = f->insns[k].next)
+            turkc_ir_phi_drop(f, k, b);
+        turkc_ir_remove(f, i);
+        if (!turkc_ir_insert(f, b, 0, IR_JMP, 0, 0))
+            return changed;
+        f->blocks[b].succ[0] = f->blocks[b].succ[s];
+        f->blocks[b].succ[1] = 0;
+        changed = 1;
+    }
+    /* çalışamayan bloklar artık ulaşılamaz */
+    turkc_ir_cfg(f);
+    return turkc_ir_prune(f) | changed;
+}
+
+int turkc_opt_sccp(const struct turkc_ir *ir, struct turkc_ir_func *f, int arg)
+{
+    struct sccp c;
+    uint32_t b, v, u, user;
+    int changed = 0;
+
+    (void)ir;
+    (void)arg;
+    memset(&c, 0, sizeof(c));
+    c.f = f;
+    c.state = calloc(f->ninsns, 1);
+    c.value = calloc(f->ninsns, sizeof(*c.value));
+    c.queued = calloc(f->ninsns, 1);
+    c.values = malloc(f->ninsns * sizeof(*c.values));
+    /* her kenar bir kez işaretlenir */
+    c.blocks = malloc((2 * (size_t)f->nblocks + 1) * sizeof(*c.blocks));
+    if (!c.state || !c.value || !c.queued || !c.values || !c.blocks) {
+        f->oom = 1;
+        goto out;
+    }
+    turkc_ir_cfg(f);
+    for (b = 1; b < f->nblocks; b++)
+        f->blocks[b].mark = 0;
+    f->blocks[1].mark = EXEC_BLOCK;
+    c.blocks[c.nblocks++] = 1;
+    while (c.nblocks || c.nvalues) {
+        while (c.nblocks) {
+            b = c.blocks[--c.nblocks];
+            visit(&c, b);
+        }
+        while (c.nvalues && !c.nblocks) {
+            v = c.values[--c.nvalues];
+            c.queued[v] = 0;
+            for (u = f->insns[v].uses; u; u = f->uses[u].next) {
+                user = f->uses[u].user;
+                if (f->blocks[f->insns[user].block].mark & VISITED)
+                    evaluate(&c, user);
+            }
+        }
+    }
+    changed = rewrite(&c);
+
+out:
+    free(c.state);
+    free(c.value);
+    free(c.queued);
+    free(c.values);
+    free(c.blocks);
+    return changed;
+}
+
+/* dce: etkisi olan komutlardan (turkc_ir_has_effect) işlenenler boyunca
+ * ulaşılan komutlar canlıdır, kalanlar silinir. Birbirini kullanan ölü
+ * phi döngüleri de gider.
+ */
+int turkc_opt_dce(const struct turkc_ir *ir, struct turkc_ir_func *f, int arg)
+{
+    uint32_t *stack, sp = 0, b, i, j, v, next;
+    int changed = 0;
+
+    (void)ir;
+    (void)arg;
+    stack = malloc(f->ninsns * sizeof(*stack));
+    if (!stack) {
+        f->oom = 1;
+        return 0;
+    }
+    for (i = 1; i < f->ninsns; i++)
+        f->insns[i].mark = 0;
+    for (b = 1; b < f->nblocks; b++) {
+        for (i = f->blocks[b].first; i && !f->blocks[b].dead; i = f->insns[i].next) {
+            if (turkc_ir_has_effect(f, i)) {
+                f->insns[i].mark = 1;
+                stack[sp++] = i;
+            }
+        }
+    }
+    while (sp) {
+        i = stack[--sp];
+        for (j = 0; j < f->insns[i].nargs; j++) {
+            v = f->uses[f->insns[i].args + j].value;
+            if (v && !f->insns[v].mark) {
+                f->insns[v].mark = 1;
+                stack[sp++] = v;
+            }
+        }
+    }
+    for (b = 1; b < f->nblocks; b++) {
+        for (i = f->blocks[b].first; i && !f->blocks[b].dead; i = next) {
+            next = f->insns[i].next;
+            if (!f->insns[i].mark) {
+                turkc_ir_remove(f, i);
+                changed = 1;
+            }
+        }
+    }
+    free(stack);
+    return changed;
+}
@@ -0,0 +1,47 @@
+#ifndef TURKC_OPT_H
+#define TURKC_OPT_H
+
+/* IR optimizasyon geçişleri (turkc_ir.h). Geçiş bir fonksiyonu yerinde
+ * değiştirir ve değişiklik yaptıysa 1 döner; bellek yetmezse f->oom
+ * kurulur. Geçişten sonra öncüller günceldir. arg geçiş listesindeki
+ * "isim=N"nin N'idir, verilmediyse 0. Geçişler isimleriyle turkc_pass.h'tan
+ * çalıştırılır:
+ *
+ *   simplify   girişten ulaşılamayan blokları siler, tek öncüllü bloğu
+ *              tek ardıllı öncülüyle birleştirir, sadece jmp içeren
+ *              blokları atlar, tüm işlenenleri aynı olan phi'leri siler
+ *   sccp       seyrek koşullu sabit yayılımı: sabit işlenenli komutları
+ *              katlar, koşulu sabit olan br'yi jmp yapar ve hiç
+ *              çalışamayacak blokları (ölü eger/degilse dalları) siler
+ *   dce        etkisi olmayan ve sonucu etkili bir komuta ulaşmayan
+ *              komutları siler
+ *   licm       döngüde değişmeyen komutları döngünün önbaşlığına taşır
+ *   ivsr       tümevarım değişkeniyle çarpımı her turda toplanan yeni bir
+ *              değişkenle değiştirir
+ *   unroll     tur sayısı bilinen tek bloklu döngüyü arg (varsayılan
+ *              TURKC_OPT_UNROLL) kez açar, artan turları önbaşlığa kopyalar
+ *
+ * Döngü geçişleri turkc_loop.c'dedir.
+ */
+
+#include "turkc_ir.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* unroll=N verilmediğinde */
+#define TURKC_OPT_UNROLL        4
+
+int turkc_opt_simplify(const struct turkc_ir *ir, struct turkc_ir_func *f, int arg);
+int turkc_opt_sccp(const struct turkc_ir *ir, struct turkc_ir_func *f, int arg);
+int turkc_opt_dce(const struct turkc_ir *ir, struct turkc_ir_func *f, int arg);
+int turkc_opt_licm(const struct turkc_ir *ir, struct turkc_ir_func *f, int arg);
+int turkc_opt_ivsr(const struct turkc_ir *ir, struct turkc_ir_func *f, int arg);
+int turkc_opt_unroll(const struct turkc_ir *ir, struct turkc_ir_func *f, int arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
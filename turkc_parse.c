@@ -0,0 +1,570 @@
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "turkc_fastlex.h"
+#include "turkc_parse.h"
+#include "turkc_token.h"
+
+struct parser {
+    struct turkc_ast *ast;
+    const struct turkc_token_source *src;
+    struct turkc_token tok;     /* sıradaki token (tek ileri bakış) */
+    int kind;
+    unsigned depth;
+    struct frame *stack;        /* ifade yığını (bkz. expression) */
+    size_t top, cap;
+    struct turkc_parse_error *err;
+    jmp_buf fail;
+};
+
+/* Düğüm pointer'ı turkc_ast_add'de geçersizleşir: alt düğümler önce
+ * ayrıştırılıp yerel değişkene alınır, sonra NODE(...)->alan = değişken.
+ */
+#define NODE(p, i)  (&(p)->ast->nodes[i])
+
+/* Hata: mesaj sıradaki token'ın konumuyla yazılır, turkc_parse'a dönülür */
+static void fail(struct parser *p, const char *fmt, ...)
+{
+    va_list ap;
+
+    if (p->err) {
+        va_start(ap, fmt);
+        vsnprintf(p->err->message, sizeof(p->err->message), fmt, ap);
+        va_end(ap);
+        p->err->offset = p->tok.offset;
+        p->err->line = p->tok.line;
+        p->err->column = p->tok.column;
+    }
+    longjmp(p->fail, 1);
+}
+
+/* Lexer '\r'yi whitespace saymaz (UNKNOWN verir); CRLF'li kaynaklar için
+ * burada atlanır
+ */
+static void advance(struct parser *p)
+{
+    const char *msg;
+
+    do
+        p->kind = p->src->next(p->src->lexer, &p->tok);
+    while (p->kind == TK_UNKNOWN && p->tok.length == 1 && p->tok.text[0] == '\r');
+    if (p->kind < 0) {
+        msg = p->src->error ? p->src->error(p->src->lexer) : NULL;
+        fail(p, "%s", msg ? msg : "lexer hatasi");
+    }
+}
+
+/* Mesajlar için sıradaki token: 'x' veya "dosya sonu" */
+static const char *describe(struct parser *p, char *buf, size_t size)
+{
+    if (p->kind == TK_EOF)
+        return "dosya sonu";
+    snprintf(buf, size, "'%.*s'", p->tok.length > 16 ? 16 : (int)p->tok.length, p->tok.text);
+    return buf;
+}
+
+static void expected(struct parser *p, const char *what)
+{
+    char buf[24];
+
+    fail(p, "beklenen %s, bulunan %s", what, describe(p, buf, sizeof(buf)));
+}
+
+static void expect(struct parser *p, int kind)
+{
+    char what[8];
+
+    if (p->kind != kind) {
+        snprintf(what, sizeof(what), "'%s'", turkc_token_spelling(kind));
+        expected(p, what);
+    }
+    advance(p);
+}
+
+static int accept(struct parser *p, int kind)
+{
+    if (p->kind != kind)
+        return 0;
+    advance(p);
+    return 1;
+}
+
+static uint32_t add(struct parser *p, int kind)
+{
+    uint32_t i = turkc_ast_add(p->ast, kind, (uint32_t)p->tok.offset);
+
+    if (!i)
+        fail(p, "bellek yetersiz");
+    return i;
+}
+
+/* Sıradaki token'ın metni (identifier veya string); token tüketilmez */
+static uint32_t symbol(struct parser *p)
+{
+    uint32_t id = turkc_intern(p->ast->syms, p->tok.text, p->tok.length);
+
+    if (id == TURKC_INTERN_NONE)
+        fail(p, "bellek yetersiz");
+    return id;
+}
+
+static uint32_t name(struct parser *p)
+{
+    uint32_t id;
+
+    if (p->kind != TK_IDENTIFIER)
+        expected(p, "isim");
+    id = symbol(p);
+    advance(p);
+    return id;
+}
+
+static void enter(struct parser *p)
+{
+    if (++p->depth > TURKC_PARSE_MAX_DEPTH)
+        fail(p, "cok derin ic ice yapi");
+}
+
+/* ---- İfadeler ---- */
+
+/* İkili operatörlerin önceliği (büyük olan sıkı bağlar), 0: operatör değil.
+ * Öncelikler C'ninkilerdir; sadece atama sağa bağlıdır.
+ */
+enum { PREC_NONE, PREC_ASSIGN, PREC_EQUALITY, PREC_RELATIONAL, PREC_ADDITIVE, PREC_TERM, PREC_UNARY };
+
+static const struct { uint8_t prec, right; } infix[TK_COUNT] = {
+    [TK_ASSIGN]  = { PREC_ASSIGN, 1 },
+    [TK_EQ]      = { PREC_EQUALITY, 0 },
+    [TK_NE]      = { PREC_EQUALITY, 0 },
+    [TK_LT]      = { PREC_RELATIONAL, 0 },
+    [TK_GT]      = { PREC_RELATIONAL, 0 },
+    [TK_LE]      = { PREC_RELATIONAL, 0 },
+    [TK_GE]      = { PREC_RELATIONAL, 0 },
+    [TK_PLUS]    = { PREC_ADDITIVE, 0 },
+    [TK_MINUS]   = { PREC_ADDITIVE, 0 },
+    [TK_STAR]    = { PREC_TERM, 0 },
+    [TK_SLASH]   = { PREC_TERM, 0 },
+    [TK_PERCENT] = { PREC_TERM, 0 },
+};
+
+/* Yarım kalmış yapılar. BINARY/NEG düğümü işlenenini bekler; PAREN ve CALL
+ * ')' (CALL ayrıca ',') bekler ve altlarındaki operatörleri ayırır.
+ */
+enum { FR_BINARY, FR_NEG, FR_PAREN, FR_CALL };
+
+struct frame {
+    uint32_t node;              /* BINARY/ASSIGN, NEG veya CALL düğümü */
+    uint32_t last;              /* CALL: son argüman */
+    uint8_t kind;
+    uint8_t prec;               /* BINARY: operatör önceliği, NEG: PREC_UNARY */
+};
+
+static void push(struct parser *p, int kind, uint32_t node, int prec)
+{
+    struct frame *f;
+
+    if (p->top == p->cap) {
+        f = realloc(p->stack, (p->cap ? p->cap * 2 : 64) * sizeof(*f));
+        if (!f)
+            fail(p, "bellek yetersiz");
+        p->stack = f;
+        p->cap = p->cap ? p->cap * 2 : 64;
+    }
+    f = &p->stack[p->top++];
+    f->node = node;
+    f->last = 0;
+    f->kind = (uint8_t)kind;
+    f->prec = (uint8_t)prec;
+}
+
+static uint32_t number(struct parser *p)
+{
+    uint32_t n = add(p, ND_NUMBER);
+    unsigned long v = 0;
+    size_t i;
+
+    for (i = 0; i < p->tok.length; i++) {
+        v = v * 10 + (unsigned long)(p->tok.text[i] - '0');
+        if (v > 2147483647UL)
+            fail(p, "sayi cok buyuk");
+    }
+    NODE(p, n)->a = (uint32_t)v;
+    advance(p);
+    return n;
+}
+
+/* Pratt ayrıştırıcısı, özyinelemesiz: bekleyen operatörler, parantezler ve
+ * çağrılar p->stack'tedir. Sola bağlı zincirler (i + 1 + 1 ...) yığını
+ * büyütmez; iç içe parantez ve sağa bağlı zincirler sadece heap'teki yığını
+ * büyütür, C yığınını değil. Her token bir kez itilir ve bir kez indirilir.
+ */
+static uint32_t expression(struct parser *p)
+{
+    size_t base = p->top;
+    uint32_t x, n, sym;
+    struct frame *f;
+    int prec;
+
+    for (;;) {
+        /* önek konumu: işlenen bekleniyor */
+        switch (p->kind) {
+        case TK_MINUS:
+            push(p, FR_NEG, add(p, ND_NEG), PREC_UNARY);
+            advance(p);
+            continue;
+        case TK_LPAREN:
+            push(p, FR_PAREN, 0, PREC_NONE);
+            advance(p);
+            continue;
+        case TK_NUMBER:
+            x = number(p);
+            break;
+        case TK_STRING:
+            x = add(p, ND_STRING);
+            sym = symbol(p);
+            NODE(p, x)->a = sym;
+            advance(p);
+            break;
+        case TK_IDENTIFIER:
+            x = add(p, ND_NAME);
+            sym = name(p);
+            NODE(p, x)->a = sym;
+            if (p->kind != TK_LPAREN)
+                break;
+            NODE(p, x)->kind = ND_CALL;
+            advance(p);
+            if (p->kind != TK_RPAREN) {
+                push(p, FR_CALL, x, PREC_NONE);
+                continue;
+            }
+            advance(p);
+            break;
+        default:
+            expected(p, "ifade");
+        }
+
+        /* ek konumu: x tamam; sıradaki operatörden sıkı bağlananları indir */
+        for (;;) {
+            prec = infix[p->kind].prec;
+            while (p->top > base) {
+                f = &p->stack[p->top - 1];
+                if (f->kind == FR_PAREN || f->kind == FR_CALL)
+                    break;
+                if (f->prec < prec || (f->prec == prec && infix[p->kind].right))
+                    break;
+                if (f->kind == FR_NEG)
+                    NODE(p, f->node)->a = x;
+                else
+                    NODE(p, f->node)->b = x;
+                x = f->node;
+                p->top--;
+            }
+            if (prec) {
+                if (p->kind == TK_ASSIGN) {
+                    if (NODE(p, x)->kind != ND_NAME)
+                        fail(p, "atamanin solu isim olmali");
+                    n = add(p, ND_ASSIGN);
+                    NODE(p, n)->offset = NODE(p, x)->offset;
+                } else {
+                    n = add(p, ND_BINARY);
+                    NODE(p, n)->op = (uint8_t)p->kind;
+                }
+                NODE(p, n)->a = x;
+                push(p, FR_BINARY, n, prec);
+                advance(p);
+                break;
+            }
+            if (p->top == base)
+                return x;
+            f = &p->stack[p->top - 1];
+            if (f->kind == FR_CALL && (p->kind == TK_COMMA || p->kind == TK_RPAREN)) {
+                if (f->last)
+                    NODE(p, f->last)->next = x;
+                else
+                    NODE(p, f->node)->b = x;
+                f->last = x;
+                if (p->kind == TK_COMMA) {
+                    advance(p);
+                    break;
+                }
+                x = f->node;
+            } else if (p->kind != TK_RPAREN) {
+                expected(p, "')'");
+            }
+            p->top--;
+            advance(p);
+        }
+    }
+}
+
+/* ---- Deyimler ---- */
+
+static uint32_t statement(struct parser *p);
+
+/* "int isim [= ifade]", ';' çağırana kalır */
+static uint32_t variable(struct parser *p)
+{
+    uint32_t n = add(p, ND_VAR), sym, init = 0;
+
+    expect(p, TK_INT);
+    sym = name(p);
+    if (accept(p, TK_ASSIGN))
+        init = expression(p);
+    NODE(p, n)->a = init;
+    NODE(p, n)->c = sym;
+    return n;
+}
+
+static uint32_t block(struct parser *p)
+{
+    uint32_t n = add(p, ND_BLOCK), first = 0, last = 0, s;
+
+    expect(p, TK_LBRACE);
+    while (p->kind != TK_RBRACE) {
+        if (p->kind == TK_EOF)
+            expected(p, "'}'");
+        s = statement(p);
+        if (!s)
+            continue;           /* boş deyim */
+        if (last)
+            NODE(p, last)->next = s;
+        else
+            first = s;
+        last = s;
+    }
+    advance(p);
+    NODE(p, n)->a = first;
+    return n;
+}
+
+static uint32_t paren_expression(struct parser *p)
+{
+    uint32_t x;
+
+    expect(p, TK_LPAREN);
+    x = expression(p);
+    expect(p, TK_RPAREN);
+    return x;
+}
+
+static uint32_t for_statement(struct parser *p)
+{
+    uint32_t n = add(p, ND_FOR), init = 0, cond = 0, step = 0, body, x;
+
+    advance(p);
+    expect(p, TK_LPAREN);
+    if (p->kind == TK_INT) {
+        init = variable(p);
+    } else if (p->kind != TK_SEMI) {
+        init = add(p, ND_EXPR);
+        x = expression(p);
+        NODE(p, init)->a = x;
+    }
+    expect(p, TK_SEMI);
+    if (p->kind != TK_SEMI)
+        cond = expression(p);
+    expect(p, TK_SEMI);
+    if (p->kind != TK_RPAREN)
+        step = expression(p);
+    expect(p, TK_RPAREN);
+    body = statement(p);
+    NODE(p, n)->a = init;
+    NODE(p, n)->b = cond;
+    NODE(p, n)->c = step;
+    NODE(p, n)->d = body;
+    return n;
+}
+
+/* Boş deyimde (';') 0 döner */
+static uint32_t statement(struct parser *p)
+{
+    uint32_t n, a = 0, b = 0, c = 0;
+
+    enter(p);
+    switch (p->kind) {
+    case TK_LBRACE:
+        n = block(p);
+        break;
+    case TK_INT:
+        n = variable(p);
+        expect(p, TK_SEMI);
+        break;
+    case TK_EGER:
+        n = add(p, ND_IF);
+        advance(p);
+        a = paren_expression(p);
+        b = statement(p);
+        if (accept(p, TK_DEGILSE))
+            c = statement(p);
+        NODE(p, n)->a = a;
+        NODE(p, n)->b = b;
+        NODE(p, n)->c = c;
+        break;
+    case TK_IKEN:
+        n = add(p, ND_WHILE);
+        advance(p);
+        a = paren_expression(p);
+        b = statement(p);
+        NODE(p, n)->a = a;
+        NODE(p, n)->b = b;
+        break;
+    case TK_ICIN:
+        n = for_statement(p);
+        break;
+    case TK_DONDUR:
+        n = add(p, ND_RETURN);
+        advance(p);
+        if (p->kind != TK_SEMI)
+            a = expression(p);
+        expect(p, TK_SEMI);
+        NODE(p, n)->a = a;
+        break;
+    case TK_SEMI:
+        advance(p);
+        n = 0;
+        break;
+    default:
+        n = add(p, ND_EXPR);
+        a = expression(p);
+        expect(p, TK_SEMI);
+        NODE(p, n)->a = a;
+        break;
+    }
+    p->depth--;
+    return n;
+}
+
+/* ---- Bildirimler ---- */
+
+static uint32_t parameters(struct parser *p)
+{
+    uint32_t first = 0, last = 0, n, sym;
+
+    if (p->kind == TK_RPAREN)
+        return 0;
+    if (accept(p, TK_VOID)) {
+        if (p->kind != TK_RPAREN)
+            expected(p, "')'");
+        return 0;
+    }
+    do {
+        n = add(p, ND_PARAM);
+        expect(p, TK_INT);
+        sym = name(p);
+        NODE(p, n)->c = sym;
+        if (last)
+            NODE(p, last)->next = n;
+        else
+            first = n;
+        last = n;
+    } while (accept(p, TK_COMMA));
+    return first;
+}
+
+static uint32_t declaration(struct parser *p)
+{
+    uint32_t offset = (uint32_t)p->tok.offset, n, sym, x;
+    int type = p->kind;
+
+    if (type != TK_INT && type != TK_VOID)
+        expected(p, "tur (int/void)");
+    advance(p);
+    sym = name(p);
+    if (accept(p, TK_LPAREN)) {
+        n = add(p, ND_FUNC);
+        NODE(p, n)->op = (uint8_t)type;
+        NODE(p, n)->c = sym;
+        x = parameters(p);
+        NODE(p, n)->a = x;
+        expect(p, TK_RPAREN);
+        x = block(p);
+        NODE(p, n)->b = x;
+    } else {
+        if (type == TK_VOID)
+            fail(p, "void degisken tanimlanamaz");
+        n = add(p, ND_VAR);
+        NODE(p, n)->c = sym;
+        if (accept(p, TK_ASSIGN)) {
+            x = expression(p);
+            NODE(p, n)->a = x;
+        }
+        expect(p, TK_SEMI);
+    }
+    NODE(p, n)->offset = offset;
+    return n;
+}
+
+static uint32_t program(struct parser *p)
+{
+    uint32_t n = add(p, ND_PROGRAM), first = 0, last = 0, d;
+
+    while (p->kind != TK_EOF) {
+        d = declaration(p);
+        if (last)
+            NODE(p, last)->next = d;
+        else
+            first = d;
+        last = d;
+    }
+    NODE(p, n)->a = first;
+    return n;
+}
+
+/* setjmp'tan sonra değişen yerel kalmasın diye (-Wclobbered) liste program()'da kurulur. */
+int turkc_parse(struct turkc_ast *ast, const struct turkc_token_source *src,
+                struct turkc_parse_error *err)
+{
+    struct parser p;
+
+    memset(&p, 0, sizeof(p));
+    p.ast = ast;
+    p.src = src;
+    p.err = err;
+    if (setjmp(p.fail)) {
+        free(p.stack);
+        return -1;
+    }
+
+    advance(&p);
+    ast->root = program(&p);
+    free(p.stack);
+    return 0;
+}
+
+static int fastlex_next(void *lexer, struct turkc_token *tok)
+{
+    return turkc_fastlex_next(lexer, tok);
+}
+
+static const char *fastlex_error(void *lexer)
+{
+    return ((struct turkc_fastlex *)lexer)->error;
+}
+
+int turkc_parse_buffer(struct turkc_ast *ast, const char *buf, size_t len,
+                       struct turkc_parse_error *err)
+{
+    struct turkc_fastlex fl;
+    struct turkc_token_source src = { fastlex_next, fastlex_error, &fl };
+
+    turkc_fastlex_init(&fl, buf, len, TURKC_SIMD_AUTO);
+    return turkc_parse(ast, &src, err);
+}
+
+void turkc_parse_locate(struct turkc_parse_error *err, const char *buf, size_t len)
+{
+    size_t end = err->offset < len ? err->offset : len, line_start = 0, i;
+    unsigned long line = 1;
+
+    for (i = 0; i < end; i++) {
+        if (buf[i] == '\n') {
+            line++;
+            line_start = i + 1;
+        }
+    }
+    err->line = line;
+    err->column = (unsigned long)(end - line_start + 1);
+}
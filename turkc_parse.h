@@ -0,0 +1,71 @@
+#ifndef TURKC_PARSE_H
+#define TURKC_PARSE_H
+
+/* Elle yazılmış recursive-descent TurkC ayrıştırıcısı.
+ *
+ * Token'ları bir lexer'dan teker teker çeker (bir token ileri bakış) ve
+ * turkc_ast'e düğüm ekler. Gramer spesifikasyon.md'deki C alt kümesidir:
+ *
+ *   program   = { bildirim }
+ *   bildirim  = tür isim ( "(" [ parametreler ] ")" blok | [ "=" ifade ] ";" )
+ *   tür       = "int" | "void"
+ *   deyim     = blok | "int" isim [ "=" ifade ] ";"
+ *             | "eger" "(" ifade ")" deyim [ "degilse" deyim ]
+ *             | "iken" "(" ifade ")" deyim
+ *             | "icin" "(" [ başlangıç ] ";" [ ifade ] ";" [ ifade ] ")" deyim
+ *             | "dondur" [ ifade ] ";" | [ ifade ] ";"
+ *   ifade     = isim "=" ifade | ifade op ifade | "-" ifade | "(" ifade ")"
+ *             | isim "(" [ ifade { "," ifade } ] ")" | sayı | string
+ *
+ * İfadeler öncelik tablosuyla (Pratt) ve açık bir yığınla ayrıştırılır;
+ * öncelikler spesifikasyon.md'dedir. İlk hatada durur; hata mesajı ve
+ * konumu turkc_parse_error'a yazılır.
+ */
+
+#include <stddef.h>
+
+#include "turkc_ast.h"
+#include "turkc_lexer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Token kaynağı: turkc_lexer_next gibi kind (> 0), giriş bitince 0, hata
+ * olursa -1 döner. error -1'den sonra mesajı verir (NULL olabilir).
+ */
+struct turkc_token_source {
+    int (*next)(void *lexer, struct turkc_token *tok);
+    const char *(*error)(void *lexer);
+    void *lexer;
+};
+
+struct turkc_parse_error {
+    char message[128];
+    unsigned long offset, line, column;
+};
+
+/* İç içe deyim sınırı; aşılırsa hata (yığın taşması yerine). İfadelerin
+ * derinliği burada sınırsızdır, sadece belleğe bağlıdır; çalıştırılacak
+ * ağaçlar için sınır turkc_resolve'dadır (TURKC_RESOLVE_MAX_DEPTH).
+ */
+#define TURKC_PARSE_MAX_DEPTH 4096
+
+/* Programı ast'ye ekler, ast->root PROGRAM düğümü olur. Başarıda 0, hata
+ * olursa -1 döner ve err doldurulur (err NULL olabilir).
+ */
+int turkc_parse(struct turkc_ast *ast, const struct turkc_token_source *src,
+                struct turkc_parse_error *err);
+
+/* Bellekteki kaynağı SIMD lexer'ıyla (turkc_fastlex) ayrıştırır */
+int turkc_parse_buffer(struct turkc_ast *ast, const char *buf, size_t len,
+                       struct turkc_parse_error *err);
+
+/* err->offset'ten satır ve sütunu hesaplar (sadece ofset bilen aşamalar için) */
+void turkc_parse_locate(struct turkc_parse_error *err, const char *buf, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,174 @@
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "turkc_opt.h"
+#include "turkc_pass.h"
+#include "turkc_time.h"
+
+const struct turkc_pass turkc_passes[] = {
+    { "simplify", "ulasilamaz bloklari siler, bloklari birlestirir, bos bloklari atlar",
+      turkc_opt_simplify },
+    { "sccp", "sabitleri katlar, sabit kosullu dallari ve olu bloklari siler",
+      turkc_opt_sccp },
+    { "dce", "etkisiz ve kullanilmayan komutlari siler", turkc_opt_dce },
+    { "licm", "dongude degismeyen komutlari onbasliga tasir", turkc_opt_licm },
+    { "ivsr", "tumevarim degiskeniyle carpimi toplamaya cevirir", turkc_opt_ivsr },
+    { "unroll", "tur sayisi bilinen donguyu acar (unroll=N, varsayilan 4)", turkc_opt_unroll },
+    { NULL, NULL, NULL }
+};
+
+const struct turkc_pass *turkc_pass_find(const char *name)
+{
+    const struct turkc_pass *p;
+
+    for (p = turkc_passes; p->name; p++) {
+        if (strcmp(p->name, name) == 0)
+            return p;
+    }
+    return NULL;
+}
+
+static int fail(struct turkc_parse_error *err, const char *fmt, ...)
+{
+    va_list ap;
+
+    va_start(ap, fmt);
+    vsnprintf(err->message, sizeof(err->message), fmt, ap);
+    va_end(ap);
+    err->offset = err->line = err->column = 0;
+    return -1;
+}
+
+void turkc_pm_init(struct turkc_pm *pm)
+{
+    memset(pm, 0, sizeof(*pm));
+    pm->verify = 1;
+}
+
+int turkc_pm_add(struct turkc_pm *pm, const char *list, struct turkc_parse_error *err)
+{
+    const struct turkc_pass *p;
+    char name[64], *eq, *end;
+    long arg = 0;
+    size_t n;
+
+    while (*list) {
+        n = strcspn(list, ",");
+        if (n == 0 || n >= sizeof(name))
+            return fail(err, "gecersiz gecis listesi");
+        memcpy(name, list, n);
+        name[n] = '\0';
+        if ((eq = strchr(name, '='))) {
+            *eq++ = '\0';
+            arg = strtol(eq, &end, 10);
+            if (end == eq || *end || arg <= 0 || arg > 1024)
+                return fail(err, "gecersiz gecis argumani: %s", eq);
+        }
+        if (!(p = turkc_pass_find(name)))
+            return fail(err, "bilinmeyen gecis: %s", name);
+        if (pm->npasses == TURKC_PM_MAX_PASSES)
+            return fail(err, "en fazla %d gecis", TURKC_PM_MAX_PASSES);
+        memset(&pm->passes[pm->npasses], 0, sizeof(pm->passes[0]));
+        pm->passes[pm->npasses].arg = eq ? (int)arg : 0;
+        pm->passes[pm->npasses++].pass = p;
+        list += n + (list[n] == ',');
+    }
+    return 0;
+}
+
+static uint64_t count(const struct turkc_ir *ir)
+{
+    uint64_t n = 0;
+    uint32_t i;
+
+    for (i = 0; i < ir->nfuncs; i++)
+        n += turkc_ir_count(&ir->funcs[i]);
+    return n;
+}
+
+static int verify(struct turkc_pm *pm, struct turkc_ir *ir, const char *after,
+                  struct turkc_parse_error *err)
+{
+    struct turkc_parse_error e;
+    double t0 = turkc_now();
+    uint32_t i;
+
+    for (i = 0; i < ir->nfuncs; i++) {
+        if (turkc_ir_verify(ir, &ir->funcs[i], &e) != 0)
+            return fail(err, "%s sonrasi %s: %s", after,
+                        turkc_ast_symbol(ir->prog->ast, ir->prog->funcs[i].name), e.message);
+    }
+    pm->verify_seconds += turkc_now() - t0;
+    return 0;
+}
+
+/* "simplify", "unroll=8" */
+static const char *label(const struct turkc_pm_entry *e, char *buf, size_t size)
+{
+    if (!e->arg)
+        return e->pass->name;
+    snprintf(buf, size, "%s=%d", e->pass->name, e->arg);
+    return buf;
+}
+
+static void dump(const struct turkc_pm *pm, const struct turkc_ir *ir, const char *name,
+                 const char *when)
+{
+    uint32_t i;
+
+    fprintf(pm->dump, "; %s %s\n", name, when);
+    for (i = 0; i < ir->nfuncs; i++)
+        turkc_ir_print(ir, i, pm->dump);
+}
+
+int turkc_pm_run(struct turkc_pm *pm, struct turkc_ir *ir, struct turkc_parse_error *err)
+{
+    struct turkc_pm_entry *e;
+    uint32_t p, i;
+    char buf[64];
+    double t0;
+    int selected;
+
+    if (pm->verify && verify(pm, ir, "kurulum", err) != 0)
+        return -1;
+    if (pm->dump && !pm->dump_pass)
+        dump(pm, ir, "kurulum", "sonrasi");
+    for (p = 0; p < pm->npasses; p++) {
+        e = &pm->passes[p];
+        selected = pm->dump && (!pm->dump_pass || strcmp(pm->dump_pass, e->pass->name) == 0);
+        if (selected && pm->dump_pass)
+            dump(pm, ir, label(e, buf, sizeof(buf)), "oncesi");
+        e->before = count(ir);
+        t0 = turkc_now();
+        for (i = 0; i < ir->nfuncs; i++) {
+            if (e->pass->run(ir, &ir->funcs[i], e->arg) > 0)
+                e->changed++;
+            if (ir->funcs[i].oom)
+                return fail(err, "bellek yetersiz");
+        }
+        e->seconds += turkc_now() - t0;
+        e->after = count(ir);
+        if (selected)
+            dump(pm, ir, label(e, buf, sizeof(buf)), "sonrasi");
+        if (pm->verify && verify(pm, ir, e->pass->name, err) != 0)
+            return -1;
+    }
+    return 0;
+}
+
+void turkc_pm_report(const struct turkc_pm *pm, FILE *out)
+{
+    const struct turkc_pm_entry *e;
+    uint32_t p;
+    char buf[64];
+
+    for (p = 0; p < pm->npasses; p++) {
+        e = &pm->passes[p];
+        fprintf(out, "%-10s %9.3f ms  %4lu fonksiyon degisti  %8llu -> %8llu komut\n",
+                label(e, buf, sizeof(buf)), e->seconds * 1e3, (unsigned long)e->changed,
+                (unsigned long long)e->before, (unsigned long long)e->after);
+    }
+    if (pm->verify)
+        fprintf(out, "%-10s %9.3f ms\n", "dogrulama", pm->verify_seconds * 1e3);
+}
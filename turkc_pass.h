@@ -0,0 +1,87 @@
+#ifndef TURKC_PASS_H
+#define TURKC_PASS_H
+
+/* Geçiş yöneticisi: IR geçişlerini (turkc_opt.h) sırayla çalıştırır.
+ *
+ *   struct turkc_pm pm;
+ *
+ *   turkc_pm_init(&pm);
+ *   turkc_pm_add(&pm, "licm,unroll=8,sccp,dce", &err);
+ *   turkc_pm_run(&pm, &ir, &err);
+ *   turkc_pm_report(&pm, stderr);
+ *
+ * Her geçiş programdaki tüm fonksiyonlara uygulanır. Yönetici geçiş başına
+ * süreyi, değişen fonksiyon sayısını ve canlı komut sayısını (önce/sonra)
+ * tutar. verify açıksa (varsayılan) IR kurulduktan sonra ve her geçişten
+ * sonra doğrulanır (turkc_ir_verify); hata mesajı bozuk IR'ı üreten
+ * geçişi ve fonksiyonu söyler. dump NULL değilse IR oraya kurulumdan ve
+ * her geçişten sonra yazılır; dump_pass da verilmişse yalnız o isimli
+ * geçişlerden önce ve sonra.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "turkc_ir.h"
+#include "turkc_parse.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* tcir -O */
+#define TURKC_PM_DEFAULT        "simplify,sccp,dce,licm,ivsr,unroll,sccp,dce,simplify"
+
+#define TURKC_PM_MAX_PASSES     64
+
+struct turkc_pass {
+    const char *name;
+    const char *help;
+    /* değişiklik yaptıysa 1; bellek yetmezse f->oom. arg: "isim=N"nin N'i */
+    int (*run)(const struct turkc_ir *ir, struct turkc_ir_func *f, int arg);
+};
+
+/* Kayıtlı geçişler; son elemanın name'i NULL */
+extern const struct turkc_pass turkc_passes[];
+
+/* İsimle geçiş, yoksa NULL */
+const struct turkc_pass *turkc_pass_find(const char *name);
+
+struct turkc_pm_entry {
+    const struct turkc_pass *pass;
+    int arg;                    /* verilmediyse 0 */
+    double seconds;
+    uint32_t changed;           /* değiştirdiği fonksiyon sayısı */
+    uint64_t before, after;     /* canlı komut sayısı */
+};
+
+struct turkc_pm {
+    struct turkc_pm_entry passes[TURKC_PM_MAX_PASSES];
+    uint32_t npasses;
+    int verify;
+    FILE *dump;
+    const char *dump_pass;      /* NULL: hepsi */
+    double verify_seconds;
+};
+
+void turkc_pm_init(struct turkc_pm *pm);
+
+/* Virgülle ayrılmış geçiş isimlerini sona ekler; isim=N geçişe N'i
+ * verir (N > 0). Bilinmeyen isimde, geçersiz N'de veya liste dolunca -1 ve
+ * err.
+ */
+int turkc_pm_add(struct turkc_pm *pm, const char *list, struct turkc_parse_error *err);
+
+/* Geçişleri çalıştırır. Başarıda 0; doğrulama hatasında veya bellek
+ * yetmezse -1 ve err (offset 0).
+ */
+int turkc_pm_run(struct turkc_pm *pm, struct turkc_ir *ir, struct turkc_parse_error *err);
+
+/* Geçiş başına süre ve komut sayısı tablosu */
+void turkc_pm_report(const struct turkc_pm *pm, FILE *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
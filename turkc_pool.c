@@ -0,0 +1,140 @@
+#include <pthread.h>
+#include <stdlib.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "turkc_pool.h"
+
+/* Görevler sabit olduğu için her kuyruk [head, tail) aralığıdır:
+ * sahibi head'den, hırsızlar tail'den alır.
+ */
+struct pool_queue {
+    pthread_mutex_t lock;
+    size_t head, tail;
+};
+
+struct pool {
+    struct pool_queue *queues;
+    int nworkers;
+    turkc_pool_fn fn;
+    void *ctx;
+};
+
+struct pool_worker {
+    struct pool *pool;
+    int id;
+};
+
+int turkc_pool_ncpu(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO si;
+
+    GetSystemInfo(&si);
+    return si.dwNumberOfProcessors > 0 ? (int)si.dwNumberOfProcessors : 1;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return n > 0 ? (int)n : 1;
+#endif
+}
+
+static int pop_own(struct pool_queue *q, size_t *task)
+{
+    int ok = 0;
+
+    pthread_mutex_lock(&q->lock);
+    if (q->head < q->tail) {
+        *task = q->head++;
+        ok = 1;
+    }
+    pthread_mutex_unlock(&q->lock);
+    return ok;
+}
+
+static int steal(struct pool_queue *q, size_t *task)
+{
+    int ok = 0;
+
+    pthread_mutex_lock(&q->lock);
+    if (q->head < q->tail) {
+        *task = --q->tail;
+        ok = 1;
+    }
+    pthread_mutex_unlock(&q->lock);
+    return ok;
+}
+
+static void *worker_main(void *arg)
+{
+    struct pool_worker *w = arg;
+    struct pool *p = w->pool;
+    size_t task = 0;
+    int i, found;
+
+    for (;;) {
+        found = pop_own(&p->queues[w->id], &task);
+        /* Yeni görev eklenmediği için tüm kuyruklar boşsa iş bitmiştir */
+        for (i = 1; !found && i < p->nworkers; i++)
+            found = steal(&p->queues[(w->id + i) % p->nworkers], &task);
+        if (!found)
+            return NULL;
+        p->fn(p->ctx, task, w->id);
+    }
+}
+
+int turkc_pool_run(size_t ntasks, int nworkers, turkc_pool_fn fn, void *ctx)
+{
+    struct pool p;
+    struct pool_worker *workers;
+    pthread_t *threads;
+    int i, started, rc = 0;
+
+    if (nworkers <= 0)
+        nworkers = turkc_pool_ncpu();
+    if ((size_t)nworkers > ntasks)
+        nworkers = ntasks > 0 ? (int)ntasks : 1;
+
+    p.queues = malloc(nworkers * sizeof(*p.queues));
+    workers = malloc(nworkers * sizeof(*workers));
+    threads = malloc(nworkers * sizeof(*threads));
+    if (!p.queues || !workers || !threads) {
+        free(p.queues);
+        free(workers);
+        free(threads);
+        return -1;
+    }
+    p.nworkers = nworkers;
+    p.fn = fn;
+    p.ctx = ctx;
+
+    /* Sıralı bloklar: komşu görevler aynı worker'da kalır */
+    for (i = 0; i < nworkers; i++) {
+        pthread_mutex_init(&p.queues[i].lock, NULL);
+        p.queues[i].head = ntasks * i / nworkers;
+        p.queues[i].tail = ntasks * (i + 1) / nworkers;
+        workers[i].pool = &p;
+        workers[i].id = i;
+    }
+
+    /* Worker 0 çağıran thread'de çalışır */
+    for (started = 1; started < nworkers; started++) {
+        if (pthread_create(&threads[started], NULL, worker_main, &workers[started]) != 0) {
+            rc = -1;
+            break;
+        }
+    }
+    worker_main(&workers[0]);
+    for (i = 1; i < started; i++)
+        pthread_join(threads[i], NULL);
+
+    for (i = 0; i < nworkers; i++)
+        pthread_mutex_destroy(&p.queues[i].lock);
+    free(p.queues);
+    free(workers);
+    free(threads);
+    return rc;
+}
@@ -0,0 +1,33 @@
+#ifndef TURKC_POOL_H
+#define TURKC_POOL_H
+
+/* Work-stealing thread pool (pthreads).
+ *
+ * 0..ntasks-1 arasındaki görevler başta worker'lara sıralı bloklar halinde
+ * dağıtılır. Her worker kendi kuyruğunun önünden alır; kuyruğu boşalınca
+ * diğer worker'ların kuyruklarının sonundan çalar. Böylece büyük bir dosyaya
+ * takılan worker'ın kalan işleri diğerlerine geçer.
+ */
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* worker: 0..nworkers-1, worker'a özel kaynaklar için kullanılabilir */
+typedef void (*turkc_pool_fn)(void *ctx, size_t task, int worker);
+
+/* Tüm görevler bitince döner. nworkers <= 0 ise çekirdek sayısı kullanılır.
+ * Thread açılamazsa -1 döner (açılanlar yine de işleri bitirir).
+ */
+int turkc_pool_run(size_t ntasks, int nworkers, turkc_pool_fn fn, void *ctx);
+
+/* Çevrimiçi çekirdek sayısı (en az 1) */
+int turkc_pool_ncpu(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
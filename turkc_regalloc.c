@@ -0,0 +1,474 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "turkc_regalloc.h"
+
+#define SPILL           INT32_MIN       /* yuvası ikinci taramada verilecek */
+#define MAX_DEPTH       6
+
+struct ra {
+    struct turkc_ir_func *f;
+    struct turkc_ra *out;
+    uint32_t *lin;              /* blok -> yerleşimdeki sırası, 1'den; 0: ulaşılmaz */
+    uint32_t *pos;              /* komut -> konum (2, 4, ...); 0: yerleşimde değil */
+    uint32_t *bend;             /* blok -> sonlandırıcısının konumu */
+    uint32_t *inner;            /* blok -> en içteki döngü, 0: yok */
+    uint32_t *head, *tail, *outer, *depth;   /* döngü başına: ilk ve son konum, dış döngü */
+    uint32_t *stamp, *stack;
+    uint32_t nloops;
+    uint32_t *calls;            /* çağrıların konumları, artan */
+    uint32_t ncalls;
+    uint32_t *end;              /* değer -> aralığın sonu */
+    double *weight;
+    uint32_t *heap;             /* yuva taraması: sonu en yakın değer tepede */
+    uint32_t nheap;
+};
+
+int turkc_ra_fused(const struct turkc_ir_func *f, uint32_t insn)
+{
+    const struct turkc_ir_insn *in = &f->insns[insn], *br;
+
+    if (in->op < IR_EQ || in->op > IR_GE || !in->next)
+        return 0;
+    br = &f->insns[in->next];
+    return br->op == IR_BR && f->uses[br->args].value == insn &&
+           turkc_ir_use_count(f, insn) == 1;
+}
+
+static int needs_loc(const struct turkc_ir_func *f, uint32_t i)
+{
+    int op = f->insns[i].op;
+
+    return op != IR_NOP && op != IR_CONST && !turkc_ir_is_void(op) && !turkc_ra_fused(f, i);
+}
+
+/* Ters sonradan sıra; succ[1] önce gezilir ki succ[0] (döngü gövdesi,
+ * eger'in doğru dalı) bloğun hemen arkasına düşsün.
+ */
+static int layout(struct ra *r)
+{
+    struct turkc_ir_func *f = r->f;
+    uint32_t *order, *next, sp = 0, b, s, n = 0, i;
+
+    order = malloc(f->nblocks * sizeof(*order));
+    next = calloc(f->nblocks, sizeof(*next));
+    if (!order || !next) {
+        free(order);
+        free(next);
+        return -1;
+    }
+    r->stack[sp++] = 1;
+    r->lin[1] = 1;
+    while (sp) {
+        b = r->stack[sp - 1];
+        if (next[b] < 2) {
+            s = f->blocks[b].succ[1 - next[b]++];
+            if (s && !r->lin[s]) {
+                r->lin[s] = 1;
+                r->stack[sp++] = s;
+            }
+            continue;
+        }
+        order[n++] = b;
+        sp--;
+    }
+    for (i = 0; i < n / 2; i++) {
+        b = order[i];
+        order[i] = order[n - 1 - i];
+        order[n - 1 - i] = b;
+    }
+    for (i = 0; i < n; i++)
+        r->lin[order[i]] = i + 1;
+    free(next);
+    r->out->order = order;
+    r->out->norder = n;
+    return 0;
+}
+
+/* Komut konumları ve çağrılar */
+static void number(struct ra *r)
+{
+    struct turkc_ir_func *f = r->f;
+    uint32_t k, b, i, p = 0;
+    int op;
+
+    for (k = 0; k < r->out->norder; k++) {
+        b = r->out->order[k];
+        for (i = f->blocks[b].first; i; i = f->insns[i].next) {
+            r->pos[i] = p += 2;
+            op = f->insns[i].op;
+            if (op == IR_CALL || op == IR_YAZ || op == IR_YAZS)
+                r->calls[r->ncalls++] = p;
+        }
+        r->bend[b] = p;
+    }
+}
+
+/* Doğal döngüler: geri kenarın hedefi başlıktır, gövde geri kenarın
+ * kaynağından geriye yürünerek bulunur. Başlıklar sırayla işlendiği için
+ * dış döngü içtekinden önce gelir ve inner en içtekinde kalır.
+ */
+static void loops(struct ra *r)
+{
+    struct turkc_ir_func *f = r->f;
+    struct turkc_ir_block *bl = f->blocks;
+    uint32_t k, j, h, b, p, L, sp;
+    int back;
+
+    for (k = 0; k < r->out->norder; k++) {
+        h = r->out->order[k];
+        sp = 0;
+        back = 0;
+        L = r->nloops + 1;
+        r->stamp[h] = L;
+        for (j = 0; j < bl[h].npreds; j++) {
+            p = f->preds[bl[h].preds + j];
+            if (r->lin[p] < r->lin[h])
+                continue;
+            back = 1;
+            if (r->stamp[p] != L) {
+                r->stamp[p] = L;
+                r->stack[sp++] = p;
+            }
+        }
+        if (!back) {
+            r->stamp[h] = 0;
+            continue;
+        }
+        r->nloops = L;
+        r->head[L] = r->pos[bl[h].first];
+        r->tail[L] = r->bend[h];
+        r->outer[L] = r->inner[h];
+        r->depth[L] = r->depth[r->inner[h]] + 1;
+        r->inner[h] = L;
+        while (sp) {
+            b = r->stack[--sp];
+            r->inner[b] = L;
+            if (r->bend[b] > r->tail[L])
+                r->tail[L] = r->bend[b];
+            for (j = 0; j < bl[b].npreds; j++) {
+                p = f->preds[bl[b].preds + j];
+                if (r->lin[p] && r->stamp[p] != L) {
+                    r->stamp[p] = L;
+                    r->stack[sp++] = p;
+                }
+            }
+        }
+    }
+}
+
+static double cost(const struct ra *r, uint32_t block)
+{
+    uint32_t d = r->depth[r->inner[block]];
+    double w = 1;
+
+    if (d > MAX_DEPTH)
+        d = MAX_DEPTH;
+    while (d--)
+        w *= 10;
+    return w;
+}
+
+/* Başlık phi'si, geri kenardan phi ± sabit geliyorsa artışı; değilse 0 */
+static uint32_t induction(const struct ra *r, uint32_t phi)
+{
+    const struct turkc_ir_func *f = r->f;
+    const struct turkc_ir_insn *in = &f->insns[phi], *x;
+    const struct turkc_ir_use *u;
+    uint32_t j, a, b;
+
+    for (j = 0; j < in->nargs; j++) {
+        u = &f->uses[in->args + j];
+        if (r->lin[u->block] < r->lin[in->block])
+            continue;
+        x = &f->insns[u->value];
+        if (x->op != IR_ADD && x->op != IR_SUB)
+            return 0;
+        a = f->uses[x->args].value;
+        b = f->uses[x->args + 1].value;
+        if (!(a == phi && f->insns[b].op == IR_CONST) &&
+            !(x->op == IR_ADD && b == phi && f->insns[a].op == IR_CONST))
+            return 0;
+        return u->value;
+    }
+    return 0;
+}
+
+/* Aralık sonları ve maliyetler */
+static void intervals(struct ra *r)
+{
+    struct turkc_ir_func *f = r->f;
+    const struct turkc_ir_insn *in, *user;
+    const struct turkc_ir_use *u;
+    uint32_t i, k, b, d, e, p, L, x;
+
+    for (i = 1; i < f->ninsns; i++) {
+        if (!r->pos[i] || !needs_loc(f, i))
+            continue;
+        in = &f->insns[i];
+        d = r->pos[i];
+        e = d;
+        r->weight[i] += cost(r, in->block);
+        for (k = in->uses; k; k = u->next) {
+            u = &f->uses[k];
+            user = &f->insns[u->user];
+            if (user->op == IR_PHI) {
+                b = u->block;
+                p = r->bend[b];
+            } else {
+                b = user->block;
+                p = r->pos[u->user] + 2 * turkc_ra_fused(f, u->user);
+            }
+            if (!r->lin[b])
+                continue;
+            r->weight[i] += cost(r, b);
+            for (L = r->inner[b]; L && r->head[L] > d; L = r->outer[L]) {
+                if (r->tail[L] > p)
+                    p = r->tail[L];
+            }
+            if (p > e)
+                e = p;
+        }
+        r->end[i] = e;
+        /* uzun ve seyrek kullanılan aralık ucuzdur */
+        r->weight[i] /= e - d + 2;
+    }
+    for (i = 1; i < f->ninsns; i++) {
+        if (r->pos[i] && f->insns[i].op == IR_PHI && (x = induction(r, i)) != 0) {
+            r->weight[i] *= TURKC_RA_IV_WEIGHT;
+            if (needs_loc(f, x))
+                r->weight[x] *= TURKC_RA_IV_WEIGHT;
+        }
+    }
+}
+
+/* [start, end) içinde bir çağrı var mı; tanımı veya son kullanımı olan
+ * çağrı sayılmaz
+ */
+static int crosses(const struct ra *r, uint32_t start, uint32_t end)
+{
+    uint32_t lo = 0, hi = r->ncalls, mid;
+
+    while (lo < hi) {
+        mid = lo + (hi - lo) / 2;
+        if (r->calls[mid] <= start)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo < r->ncalls && r->calls[lo] < end;
+}
+
+static int in_reg(const struct ra *r, uint32_t v)
+{
+    int32_t loc = r->out->loc[v];
+
+    return loc >= 0 && loc < TURKC_RA_REGS;
+}
+
+/* Tercih edilen yazmaç: değerin girdiği phi'ninki, phi ise işleneninki,
+ * değilse burada biten ilk işleneninki (kopya ve iki işlenenli komut
+ * kalkar); yoksa -1
+ */
+static int hint(const struct ra *r, uint32_t i)
+{
+    const struct turkc_ir_func *f = r->f;
+    const struct turkc_ir_insn *in = &f->insns[i];
+    const struct turkc_ir_use *u;
+    uint32_t k, a;
+
+    for (k = in->uses; k; k = u->next) {
+        u = &f->uses[k];
+        if (f->insns[u->user].op == IR_PHI && in_reg(r, u->user))
+            return r->out->loc[u->user];
+    }
+    for (k = 0; k < in->nargs; k++) {
+        a = f->uses[in->args + k].value;
+        if (in->op == IR_PHI && in_reg(r, a))
+            return r->out->loc[a];
+        if (in->op != IR_PHI && in->op != IR_CALL && in_reg(r, a) && r->end[a] <= r->pos[i])
+            return r->out->loc[a];
+    }
+    return -1;
+}
+
+static void scan(struct ra *r, int nregs)
+{
+    struct turkc_ir_func *f = r->f;
+    struct turkc_ra *out = r->out;
+    uint32_t active[TURKC_RA_REGS] = { 0 };
+    uint32_t k, i, b, v, start;
+    int reg, lim, c, cross;
+
+    for (k = 0; k < out->norder; k++) {
+        b = out->order[k];
+        for (i = f->blocks[b].first; i; i = f->insns[i].next) {
+            if (!needs_loc(f, i))
+                continue;
+            out->values++;
+            start = r->pos[i];
+            for (c = 0; c < nregs; c++) {
+                if (active[c] && r->end[active[c]] <= start)
+                    active[c] = 0;
+            }
+            cross = crosses(r, start, r->end[i]);
+            lim = cross ? (nregs < TURKC_RA_CALLEE ? nregs : TURKC_RA_CALLEE) : nregs;
+            reg = hint(r, i);
+            if (reg >= lim || (reg >= 0 && active[reg]))
+                reg = -1;
+            /* çağrı üzerinden geçmeyen önce bozulan yazmaçlara */
+            for (c = TURKC_RA_CALLEE; c < lim && reg < 0; c++) {
+                if (!active[c])
+                    reg = c;
+            }
+            for (c = 0; c < lim && c < TURKC_RA_CALLEE && reg < 0; c++) {
+                if (!active[c])
+                    reg = c;
+            }
+            if (reg < 0) {
+                /* en ucuzu, eşitse en geç biteni düşür */
+                for (c = 0; c < lim; c++) {
+                    v = active[c];
+                    if (reg < 0 || r->weight[v] < r->weight[active[reg]] ||
+                        (r->weight[v] == r->weight[active[reg]] &&
+                         r->end[v] > r->end[active[reg]]))
+                        reg = c;
+                }
+                v = reg >= 0 ? active[reg] : 0;
+                if (v && (r->weight[v] < r->weight[i] ||
+                          (r->weight[v] == r->weight[i] && r->end[v] > r->end[i]))) {
+                    out->loc[v] = SPILL;
+                } else {
+                    out->loc[i] = SPILL;
+                    continue;
+                }
+            }
+            active[reg] = i;
+            out->loc[i] = reg;
+        }
+    }
+}
+
+static void heap_push(struct ra *r, uint32_t v)
+{
+    uint32_t k = r->nheap++, p;
+
+    while (k && r->end[r->heap[p = (k - 1) / 2]] > r->end[v]) {
+        r->heap[k] = r->heap[p];
+        k = p;
+    }
+    r->heap[k] = v;
+}
+
+static uint32_t heap_pop(struct ra *r)
+{
+    uint32_t top = r->heap[0], v = r->heap[--r->nheap], k = 0, c;
+
+    while ((c = 2 * k + 1) < r->nheap) {
+        if (c + 1 < r->nheap && r->end[r->heap[c + 1]] < r->end[r->heap[c]])
+            c++;
+        if (r->end[r->heap[c]] >= r->end[v])
+            break;
+        r->heap[k] = r->heap[c];
+        k = c;
+    }
+    r->heap[k] = v;
+    return top;
+}
+
+/* Yığına düşen aralıklara yuva: biten aralığın yuvası yeniden kullanılır */
+static void slots(struct ra *r)
+{
+    struct turkc_ir_func *f = r->f;
+    struct turkc_ra *out = r->out;
+    uint32_t *free_slots = r->stack, nfree = 0, k, i, b, s;
+
+    for (k = 0; k < out->norder; k++) {
+        b = out->order[k];
+        for (i = f->blocks[b].first; i; i = f->insns[i].next) {
+            if (out->loc[i] != SPILL)
+                continue;
+            while (r->nheap && r->end[r->heap[0]] <= r->pos[i])
+                free_slots[nfree++] = (uint32_t)-(out->loc[heap_pop(r)] + 1);
+            s = nfree ? free_slots[--nfree] : out->nslots++;
+            out->loc[i] = -(int32_t)s - 1;
+            out->spilled++;
+            heap_push(r, i);
+        }
+    }
+}
+
+int turkc_ra_run(struct turkc_ir_func *f, int nregs, struct turkc_ra *ra)
+{
+    struct ra r;
+    uint32_t i, nb = f->nblocks, ni = f->ninsns;
+    int rc = -1;
+
+    memset(ra, 0, sizeof(*ra));
+    memset(&r, 0, sizeof(r));
+    if (nregs < 0)
+        nregs = 0;
+    if (nregs > TURKC_RA_REGS)
+        nregs = TURKC_RA_REGS;
+    turkc_ir_cfg(f);
+    if (f->oom)
+        return -1;
+    r.f = f;
+    r.out = ra;
+    r.lin = calloc(nb, sizeof(*r.lin));
+    r.bend = calloc(nb, sizeof(*r.bend));
+    r.inner = calloc(nb, sizeof(*r.inner));
+    r.stamp = calloc(nb, sizeof(*r.stamp));
+    r.head = calloc(nb + 1, sizeof(*r.head));
+    r.tail = calloc(nb + 1, sizeof(*r.tail));
+    r.outer = calloc(nb + 1, sizeof(*r.outer));
+    r.depth = calloc(nb + 1, sizeof(*r.depth));
+    r.stack = malloc((nb > ni ? nb : ni) * sizeof(*r.stack));
+    r.pos = calloc(ni, sizeof(*r.pos));
+    r.calls = malloc(ni * sizeof(*r.calls));
+    r.end = calloc(ni, sizeof(*r.end));
+    r.weight = calloc(ni, sizeof(*r.weight));
+    r.heap = malloc(ni * sizeof(*r.heap));
+    ra->loc = malloc(ni * sizeof(*ra->loc));
+    if (!r.lin || !r.bend || !r.inner || !r.stamp || !r.head || !r.tail || !r.outer ||
+        !r.depth || !r.stack || !r.pos || !r.calls || !r.end || !r.weight || !r.heap ||
+        !ra->loc || layout(&r) != 0)
+        goto out;
+    for (i = 0; i < ni; i++)
+        ra->loc[i] = TURKC_RA_NONE;
+    number(&r);
+    loops(&r);
+    intervals(&r);
+    scan(&r, nregs);
+    slots(&r);
+    for (i = 1; i < ni; i++) {
+        if (ra->loc[i] >= 0 && ra->loc[i] != TURKC_RA_NONE)
+            ra->used |= 1u << ra->loc[i];
+    }
+    rc = 0;
+out:
+    free(r.lin);
+    free(r.bend);
+    free(r.inner);
+    free(r.stamp);
+    free(r.head);
+    free(r.tail);
+    free(r.outer);
+    free(r.depth);
+    free(r.stack);
+    free(r.pos);
+    free(r.calls);
+    free(r.end);
+    free(r.weight);
+    free(r.heap);
+    if (rc != 0)
+        turkc_ra_free(ra);
+    return rc;
+}
+
+void turkc_ra_free(struct turkc_ra *ra)
+{
+    free(ra->loc);
+    free(ra->order);
+    memset(ra, 0, sizeof(*ra));
+}
@@ -0,0 +1,66 @@
+#ifndef TURKC_REGALLOC_H
+#define TURKC_REGALLOC_H
+
+/* Doğrusal tarama yazmaç ataması (Poletto ve Sarkar, "Linear Scan Register
+ * Allocation") IR değerleri için; turkc_x86_emit_ir kullanır.
+ *
+ * Bloklar ters sonradan sırada dizilir, ama dalın ikinci ardılı önce
+ * gezildiği için döngü gövdesi başlığın hemen arkasında bitişik kalır.
+ * Komutlar bu sırada numaralanır; değerin aralığı tanımından son
+ * kullanımına kadardır. Phi işleneni gelen bloğun sonunda kullanılır.
+ * Döngüden önce tanımlanıp döngüde kullanılan değerin aralığı döngünün
+ * sonuna uzatılır (geri kenarda da canlıdır).
+ *
+ * Aralıklar başlangıç sırasıyla yazmaçlara atanır; boş yazmaç yoksa en
+ * ucuz aralık bütünüyle yığına düşer. Maliyet, tanım ve kullanımların
+ * 10^döngü derinliği ağırlıklı toplamıdır; tümevarım değişkenleri (icin
+ * sayaçları: başlıkta phi, geri kenarda phi ± sabit) ve artışları
+ * TURKC_RA_IV_WEIGHT ile çarpılır, böylece döngü sayaçları yazmaçta kalır.
+ * Bir çağrının (CALL, YAZ) üzerinden geçen aralık yalnız çağrıda korunan
+ * yazmaçlara girebilir. Yığın yuvaları ikinci bir taramayla paylaştırılır.
+ *
+ * Sabitler yer almaz (komuta doğrudan girer); hemen ardındaki br'nin tek
+ * kullandığı karşılaştırma da (turkc_ra_fused) cmp + jcc olur, yer almaz.
+ */
+
+#include <stdint.h>
+
+#include "turkc_ir.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Yazmaçlar: 0..TURKC_RA_CALLEE-1 çağrıda korunur (rbx, r12d-r15d), kalanlar
+ * bozulur (esi, edi, r8d-r11d). eax, ecx, edx kod üreticinin geçicileridir.
+ */
+#define TURKC_RA_CALLEE         5
+#define TURKC_RA_REGS           11
+
+#define TURKC_RA_NONE           INT32_MAX       /* yeri yok */
+#define TURKC_RA_IV_WEIGHT      4
+
+struct turkc_ra {
+    int32_t *loc;               /* komut başına: yazmaç, -(yuva + 1) veya TURKC_RA_NONE */
+    uint32_t *order;            /* blokların yerleşimi */
+    uint32_t norder;
+    uint32_t nslots;            /* 4 byte'lık yığın yuvaları */
+    uint32_t values;            /* yer verilen değerler */
+    uint32_t spilled;           /* yığına düşenler */
+    uint32_t used;              /* kullanılan yazmaçlar (1 << r) */
+};
+
+/* f'nin değerlerini ilk nregs yazmaca (0..TURKC_RA_REGS) atar; 0 hepsini
+ * yığına koyar. Öncüller yeniden hesaplanır. Başarıda 0, bellek yetmezse -1.
+ */
+int turkc_ra_run(struct turkc_ir_func *f, int nregs, struct turkc_ra *ra);
+void turkc_ra_free(struct turkc_ra *ra);
+
+/* Karşılaştırma sonucu yalnız hemen ardındaki br'de mi kullanılıyor */
+int turkc_ra_fused(const struct turkc_ir_func *f, uint32_t insn);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
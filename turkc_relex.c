@@ -0,0 +1,263 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "turkc_relex.h"
+
+static int grow(void **p, uint32_t *cap, uint32_t need, size_t size)
+{
+    uint32_t n = *cap ? *cap : 16;
+    void *q;
+
+    if (need <= *cap)
+        return 0;
+    while (n < need) {
+        if (n > UINT32_MAX / 2)
+            return -1;
+        n *= 2;
+    }
+    q = realloc(*p, (size_t)n * size);
+    if (!q)
+        return -1;
+    *p = q;
+    *cap = n;
+    return 0;
+}
+
+/* lines'ta offset'ten büyük ilk eleman; satır numarası budur (1'den) */
+static uint32_t line_index(const struct turkc_relex *rx, size_t offset)
+{
+    uint32_t lo = 0, hi = rx->nlines, mid;
+
+    while (lo < hi) {
+        mid = lo + (hi - lo) / 2;
+        if (rx->lines[mid] <= offset)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+/* Sonu offset'ten büyük ilk token */
+static uint32_t token_after(const struct turkc_relex *rx, size_t offset)
+{
+    uint32_t lo = 0, hi = rx->ntoks, mid;
+
+    while (lo < hi) {
+        mid = lo + (hi - lo) / 2;
+        if ((size_t)rx->toks[mid].offset + rx->toks[mid].length <= offset)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+uint32_t turkc_relex_find(const struct turkc_relex *rx, size_t offset)
+{
+    return token_after(rx, offset);
+}
+
+void turkc_relex_position(const struct turkc_relex *rx, size_t offset,
+                          unsigned long *line, unsigned long *column)
+{
+    uint32_t i = line_index(rx, offset);
+
+    *line = i;
+    *column = offset - rx->lines[i - 1] + 1;
+}
+
+static uint32_t count_lines(const char *p, size_t len)
+{
+    const char *end = p + len;
+    uint32_t n = 0;
+
+    while ((p = memchr(p, '\n', end - p)) != NULL) {
+        p++;
+        n++;
+    }
+    return n;
+}
+
+/* text[offset ..)'tan sonraki satır başlarını at (lines'a ekler) */
+static void add_lines(uint32_t *lines, const char *p, size_t len, uint32_t offset)
+{
+    const char *start = p, *end = p + len;
+
+    while ((p = memchr(p, '\n', end - p)) != NULL) {
+        p++;
+        *lines++ = offset + (uint32_t)(p - start);
+    }
+}
+
+int turkc_relex_init(struct turkc_relex *rx, const char *text, size_t len,
+                     enum turkc_simd simd)
+{
+    struct turkc_fastlex fl;
+    struct turkc_token tok;
+    int kind;
+
+    memset(rx, 0, sizeof(*rx));
+    if (len > UINT32_MAX || turkc_fastlex_init(&fl, text, len, simd) != 0)
+        return -1;
+    rx->simd = simd;
+    rx->cap = len ? len : 1;
+    rx->text = malloc(rx->cap);
+    if (!rx->text)
+        goto fail;
+    memcpy(rx->text, text, len);
+    rx->len = len;
+
+    rx->nlines = count_lines(text, len) + 1;
+    if (grow((void **)&rx->lines, &rx->lines_cap, rx->nlines, sizeof(*rx->lines)) != 0)
+        goto fail;
+    rx->lines[0] = 0;
+    add_lines(rx->lines + 1, text, len, 0);
+
+    turkc_fastlex_init(&fl, rx->text, len, simd);
+    while ((kind = turkc_fastlex_next(&fl, &tok)) > 0) {
+        if (grow((void **)&rx->toks, &rx->toks_cap, rx->ntoks + 1, sizeof(*rx->toks)) != 0)
+            goto fail;
+        rx->toks[rx->ntoks].offset = (uint32_t)tok.offset;
+        rx->toks[rx->ntoks].length = (uint32_t)tok.length;
+        rx->toks[rx->ntoks].kind = kind;
+        rx->ntoks++;
+    }
+    if (kind < 0) {
+        rx->error = fl.error;
+        rx->error_offset = (uint32_t)tok.offset;
+    }
+    return 0;
+
+fail:
+    turkc_relex_free(rx);
+    return -1;
+}
+
+/* Metni ve satır başlarını düzenler */
+static int splice_text(struct turkc_relex *rx, size_t offset, size_t removed,
+                       const char *ins, size_t ins_len)
+{
+    size_t len = rx->len - removed + ins_len, cap;
+    uint32_t first, last, added, i, shift;
+    char *p;
+
+    if (len > rx->cap) {
+        cap = rx->cap;
+        while (cap < len)
+            cap *= 2;
+        p = realloc(rx->text, cap);
+        if (!p)
+            return -1;
+        rx->text = p;
+        rx->cap = cap;
+    }
+    /* silinen aralıktaki '\n'lerin açtığı satırlar gider, eklenenlerinki gelir */
+    first = line_index(rx, offset);
+    last = line_index(rx, offset + removed);
+    added = count_lines(ins, ins_len);
+    if (grow((void **)&rx->lines, &rx->lines_cap, rx->nlines - (last - first) + added,
+             sizeof(*rx->lines)) != 0)
+        return -1;
+    shift = (uint32_t)(ins_len - removed);
+    memmove(rx->lines + first + added, rx->lines + last,
+            (rx->nlines - last) * sizeof(*rx->lines));
+    rx->nlines = rx->nlines - (last - first) + added;
+    for (i = first + added; i < rx->nlines; i++)
+        rx->lines[i] += shift;
+    add_lines(rx->lines + first, ins, ins_len, (uint32_t)offset);
+
+    memmove(rx->text + offset + ins_len, rx->text + offset + removed,
+            rx->len - offset - removed);
+    memcpy(rx->text + offset, ins, ins_len);
+    rx->len = len;
+    return 0;
+}
+
+int turkc_relex_edit(struct turkc_relex *rx, size_t offset, size_t removed,
+                     const char *ins, size_t ins_len,
+                     struct turkc_relex_change *change)
+{
+    struct turkc_fastlex fl;
+    struct turkc_token tok;
+    size_t restart, stop, edit_end, old;
+    uint32_t keep, j, n = 0, tail, i, shift;
+    int kind;
+
+    if (offset > rx->len || removed > rx->len - offset ||
+        rx->len - removed > UINT32_MAX - ins_len)
+        return -1;
+
+    /* düzenlemeden kesin önce biten son token'dan sonrası yeniden taranır:
+     * düzenlemeye değen token uzayabilir veya bölünebilir
+     */
+    keep = token_after(rx, offset);
+    while (keep > 0 && rx->toks[keep - 1].offset + rx->toks[keep - 1].length >= offset)
+        keep--;
+    restart = keep ? rx->toks[keep - 1].offset + rx->toks[keep - 1].length : 0;
+
+    if (splice_text(rx, offset, removed, ins, ins_len) != 0)
+        return -1;
+    shift = (uint32_t)(ins_len - removed);
+    edit_end = offset + ins_len;
+
+    turkc_fastlex_init(&fl, rx->text, rx->len, rx->simd);
+    turkc_fastlex_seek(&fl, restart, line_index(rx, restart));
+    j = keep;
+    for (;;) {
+        kind = turkc_fastlex_next(&fl, &tok);
+        if (kind <= 0) {
+            /* dosya sonuna kadar tarandı, eski kuyruk tümüyle gider */
+            rx->error = kind < 0 ? fl.error : NULL;
+            rx->error_offset = kind < 0 ? (uint32_t)tok.offset : 0;
+            stop = rx->len;
+            j = rx->ntoks;
+            break;
+        }
+        if (tok.offset >= edit_end) {
+            /* eski metinde aynı yerde bir token başlıyorsa akışlar buluştu */
+            old = tok.offset - ins_len + removed;
+            while (j < rx->ntoks && rx->toks[j].offset < old)
+                j++;
+            if (j < rx->ntoks && rx->toks[j].offset == old) {
+                if (rx->error)
+                    rx->error_offset += shift;
+                stop = tok.offset;
+                break;
+            }
+        }
+        if (grow((void **)&rx->scratch, &rx->scratch_cap, n + 1, sizeof(*rx->scratch)) != 0)
+            return -1;
+        rx->scratch[n].offset = (uint32_t)tok.offset;
+        rx->scratch[n].length = (uint32_t)tok.length;
+        rx->scratch[n].kind = kind;
+        n++;
+    }
+
+    tail = rx->ntoks - j;
+    if (grow((void **)&rx->toks, &rx->toks_cap, keep + n + tail, sizeof(*rx->toks)) != 0)
+        return -1;
+    if (tail)
+        memmove(rx->toks + keep + n, rx->toks + j, tail * sizeof(*rx->toks));
+    for (i = keep + n; i < keep + n + tail; i++)
+        rx->toks[i].offset += shift;
+    if (n)
+        memcpy(rx->toks + keep, rx->scratch, n * sizeof(*rx->toks));
+    if (change) {
+        change->first = keep;
+        change->removed = j - keep;
+        change->inserted = n;
+        change->relexed = stop - restart;
+    }
+    rx->ntoks = keep + n + tail;
+    return 0;
+}
+
+void turkc_relex_free(struct turkc_relex *rx)
+{
+    free(rx->text);
+    free(rx->toks);
+    free(rx->lines);
+    free(rx->scratch);
+    memset(rx, 0, sizeof(*rx));
+}
@@ -0,0 +1,96 @@
+#ifndef TURKC_RELEX_H
+#define TURKC_RELEX_H
+
+/* Artımlı tarama: düzenlenen bir metnin token dizisini baştan taramadan
+ * günceller (editör/LSP kullanımı).
+ *
+ *   struct turkc_relex rx;
+ *   struct turkc_relex_change ch;
+ *
+ *   turkc_relex_init(&rx, src, len, TURKC_SIMD_AUTO);
+ *   turkc_relex_edit(&rx, offset, 3, "yeni", 4, &ch);
+ *   ... rx.toks[ch.first .. ch.first + ch.inserted) yeni token'lar ...
+ *   turkc_relex_free(&rx);
+ *
+ * Lexer bir token'ın sonunda bağlamsızdır: oradan tarama yalnız sonraki
+ * metne bağlıdır. Bu yüzden düzenlemeden kesin önce biten son token'ın
+ * sonundan (yoksa dosya başından) yeniden taranır. Düzenlenen bölgeden
+ * sonra başlayan yeni bir token'ın ofseti, kaydırılmış olarak eski bir
+ * token'ın başına denk gelince iki akış buluşmuştur: metnin geri kalanı
+ * aynı olduğundan token'lar da aynıdır ve eski kuyruk kaydırılıp korunur.
+ * Yorum veya string açan ya da kapatan düzenleme, literal bitene kadar
+ * (gerekirse dosya sonuna kadar) yeniden taranır. Kapanmayan string/yorum
+ * hatası da tam taramadakiyle aynı tutulur.
+ *
+ * Satır başlarının ofsetleri ayrı bir dizide tutulur; token'ın satır ve
+ * sütunu turkc_relex_position ile bulunur.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "turkc_fastlex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct turkc_relex_token {
+    uint32_t offset;
+    uint32_t length;
+    int32_t kind;               /* enum turkc_token_kind */
+};
+
+struct turkc_relex {
+    char *text;                 /* düzenlenen metin, NUL ile bitmez */
+    size_t len, cap;
+    struct turkc_relex_token *toks;
+    uint32_t ntoks, toks_cap;
+    uint32_t *lines;            /* satır başı ofsetleri, lines[0] = 0 */
+    uint32_t nlines, lines_cap;
+    struct turkc_relex_token *scratch;      /* yeniden taranan token'lar */
+    uint32_t scratch_cap;
+    const char *error;          /* kapanmayan string/yorum, NULL: hata yok */
+    uint32_t error_offset;      /* literal'in başı */
+    enum turkc_simd simd;
+};
+
+/* Bir düzenlemenin token dizisindeki etkisi: toks[first ..) konumunda
+ * removed eski token'ın yerini inserted yeni token aldı. Sonrakiler aynı
+ * kaldı (ofsetleri kaydırıldı).
+ */
+struct turkc_relex_change {
+    uint32_t first;
+    uint32_t removed, inserted;
+    size_t relexed;             /* yeniden taranan byte */
+};
+
+/* Metnin kopyasını alır ve tamamını tarar. Başarıda 0; bellek yetmezse,
+ * metin 4 GB'tan büyükse veya istenen backend bu CPU'da yoksa -1.
+ */
+int turkc_relex_init(struct turkc_relex *rx, const char *text, size_t len,
+                     enum turkc_simd simd);
+
+/* text[offset .. offset + removed) yerine ins'in ilk ins_len byte'ını koyar
+ * ve token'ları günceller. change NULL olabilir. Başarıda 0; aralık metnin
+ * dışındaysa -1 ve hiçbir şey değişmez. Bellek yetmezse -1; rx bundan
+ * sonra yalnız turkc_relex_free'ye verilebilir.
+ */
+int turkc_relex_edit(struct turkc_relex *rx, size_t offset, size_t removed,
+                     const char *ins, size_t ins_len,
+                     struct turkc_relex_change *change);
+
+/* Ofsetin satır ve sütunu (1'den başlar, sütun byte sayısı + 1) */
+void turkc_relex_position(const struct turkc_relex *rx, size_t offset,
+                          unsigned long *line, unsigned long *column);
+
+/* Ofseti içeren veya ofsetten sonraki ilk token'ın indeksi, yoksa ntoks */
+uint32_t turkc_relex_find(const struct turkc_relex *rx, size_t offset);
+
+void turkc_relex_free(struct turkc_relex *rx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,481 @@
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "turkc_resolve.h"
+#include "turkc_token.h"
+
+#define NONE    UINT32_MAX
+
+/* Kapsamdan çıkınca geri alınacak bağlama */
+struct undo {
+    uint32_t sym;
+    uint32_t slot, scope;
+};
+
+struct resolver {
+    struct turkc_ast *ast;
+    struct turkc_program *prog;
+    uint32_t nsyms;
+    uint32_t *func_of;          /* sembol -> fonksiyon indeksi */
+    uint32_t *global_of;        /* sembol -> global slot */
+    uint32_t *local_of;         /* sembol -> yerel slot (o anki kapsamda) */
+    uint32_t *scope_of;         /* local_of'un tanımlandığı kapsam */
+    struct undo *undo;
+    size_t nundo, undo_cap;
+    size_t globals_cap;
+    uint32_t scope;             /* iç içe blok sayacı, her blokta artar */
+    uint32_t slots, max_slots;  /* o anki fonksiyonun çerçevesi */
+    struct turkc_function *func;
+    uint32_t yaz;               /* "yaz" sembolü */
+    unsigned depth;
+    struct turkc_parse_error *err;
+    jmp_buf fail;
+};
+
+#define NODE(r, i)  (&(r)->ast->nodes[i])
+
+static void fail(struct resolver *r, uint32_t node, const char *fmt, ...)
+{
+    va_list ap;
+
+    if (r->err) {
+        va_start(ap, fmt);
+        vsnprintf(r->err->message, sizeof(r->err->message), fmt, ap);
+        va_end(ap);
+        r->err->offset = node ? NODE(r, node)->offset : 0;
+        r->err->line = 0;
+        r->err->column = 0;
+    }
+    longjmp(r->fail, 1);
+}
+
+static const char *text(struct resolver *r, uint32_t sym)
+{
+    return turkc_ast_symbol(r->ast, sym);
+}
+
+static void *grow(struct resolver *r, void *p, size_t *cap, size_t size)
+{
+    size_t n = *cap ? *cap * 2 : 64;
+
+    p = realloc(p, n * size);
+    if (!p)
+        fail(r, 0, "bellek yetersiz");
+    *cap = n;
+    return p;
+}
+
+/* ---- Kapsamlar ---- */
+
+static size_t scope_enter(struct resolver *r)
+{
+    r->scope++;
+    return r->nundo;
+}
+
+static void scope_leave(struct resolver *r, size_t mark, uint32_t slots)
+{
+    struct undo *u;
+
+    while (r->nundo > mark) {
+        u = &r->undo[--r->nundo];
+        r->local_of[u->sym] = u->slot;
+        r->scope_of[u->sym] = u->scope;
+    }
+    r->slots = slots;           /* kapsamın slotları sonraki bloklarda tekrar kullanılır */
+}
+
+static uint32_t declare_local(struct resolver *r, uint32_t node, uint32_t sym)
+{
+    struct undo *u;
+
+    if (r->local_of[sym] != NONE && r->scope_of[sym] == r->scope)
+        fail(r, node, "'%s' bu blokta zaten tanimli", text(r, sym));
+    if (r->nundo == r->undo_cap)
+        r->undo = grow(r, r->undo, &r->undo_cap, sizeof(*r->undo));
+    u = &r->undo[r->nundo++];
+    u->sym = sym;
+    u->slot = r->local_of[sym];
+    u->scope = r->scope_of[sym];
+    r->local_of[sym] = r->slots++;
+    r->scope_of[sym] = r->scope;
+    if (r->slots > r->max_slots)
+        r->max_slots = r->slots;
+    return r->local_of[sym];
+}
+
+/* NAME düğümünü yerel veya global slota bağlar */
+static void bind_name(struct resolver *r, uint32_t n)
+{
+    struct turkc_node *node = NODE(r, n);
+    uint32_t sym = node->a;
+
+    if (r->local_of[sym] != NONE) {
+        node->aux = r->local_of[sym];
+    } else if (r->global_of[sym] != NONE) {
+        node->aux = r->global_of[sym];
+        node->flags |= TURKC_NF_GLOBAL;
+    } else if (r->func_of[sym] != NONE || sym == r->yaz) {
+        fail(r, n, "'%s' bir fonksiyon, degisken degil", text(r, sym));
+    } else {
+        fail(r, n, "tanimsiz isim '%s'", text(r, sym));
+    }
+}
+
+/* ---- İfadeler ---- */
+
+/* used: değer kullanılıyor mu (void çağrı sadece ifade deyiminde olabilir) */
+static void expression(struct resolver *r, uint32_t n, int used)
+{
+    struct turkc_node *node = NODE(r, n);
+    uint32_t sym, f, arg, j, nargs = 0;
+
+    if (++r->depth > TURKC_RESOLVE_MAX_DEPTH)
+        fail(r, n, "ifade cok derin");
+    switch (node->kind) {
+    case ND_NUMBER:
+        break;
+    case ND_STRING:
+        fail(r, n, "string sadece yaz() ile kullanilabilir");
+        break;
+    case ND_NAME:
+        bind_name(r, n);
+        break;
+    case ND_ASSIGN:
+        bind_name(r, node->a);
+        expression(r, node->b, 1);
+        if (!(NODE(r, node->a)->flags & TURKC_NF_GLOBAL))
+            node->flags |= TURKC_NF_ASSIGNS;
+        node->flags |= NODE(r, node->b)->flags & TURKC_NF_ASSIGNS;
+        break;
+    case ND_BINARY:
+        /* zincir tek seviye: inerken üst bağlantılar yazılır, çıkarken b'ler */
+        for (j = n; NODE(r, NODE(r, j)->a)->kind == ND_BINARY; j = NODE(r, j)->a)
+            NODE(r, NODE(r, j)->a)->aux = j;
+        expression(r, NODE(r, j)->a, 1);
+        for (;;) {
+            node = NODE(r, j);
+            expression(r, node->b, 1);
+            node->flags |= (NODE(r, node->a)->flags | NODE(r, node->b)->flags) & TURKC_NF_ASSIGNS;
+            if (j == n)
+                break;
+            j = node->aux;
+        }
+        break;
+    case ND_NEG:
+        expression(r, node->a, 1);
+        node->flags |= NODE(r, node->a)->flags & TURKC_NF_ASSIGNS;
+        break;
+    case ND_CALL:
+        sym = node->a;
+        for (arg = node->b; arg; arg = NODE(r, arg)->next)
+            nargs++;
+        f = r->func_of[sym];
+        if (f == NONE && sym == r->yaz) {
+            if (nargs != 1)
+                fail(r, n, "yaz() tek arguman alir");
+            if (used)
+                fail(r, n, "yaz() deger dondurmez");
+            node->aux = TURKC_FUNC_YAZ;
+            if (NODE(r, node->b)->kind != ND_STRING) {
+                expression(r, node->b, 1);
+                node->flags |= NODE(r, node->b)->flags & TURKC_NF_ASSIGNS;
+            }
+            break;
+        }
+        if (f == NONE) {
+            if (r->local_of[sym] != NONE || r->global_of[sym] != NONE)
+                fail(r, n, "'%s' bir degisken, fonksiyon degil", text(r, sym));
+            fail(r, n, "tanimsiz fonksiyon '%s'", text(r, sym));
+        }
+        if (nargs != r->prog->funcs[f].nparams)
+            fail(r, n, "'%s' %lu arguman alir, %lu verildi", text(r, sym),
+                 (unsigned long)r->prog->funcs[f].nparams, (unsigned long)nargs);
+        if (used && !r->prog->funcs[f].returns)
+            fail(r, n, "void fonksiyonun degeri kullanilamaz");
+        node->aux = f;
+        for (arg = node->b; arg; arg = NODE(r, arg)->next) {
+            expression(r, arg, 1);
+            node->flags |= NODE(r, arg)->flags & TURKC_NF_ASSIGNS;
+        }
+        break;
+    default:
+        fail(r, n, "beklenmeyen dugum %s", turkc_node_name(node->kind));
+    }
+    r->depth--;
+}
+
+/* Global ilk değer: sabit ifade, çözümleme sırasında hesaplanır */
+static int32_t constant(struct resolver *r, uint32_t n)
+{
+    struct turkc_node *node = NODE(r, n);
+    uint32_t j;
+    int32_t a, b;
+
+    if (++r->depth > TURKC_RESOLVE_MAX_DEPTH)
+        fail(r, n, "ifade cok derin");
+    switch (node->kind) {
+    case ND_NUMBER:
+        a = (int32_t)node->a;
+        break;
+    case ND_NEG:
+        a = (int32_t)(0u - (uint32_t)constant(r, node->a));
+        break;
+    case ND_BINARY:
+        for (j = n; NODE(r, NODE(r, j)->a)->kind == ND_BINARY; j = NODE(r, j)->a)
+            NODE(r, NODE(r, j)->a)->aux = j;
+        a = constant(r, NODE(r, j)->a);
+        for (;;) {
+            node = NODE(r, j);
+            b = constant(r, node->b);
+            if ((node->op == TK_SLASH || node->op == TK_PERCENT) && b == 0)
+                fail(r, j, "sifira bolme");
+            a = turkc_binop(node->op, a, b);
+            if (j == n)
+                break;
+            j = node->aux;
+        }
+        break;
+    default:
+        fail(r, n, "global ilk deger sabit olmali");
+        return 0;
+    }
+    r->depth--;
+    return a;
+}
+
+/* ---- Deyimler ---- */
+
+static void statement(struct resolver *r, uint32_t n);
+
+static void variable(struct resolver *r, uint32_t n)
+{
+    /* int x = x; dıştaki x'i görür: ilk değer tanımdan önce çözülür */
+    struct turkc_node *node = NODE(r, n);
+
+    if (node->a)
+        expression(r, node->a, 1);
+    node->aux = declare_local(r, n, node->c);
+}
+
+static void block(struct resolver *r, uint32_t n)
+{
+    uint32_t s, slots = r->slots;
+    size_t mark = scope_enter(r);
+
+    for (s = NODE(r, n)->a; s; s = NODE(r, s)->next)
+        statement(r, s);
+    scope_leave(r, mark, slots);
+}
+
+/* Blok olmayan dal (eger (x) int y = 1;) de kendi kapsamını açar */
+static void branch(struct resolver *r, uint32_t n)
+{
+    uint32_t slots = r->slots;
+    size_t mark;
+
+    if (!n)
+        return;
+    mark = scope_enter(r);
+    statement(r, n);
+    scope_leave(r, mark, slots);
+}
+
+static void statement(struct resolver *r, uint32_t n)
+{
+    struct turkc_node *node = NODE(r, n);
+    uint32_t slots;
+    size_t mark;
+
+    switch (node->kind) {
+    case ND_BLOCK:
+        block(r, n);
+        break;
+    case ND_VAR:
+        variable(r, n);
+        break;
+    case ND_IF:
+        expression(r, node->a, 1);
+        branch(r, node->b);
+        branch(r, node->c);
+        break;
+    case ND_WHILE:
+        expression(r, node->a, 1);
+        branch(r, node->b);
+        break;
+    case ND_FOR:
+        /* başlangıçtaki değişken döngüye aittir */
+        slots = r->slots;
+        mark = scope_enter(r);
+        if (node->a)
+            statement(r, node->a);
+        if (node->b)
+            expression(r, node->b, 1);
+        if (node->c)
+            expression(r, node->c, 1);
+        branch(r, node->d);
+        scope_leave(r, mark, slots);
+        break;
+    case ND_RETURN:
+        if (node->a && !r->func->returns)
+            fail(r, n, "void fonksiyon deger donduremez");
+        if (!node->a && r->func->returns)
+            fail(r, n, "dondur deger bekliyor");
+        if (node->a)
+            expression(r, node->a, 1);
+        break;
+    case ND_EXPR:
+        expression(r, node->a, 0);
+        break;
+    default:
+        fail(r, n, "beklenmeyen dugum %s", turkc_node_name(node->kind));
+    }
+}
+
+/* ---- Bildirimler ---- */
+
+static void function(struct resolver *r, uint32_t n)
+{
+    struct turkc_function *f = &r->prog->funcs[NODE(r, n)->aux];
+    uint32_t p, s;
+    size_t mark;
+
+    r->func = f;
+    r->slots = r->max_slots = 0;
+    mark = scope_enter(r);
+    /* parametreler ve gövdenin en dış bloğu aynı kapsamdadır */
+    for (p = NODE(r, n)->a; p; p = NODE(r, p)->next)
+        NODE(r, p)->aux = declare_local(r, p, NODE(r, p)->c);
+    for (s = NODE(r, NODE(r, n)->b)->a; s; s = NODE(r, s)->next)
+        statement(r, s);
+    scope_leave(r, mark, 0);
+    f->nslots = r->max_slots;
+}
+
+/* Fonksiyonlar tanımlarından önce çağrılabilir: önce hepsi toplanır */
+static void collect(struct resolver *r)
+{
+    struct turkc_program *prog = r->prog;
+    size_t cap = 0;
+    uint32_t d, p, sym;
+
+    for (d = NODE(r, r->ast->root)->a; d; d = NODE(r, d)->next) {
+        if (NODE(r, d)->kind != ND_FUNC)
+            continue;
+        sym = NODE(r, d)->c;
+        if (sym == r->yaz)
+            fail(r, d, "'yaz' yerlesik bir fonksiyon");
+        if (r->func_of[sym] != NONE)
+            fail(r, d, "'%s' zaten tanimli", text(r, sym));
+        if (prog->nfuncs == cap)
+            prog->funcs = grow(r, prog->funcs, &cap, sizeof(*prog->funcs));
+        r->func_of[sym] = prog->nfuncs;
+        NODE(r, d)->aux = prog->nfuncs;
+        prog->funcs[prog->nfuncs].node = d;
+        prog->funcs[prog->nfuncs].name = sym;
+        prog->funcs[prog->nfuncs].nparams = 0;
+        prog->funcs[prog->nfuncs].nslots = 0;
+        prog->funcs[prog->nfuncs].returns = NODE(r, d)->op == TK_INT;
+        for (p = NODE(r, d)->a; p; p = NODE(r, p)->next)
+            prog->funcs[prog->nfuncs].nparams++;
+        prog->nfuncs++;
+    }
+}
+
+static void global(struct resolver *r, uint32_t d)
+{
+    struct turkc_program *prog = r->prog;
+    uint32_t sym = NODE(r, d)->c;
+    int32_t value = 0;
+
+    if (r->global_of[sym] != NONE || r->func_of[sym] != NONE || sym == r->yaz)
+        fail(r, d, "'%s' zaten tanimli", text(r, sym));
+    if (NODE(r, d)->a)
+        value = constant(r, NODE(r, d)->a);
+    if (prog->nglobals == r->globals_cap)
+        prog->globals = grow(r, prog->globals, &r->globals_cap, sizeof(*prog->globals));
+    r->global_of[sym] = prog->nglobals;
+    NODE(r, d)->aux = prog->nglobals;
+    NODE(r, d)->flags |= TURKC_NF_GLOBAL;
+    prog->globals[prog->nglobals++] = value;
+}
+
+int turkc_resolve(struct turkc_program *prog, struct turkc_ast *ast,
+                  struct turkc_parse_error *err)
+{
+    struct resolver r;
+    uint32_t d, ana;
+    int rc = -1;
+
+    memset(prog, 0, sizeof(*prog));
+    memset(&r, 0, sizeof(r));
+    prog->ast = ast;
+    r.ast = ast;
+    r.prog = prog;
+    r.err = err;
+    if (setjmp(r.fail))
+        goto out;
+
+    r.yaz = turkc_intern(ast->syms, "yaz", 3);
+    ana = turkc_intern(ast->syms, "ana", 3);
+    if (r.yaz == TURKC_INTERN_NONE || ana == TURKC_INTERN_NONE)
+        fail(&r, 0, "bellek yetersiz");
+    r.nsyms = turkc_intern_count(ast->syms);
+    r.func_of = malloc(r.nsyms * sizeof(uint32_t));
+    r.global_of = malloc(r.nsyms * sizeof(uint32_t));
+    r.local_of = malloc(r.nsyms * sizeof(uint32_t));
+    r.scope_of = malloc(r.nsyms * sizeof(uint32_t));
+    if (!r.func_of || !r.global_of || !r.local_of || !r.scope_of)
+        fail(&r, 0, "bellek yetersiz");
+    memset(r.func_of, 0xff, r.nsyms * sizeof(uint32_t));
+    memset(r.global_of, 0xff, r.nsyms * sizeof(uint32_t));
+    memset(r.local_of, 0xff, r.nsyms * sizeof(uint32_t));
+
+    collect(&r);
+    for (d = NODE(&r, ast->root)->a; d; d = NODE(&r, d)->next) {
+        if (NODE(&r, d)->kind == ND_FUNC)
+            function(&r, d);
+        else
+            global(&r, d);
+    }
+
+    prog->entry = r.func_of[ana];
+    if (prog->entry == NONE)
+        fail(&r, 0, "ana fonksiyonu yok");
+    if (prog->funcs[prog->entry].nparams)
+        fail(&r, prog->funcs[prog->entry].node, "ana parametre almaz");
+    rc = 0;
+
+out:
+    free(r.func_of);
+    free(r.global_of);
+    free(r.local_of);
+    free(r.scope_of);
+    free(r.undo);
+    if (rc)
+        turkc_program_free(prog);
+    return rc;
+}
+
+void turkc_program_free(struct turkc_program *prog)
+{
+    free(prog->funcs);
+    free(prog->globals);
+    prog->funcs = NULL;
+    prog->globals = NULL;
+    prog->nfuncs = prog->nglobals = 0;
+}
+
+uint32_t turkc_program_find(const struct turkc_program *prog, const char *name)
+{
+    uint32_t i;
+
+    for (i = 0; i < prog->nfuncs; i++) {
+        if (strcmp(turkc_ast_symbol(prog->ast, prog->funcs[i].name), name) == 0)
+            return i;
+    }
+    return TURKC_FUNC_NONE;
+}
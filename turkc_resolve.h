@@ -0,0 +1,117 @@
+#ifndef TURKC_RESOLVE_H
+#define TURKC_RESOLVE_H
+
+/* İsim çözümleme ve anlam denetimi: ayrıştırıcının ağacını çalıştırmaya
+ * hazırlar. Yorumlayıcı ve diğer motorlar isimleri çalışırken aramaz;
+ * her isim burada bir slota veya fonksiyona bağlanır ve düğüme yazılır:
+ *
+ *   VAR, PARAM, NAME   aux: slot; flags TURKC_NF_GLOBAL ise global dizide,
+ *                      değilse fonksiyonun çerçevesinde
+ *   CALL               aux: fonksiyon indeksi veya TURKC_FUNC_YAZ
+ *   FUNC               aux: fonksiyon indeksi
+ *   BINARY             aux: sola bağlı zincirde üstteki BINARY (a'sı bu
+ *                      düğüm olan), zincirin tepesinde 0
+ *
+ * İfade düğümlerinde TURKC_NF_ASSIGNS, alt ağaçta yerel bir değişkene
+ * atama olduğunu gösterir (değişkeni kopyalamadan okuyan motorlar için).
+ *
+ * Kurallar (bkz. spesifikasyon.md): isim kullanılmadan önce tanımlanır
+ * (fonksiyonlar hariç), aynı blokta iki kez tanımlanamaz, iç blok dıştakini
+ * gizler. Global ilk değerler sabit ifadedir. void fonksiyonun değeri
+ * kullanılamaz. Argüman sayısı parametre sayısına eşit olmalıdır.
+ */
+
+#include <stdint.h>
+
+#include "turkc_ast.h"
+#include "turkc_parse.h"
+#include "turkc_token.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TURKC_NF_GLOBAL     1
+#define TURKC_NF_ASSIGNS    2
+
+/* Yerleşik yaz(x): tamsayıyı veya string'i satır olarak yazar, void */
+#define TURKC_FUNC_YAZ      (UINT32_MAX - 1)
+#define TURKC_FUNC_NONE     UINT32_MAX
+
+/* İfade iç içeliği sınırı; ağacı özyinelemeyle dolaşan motorlar için.
+ * Aşılırsa "ifade cok derin" hatası. Sola bağlı bir zincir (i + 1 + 1 ...)
+ * uzunluğundan bağımsız olarak tek seviyedir; iç içe çağrılar, tekli eksi,
+ * sağdaki parantezli işlenen (1 + (1 + ...)) ve atama zinciri her biri
+ * bir seviye sayılır. Ayrıştırıcı bunları sınırsız kabul eder.
+ */
+#define TURKC_RESOLVE_MAX_DEPTH 10000
+
+struct turkc_function {
+    uint32_t node;              /* FUNC düğümü */
+    uint32_t name;              /* sembol */
+    uint32_t nparams;           /* ilk nparams slot parametrelerdir */
+    uint32_t nslots;            /* çerçevedeki slot sayısı (en az nparams) */
+    int returns;                /* int ise 1, void ise 0 */
+};
+
+struct turkc_program {
+    struct turkc_ast *ast;
+    struct turkc_function *funcs;   /* kaynaktaki sırayla */
+    uint32_t nfuncs;
+    int32_t *globals;               /* globallerin ilk değerleri */
+    uint32_t nglobals;
+    uint32_t entry;                 /* ana'nın indeksi */
+};
+
+/* ast'yi çözümler ve düğümlere yazar; prog ast'yi gösterir ama sahiplenmez.
+ * Başarıda 0, hatada -1 döner; err'de sadece message ve offset dolar
+ * (satır/sütun için turkc_parse_locate).
+ */
+int turkc_resolve(struct turkc_program *prog, struct turkc_ast *ast,
+                  struct turkc_parse_error *err);
+
+void turkc_program_free(struct turkc_program *prog);
+
+/* Çalışma zamanı aritmetiği, tüm motorlar için ortak: 32 bit, taşmada
+ * sarar, bölme sıfıra doğru keser, INT32_MIN / -1 = INT32_MIN (kalan 0).
+ * b == 0 iken / ve % çağırana kalır (sıfıra bölme hatası).
+ */
+static inline int32_t turkc_binop(int op, int32_t a, int32_t b)
+{
+    uint32_t x = (uint32_t)a, y = (uint32_t)b;
+
+    switch (op) {
+    case TK_PLUS:    return (int32_t)(x + y);
+    case TK_MINUS:   return (int32_t)(x - y);
+    case TK_STAR:    return (int32_t)(x * y);
+    case TK_SLASH:   return b == -1 ? (int32_t)(0u - x) : a / b;
+    case TK_PERCENT: return b == -1 ? 0 : a % b;
+    case TK_EQ:      return a == b;
+    case TK_NE:      return a != b;
+    case TK_LT:      return a < b;
+    case TK_GT:      return a > b;
+    case TK_LE:      return a <= b;
+    case TK_GE:      return a >= b;
+    }
+    return 0;
+}
+
+/* i'den a kolu boyunca inilen en alttaki BINARY (i BINARY olmalı). Motorlar
+ * zinciri özyinelemesiz dolaşır: bu düğümün a'sı hesaplanır, sonra aux ile
+ * i'ye kadar çıkılırken her düğümün b'si. Sıra soldan sağadır.
+ */
+static inline uint32_t turkc_chain_bottom(const struct turkc_node *nodes, uint32_t i)
+{
+    while (nodes[nodes[i].a].kind == ND_BINARY)
+        i = nodes[i].a;
+    return i;
+}
+
+/* İsmin fonksiyon indeksi, yoksa TURKC_FUNC_NONE */
+uint32_t turkc_program_find(const struct turkc_program *prog, const char *name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,409 @@
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "turkc_lexer.h"
+#include "turkc_mmap.h"
+#include "turkc_pool.h"
+#include "turkc_split.h"
+#include "turkc_tokstream.h"
+
+/* Bir taramanın sonucu. Token kayıtlarının offset ve line alanları
+ * taramanın başladığı yere göredir (start'ta line 1).
+ */
+struct chunk {
+    size_t start, end;
+    struct turkc_token_record *toks;
+    size_t count, cap;
+    size_t next;                /* saklanmayan ilk token'ın başı (ya da dosya sonu) */
+    unsigned long next_line;    /* göreli */
+    int eof;                    /* next dosya sonu */
+    const char *error;
+    unsigned long error_line;   /* göreli; 0: konumsuz hata (hata ofseti next) */
+};
+
+struct split {
+    int fd;
+    struct turkc_mapping source;    /* sadece okunur: sınırlar ve token metni */
+    struct chunk *chunks;           /* bir turdaki chunk'lar */
+    size_t *bounds;                 /* chunk k: [bounds[k], bounds[k + 1]) */
+    size_t nbounds, round_base;
+    turkc_split_fn emit;
+    void *ctx;
+    struct turkc_split_stats stats;
+    size_t cont;                    /* gerçek taramada sıradaki token başı */
+    unsigned long cont_line;
+    int done;
+    size_t col_pos, line_start;     /* sütun: son verilen token ve satırının başı */
+    unsigned long col_line;
+    size_t err_offset;              /* kapanmayan literal'in başı */
+    unsigned long err_line;         /* 0: konumsuz hata */
+};
+
+static int push_token(struct chunk *c, int kind, const struct turkc_token *tok)
+{
+    struct turkc_token_record *r;
+
+    if (c->count == c->cap) {
+        size_t cap = c->cap ? c->cap * 2 : 4096;
+
+        r = realloc(c->toks, cap * sizeof(*r));
+        if (!r)
+            return -1;
+        c->toks = r;
+        c->cap = cap;
+    }
+    r = &c->toks[c->count++];
+    r->kind = kind;
+    r->offset = tok->offset;
+    r->length = tok->length;
+    r->line = tok->line;
+    return 0;
+}
+
+/* from'dan başlayıp end'den önce başlayan token'ları out'a toplar. sync
+ * verilirse iki taramanın ortak ilk token başında durur, *sync_index o
+ * token'ın sync içindeki indeksi olur (bulunamazsa sync->count).
+ *
+ * Her tarama dosyanın kendi private mapping'ini kullanır: flex'in yazdığı
+ * geçici NUL'lar diğer thread'lerin gördüğü byte'ları bozmaz.
+ */
+static void lex_from(struct split *sp, size_t from, size_t end, struct chunk *out,
+                     const struct chunk *sync, size_t *sync_index)
+{
+    struct turkc_mapping m;
+    struct turkc_token tok;
+    turkc_lexer *lx;
+    size_t window, pos, j = 0;
+    int kind;
+
+    out->start = from;
+    out->end = end;
+    out->count = 0;
+    out->error = NULL;
+    out->error_line = 0;
+    if (sync_index)
+        *sync_index = sync->count;
+    if (turkc_map_file(sp->fd, &m) != 0) {
+        out->error = "dosya map edilemedi";
+        return;
+    }
+
+    /* flex buffer boyu int: pencerenin sonuna NUL yaz (mapping bu taramaya ait) */
+    window = m.size - from;
+    if (window > INT_MAX - 2) {
+        window = INT_MAX - 2;
+        m.data[from + window] = m.data[from + window + 1] = '\0';
+    }
+    lx = turkc_lexer_open_buffer(m.data + from, window);
+    if (!lx) {
+        out->error = "bellek yetersiz";
+        turkc_unmap_file(&m);
+        return;
+    }
+
+    while ((kind = turkc_lexer_next(lx, &tok)) > 0) {
+        pos = from + tok.offset;
+        if (pos >= end)
+            break;
+        if (sync) {
+            while (j < sync->count && sync->start + sync->toks[j].offset < pos)
+                j++;
+            if (j < sync->count && sync->start + sync->toks[j].offset == pos) {
+                *sync_index = j;
+                break;
+            }
+        }
+        if (push_token(out, kind, &tok) != 0) {
+            out->error = "bellek yetersiz";
+            break;
+        }
+    }
+    /* end'den sonra başlayan kapanmayan literal sonraki chunk'ın hatasıdır */
+    if ((kind < 0 || kind == 0) && from + window < m.size)
+        out->error = "token flex buffer sinirindan uzun";
+    else if (kind < 0 && from + tok.offset < end) {
+        out->error = turkc_lexer_error(lx);
+        out->error_line = tok.line;
+    }
+    out->next = from + tok.offset;
+    out->next_line = tok.line;
+    out->eof = kind == 0;
+
+    turkc_lexer_close(lx);
+    turkc_unmap_file(&m);
+}
+
+static void lex_chunk(void *ctx, size_t task, int worker)
+{
+    struct split *sp = ctx;
+    size_t k = sp->round_base + task;
+
+    (void)worker;
+    lex_from(sp, sp->bounds[k], sp->bounds[k + 1], &sp->chunks[task], NULL, NULL);
+}
+
+/* Sütunlar chunk'larda saklanmaz, birleştirirken hesaplanır: satır
+ * değiştiyse önceki token'ın başından bu yana son '\n' geriye doğru aranır.
+ * Toplamda sadece satırların token'dan önceki kısımları okunur.
+ */
+static unsigned long column_of(struct split *sp, size_t pos, unsigned long line)
+{
+    const char *d = sp->source.data;
+    size_t p = pos;
+
+    if (line != sp->col_line) {
+        while (p > sp->col_pos && d[p - 1] != '\n')
+            p--;
+        sp->line_start = p;
+        sp->col_line = line;
+    }
+    sp->col_pos = pos;
+    return pos - sp->line_start + 1;
+}
+
+/* c->toks[first..] gerçek ofset ve satırlarla verilir */
+static int emit_from(struct split *sp, const struct chunk *c, size_t first,
+                     unsigned long delta)
+{
+    const struct turkc_token_record *r;
+    size_t i, pos;
+
+    for (i = first; i < c->count; i++) {
+        r = &c->toks[i];
+        pos = c->start + r->offset;
+        if (sp->emit(sp->ctx, r->kind, sp->source.data + pos, r->length, pos,
+                     r->line + delta, column_of(sp, pos, r->line + delta)) != 0)
+            return -1;
+    }
+    return 0;
+}
+
+static int find_token(const struct chunk *c, size_t pos, size_t *index)
+{
+    size_t lo = 0, hi = c->count, mid, off;
+
+    while (lo < hi) {
+        mid = lo + (hi - lo) / 2;
+        off = c->start + c->toks[mid].offset;
+        if (off == pos) {
+            *index = mid;
+            return 1;
+        }
+        if (off < pos)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return 0;
+}
+
+/* Chunk'ı gerçek taramaya ekler. Hata mesajı döner, başarıda NULL. */
+static const char *stitch(struct split *sp, struct chunk *c, struct chunk *scratch)
+{
+    unsigned long delta;
+    size_t i;
+
+    if (sp->done || sp->cont >= c->end)
+        return NULL;                /* bu chunk'ta başlayan token yok */
+
+    /* Gerçek ofsetten başlayan chunk'ın hatası gerçektir (örn. kapanmayan
+     * yorum): önceki token'lar verilip hata döner.
+     */
+    if (sp->cont == c->start && c->error_line) {
+        if (emit_from(sp, c, 0, sp->cont_line - 1) != 0)
+            return "tarama durduruldu";
+        sp->err_offset = c->next;
+        sp->err_line = sp->cont_line - 1 + c->error_line;
+        return c->error;
+    }
+
+    /* Tahmini tarama başarısızsa (örn. string ortasından başlayıp buffer
+     * sınırına dayandıysa) chunk'ın tamamı gerçek ofsetten taranır.
+     */
+    if (c->error)
+        c->count = 0;
+
+    if (sp->cont == c->start && !c->error) {
+        i = 0;
+        delta = sp->cont_line - 1;
+    } else if (find_token(c, sp->cont, &i)) {
+        delta = sp->cont_line - c->toks[i].line;
+    } else {
+        /* Sınır bir token'ın içine düşmüş: gerçek ofsetten senkronize olana kadar tara */
+        sp->stats.resynced++;
+        lex_from(sp, sp->cont, c->end, scratch, c, &i);
+        sp->stats.relexed_bytes += scratch->next - sp->cont;
+        if (emit_from(sp, scratch, 0, sp->cont_line - 1) != 0)
+            return "tarama durduruldu";
+        if (scratch->error) {
+            if (scratch->error_line) {
+                sp->err_offset = scratch->next;
+                sp->err_line = sp->cont_line - 1 + scratch->error_line;
+            }
+            return scratch->error;
+        }
+        if (i == c->count) {
+            sp->cont_line += scratch->next_line - 1;
+            sp->cont = scratch->next;
+            sp->done = scratch->eof;
+            return NULL;
+        }
+        delta = sp->cont_line - 1 + scratch->next_line - c->toks[i].line;
+    }
+
+    if (emit_from(sp, c, i, delta) != 0)
+        return "tarama durduruldu";
+    sp->cont = c->next;
+    sp->cont_line = c->next_line + delta;
+    sp->done = c->eof;
+    return NULL;
+}
+
+/* p'deki '"' veya '/' ile başlayan lexeme'in sonu. scanner.l'deki string,
+ * yorum ve '/' kurallarını izler; kapanmayan string/yorum dosya sonuna kadar
+ * sürer (tarama orada hata verir).
+ */
+static size_t special_end(const char *d, size_t size, size_t p)
+{
+    const char *c;
+    size_t i;
+
+    if (d[p] == '"') {
+        c = memchr(d + p + 1, '"', size - p - 1);
+        return c ? (size_t)(c - d) + 1 : size;
+    }
+    if (p + 1 < size && d[p + 1] == '/') {
+        c = memchr(d + p, '\n', size - p);
+        return c ? (size_t)(c - d) : size;
+    }
+    if (p + 1 < size && d[p + 1] == '*') {
+        for (i = p + 2; i + 1 < size; i = c - d + 1) {
+            c = memchr(d + i, '*', size - 1 - i);
+            if (!c)
+                break;
+            if (c[1] == '/')
+                return c - d + 2;
+        }
+        return size;
+    }
+    return p + 1;
+}
+
+/* Sınırlar kesin lexeme sınırlarıdır. Sıralı bir ön tarama sadece string ve
+ * yorumları izler (diğer token'lar '"' ve '/' içermez); satır başındaki aday
+ * sınır böyle bir lexeme'in içine düşerse sınır lexeme'in sonuna kayar.
+ * Satır başları whitespace ortasında olsa da token'lar aynıdır.
+ */
+static int make_bounds(struct split *sp, size_t chunk_size)
+{
+    const char *d = sp->source.data, *nl;
+    size_t size = sp->source.size, n = 1, pos, p = 0, b, q;
+
+    sp->bounds = malloc((size / chunk_size + 2) * sizeof(*sp->bounds));
+    if (!sp->bounds)
+        return -1;
+    sp->bounds[0] = 0;
+    for (pos = chunk_size; pos < size; pos = b + chunk_size) {
+        nl = memchr(d + pos, '\n', size - pos);
+        if (!nl)
+            break;
+        b = nl + 1 - d;
+        for (;;) {
+            while (p < b && d[p] != '"' && d[p] != '/')
+                p++;
+            if (p >= b)
+                break;
+            q = special_end(d, size, p);
+            p = q;
+            if (q > b) {
+                b = q;
+                break;
+            }
+        }
+        if (b >= size)
+            break;
+        sp->bounds[n++] = b;
+    }
+    sp->bounds[n] = size;
+    sp->nbounds = n + 1;
+    return 0;
+}
+
+/* Hata konumunun sütunu: satır başı geriye doğru aranır (bir kez) */
+static void set_error(struct split *sp, const char *msg, struct turkc_split_error *error)
+{
+    const char *d = sp->source.data;
+    size_t p = sp->err_offset;
+
+    error->message = msg;
+    error->offset = sp->err_offset;
+    error->line = sp->err_line;
+    error->column = 0;
+    if (sp->err_line) {
+        while (p > 0 && d[p - 1] != '\n')
+            p--;
+        error->column = sp->err_offset - p + 1;
+    }
+}
+
+int turkc_split_scan(int fd, int nworkers, size_t chunk_size,
+                     turkc_split_fn emit, void *ctx,
+                     struct turkc_split_stats *stats,
+                     struct turkc_split_error *error)
+{
+    struct split sp;
+    struct chunk scratch;
+    size_t nchunks, per_round, k, n;
+    const char *err = NULL;
+
+    memset(&sp, 0, sizeof(sp));
+    memset(&scratch, 0, sizeof(scratch));
+    if (nworkers <= 0)
+        nworkers = turkc_pool_ncpu();
+    if (chunk_size == 0)
+        chunk_size = TURKC_SPLIT_CHUNK;
+    if (turkc_map_file(fd, &sp.source) != 0) {
+        memset(error, 0, sizeof(*error));
+        error->message = "dosya map edilemedi";
+        return -1;
+    }
+    sp.fd = fd;
+    sp.emit = emit;
+    sp.ctx = ctx;
+    sp.cont_line = 1;
+    sp.col_line = 1;
+
+    /* Chunk'lar turlar halinde taranır; bellekte en fazla bir turun token'ları olur */
+    per_round = (size_t)nworkers * 2;
+    sp.chunks = calloc(per_round, sizeof(*sp.chunks));
+    if (!sp.chunks || make_bounds(&sp, chunk_size) != 0) {
+        err = "bellek yetersiz";
+        goto out;
+    }
+    nchunks = sp.nbounds - 1;
+
+    for (sp.round_base = 0; sp.round_base < nchunks && !err; sp.round_base += n) {
+        n = nchunks - sp.round_base < per_round ? nchunks - sp.round_base : per_round;
+        turkc_pool_run(n, nworkers, lex_chunk, &sp);
+        for (k = 0; k < n && !err; k++)
+            err = stitch(&sp, &sp.chunks[k], &scratch);
+        sp.stats.chunks += n;
+    }
+
+out:
+    if (sp.chunks)
+        for (k = 0; k < per_round; k++)
+            free(sp.chunks[k].toks);
+    free(sp.chunks);
+    free(sp.bounds);
+    free(scratch.toks);
+    if (err)
+        set_error(&sp, err, error);
+    turkc_unmap_file(&sp.source);
+    if (stats)
+        *stats = sp.stats;
+    if (err)
+        return -1;
+    return 0;
+}
@@ -0,0 +1,58 @@
+#ifndef TURKC_SPLIT_H
+#define TURKC_SPLIT_H
+
+/* Tek bir büyük dosyayı parçalara bölüp paralel tarar.
+ *
+ * Dosya ~chunk_size'lık parçalara bölünür. Sınırlar, sadece string ve
+ * yorumları izleyen hızlı bir sıralı ön taramayla kesin token sınırlarına
+ * çekilir (sınır bir yorumun veya string'in içine düşerse onun sonuna kayar;
+ * kapanmayan bir string/yorumdan sonra sınır konmaz).
+ * Her chunk ayrı bir thread'de, kendi private mmap'i üzerinde taranır ve
+ * chunk'lar sırayla birleştirilir. Birleştirirken sıralı taramanın chunk'a
+ * girdiği ofsetin chunk'ın da bir token başı olduğu kontrol edilir; değilse
+ * chunk o ofsetten, iki tarama ortak bir token başında buluşana kadar
+ * yeniden taranır. Sonuç sıralı taramayla token token aynıdır.
+ */
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Token'lar dosyadaki sırayla verilir (TK_EOF hariç). text dosyanın
+ * mapping'ini gösterir ve NUL ile bitmez. 0 dışı dönüş taramayı durdurur.
+ */
+typedef int (*turkc_split_fn)(void *ctx, int kind, const char *text,
+                              unsigned long length, unsigned long offset,
+                              unsigned long line, unsigned long column);
+
+struct turkc_split_stats {
+    unsigned long chunks;           /* taranan chunk sayısı */
+    unsigned long resynced;         /* yeniden senkronize edilen chunk'lar (normalde 0) */
+    unsigned long relexed_bytes;    /* senkronizasyon için yeniden taranan byte */
+};
+
+struct turkc_split_error {
+    const char *message;
+    unsigned long offset, line, column;     /* line 0: konumsuz hata */
+};
+
+#define TURKC_SPLIT_CHUNK (1UL << 20)
+
+/* fd normal bir dosya olmalı (mmap). nworkers <= 0: çekirdek sayısı,
+ * chunk_size 0: TURKC_SPLIT_CHUNK. Başarıda 0, hata olursa -1 döner ve
+ * *error doldurulur. Kapanmayan string/yorumda, sıralı taramada olduğu gibi
+ * önceki token'lar verilir ve hata literal'in başını gösterir. stats NULL
+ * olabilir.
+ */
+int turkc_split_scan(int fd, int nworkers, size_t chunk_size,
+                     turkc_split_fn emit, void *ctx,
+                     struct turkc_split_stats *stats,
+                     struct turkc_split_error *error);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,36 @@
+#include <pthread.h>
+
+#include "turkc_stack.h"
+
+struct stack_call {
+    turkc_stack_fn fn;
+    void *arg;
+};
+
+static void *stack_main(void *arg)
+{
+    struct stack_call *c = arg;
+
+    c->fn(c->arg, TURKC_C_STACK - TURKC_C_STACK_SPARE);
+    return NULL;
+}
+
+void turkc_stack_run(turkc_stack_fn fn, void *arg)
+{
+    struct stack_call c;
+    pthread_attr_t attr;
+    pthread_t thread;
+    int rc = -1;
+
+    c.fn = fn;
+    c.arg = arg;
+    if (pthread_attr_init(&attr) == 0) {
+        if (pthread_attr_setstacksize(&attr, TURKC_C_STACK) == 0)
+            rc = pthread_create(&thread, &attr, stack_main, &c);
+        pthread_attr_destroy(&attr);
+    }
+    if (rc == 0)
+        pthread_join(thread, NULL);
+    else
+        fn(arg, TURKC_C_STACK_FALLBACK);
+}
@@ -0,0 +1,43 @@
+#ifndef TURKC_STACK_H
+#define TURKC_STACK_H
+
+/* Çalıştırma motorlarının ortak sınırları ve C yığını.
+ *
+ * Her motor (turkc_interp, turkc_vm, turkc_jit, turkc_ir, turkc_x86) aynı
+ * anda en fazla TURKC_MAX_CALL_DEPTH çağrının etkin olmasına izin verir;
+ * ana da sayılır. Sınırı aşan çağrı, çağrının konumuyla "cok derin
+ * ozyineleme" çalışma hatasıdır (bkz. spesifikasyon.md).
+ *
+ * C'de özyinelemeyle çalışanlar (ağaç ve IR yorumlayıcıları, derlenmiş
+ * kod) bu derinliğe varsayılan 8 MB ana yığında ulaşamaz; turkc_stack_run
+ * onları TURKC_C_STACK byte'lık ayrı bir yığında çalıştırır, x86'nın
+ * ürettiği main de ana'yı böyle bir yığında çağırır. Bu yığın da biterse
+ * (özyinelemeyle birlikte binlerce seviye iç içe ifade gibi) aynı hata
+ * verilir, süreç çökmez.
+ */
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TURKC_MAX_CALL_DEPTH    100000
+#define TURKC_C_STACK           (256u << 20)    /* ayrılır, kullanıldıkça dolar */
+#define TURKC_C_STACK_SPARE     (256u << 10)    /* sınırın altında yaz() ve libc için */
+#define TURKC_C_STACK_FALLBACK  (4u << 20)      /* ayrı yığın alınamazsa, ana yığında */
+
+/* limit: fn'in girişinden itibaren kullanabileceği C yığını (byte) */
+typedef void (*turkc_stack_fn)(void *arg, size_t limit);
+
+/* fn'i TURKC_C_STACK byte'lık yığını olan bir thread'de çağırır ve
+ * bitmesini bekler. Thread açılamazsa fn çağıran thread'de
+ * TURKC_C_STACK_FALLBACK limitiyle çağrılır.
+ */
+void turkc_stack_run(turkc_stack_fn fn, void *arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,17 @@
+#ifndef TURKC_TIME_H
+#define TURKC_TIME_H
+
+/* --stats ve benchmark ölçümleri için monoton saat */
+
+#include <time.h>
+
+/* Saniye; yalnızca iki ölçüm arasındaki fark anlamlıdır */
+static inline double turkc_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+#endif
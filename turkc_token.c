@@ -0,0 +1,57 @@
+#include <stddef.h>
+
+#include "turkc_token.h"
+
+static const char *const spellings[TK_COUNT] = {
+    [TK_EGER]    = "eger",
+    [TK_DEGILSE] = "degilse",
+    [TK_ICIN]    = "icin",
+    [TK_IKEN]    = "iken",
+    [TK_DONDUR]  = "dondur",
+    [TK_INT]     = "int",
+    [TK_VOID]    = "void",
+
+    [TK_PLUS]    = "+",
+    [TK_MINUS]   = "-",
+    [TK_STAR]    = "*",
+    [TK_SLASH]   = "/",
+    [TK_PERCENT] = "%",
+    [TK_EQ]      = "==",
+    [TK_NE]      = "!=",
+    [TK_LT]      = "<",
+    [TK_GT]      = ">",
+    [TK_LE]      = "<=",
+    [TK_GE]      = ">=",
+    [TK_ASSIGN]  = "=",
+
+    [TK_LPAREN]  = "(",
+    [TK_RPAREN]  = ")",
+    [TK_LBRACE]  = "{",
+    [TK_RBRACE]  = "}",
+    [TK_SEMI]    = ";",
+    [TK_COMMA]   = ",",
+};
+
+const char *turkc_token_category(int kind)
+{
+    if (kind >= TK_EGER && kind <= TK_VOID)
+        return "KEYWORD";
+    if (kind >= TK_PLUS && kind <= TK_ASSIGN)
+        return "OPERATOR";
+    if (kind >= TK_LPAREN && kind <= TK_COMMA)
+        return "PUNCTUATION";
+    switch (kind) {
+    case TK_IDENTIFIER: return "IDENTIFIER";
+    case TK_NUMBER:     return "NUMBER";
+    case TK_STRING:     return "STRING";
+    case TK_EOF:        return "EOF";
+    default:            return "UNKNOWN";
+    }
+}
+
+const char *turkc_token_spelling(int kind)
+{
+    if (kind < 0 || kind >= TK_COUNT)
+        return NULL;
+    return spellings[kind];
+}
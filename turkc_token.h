@@ -0,0 +1,65 @@
+#ifndef TURKC_TOKEN_H
+#define TURKC_TOKEN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* TurkC token türleri.
+ * Bu numaralar binary token formatına yazılır, sırayı değiştirmeyin;
+ * yeni türleri TK_COUNT'tan önce sona ekleyin.
+ */
+enum turkc_token_kind {
+    TK_EOF = 0,
+
+    /* KEYWORD */
+    TK_EGER,
+    TK_DEGILSE,
+    TK_ICIN,
+    TK_IKEN,
+    TK_DONDUR,
+    TK_INT,
+    TK_VOID,
+
+    TK_IDENTIFIER,
+    TK_NUMBER,
+    TK_STRING,
+
+    /* OPERATOR */
+    TK_PLUS,        /* +  */
+    TK_MINUS,       /* -  */
+    TK_STAR,        /* *  */
+    TK_SLASH,       /* /  */
+    TK_PERCENT,     /* %  */
+    TK_EQ,          /* == */
+    TK_NE,          /* != */
+    TK_LT,          /* <  */
+    TK_GT,          /* >  */
+    TK_LE,          /* <= */
+    TK_GE,          /* >= */
+    TK_ASSIGN,      /* =  */
+
+    /* PUNCTUATION */
+    TK_LPAREN,
+    TK_RPAREN,
+    TK_LBRACE,
+    TK_RBRACE,
+    TK_SEMI,
+    TK_COMMA,
+
+    TK_UNKNOWN,
+
+    TK_COUNT
+};
+
+/* "KEYWORD", "IDENTIFIER", ... (text çıktısındaki ön ek) */
+const char *turkc_token_category(int kind);
+
+/* Sabit yazımlı token'lar için metin ("eger", "+", ...), diğerleri için NULL */
+const char *turkc_token_spelling(int kind);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
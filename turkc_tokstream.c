@@ -0,0 +1,225 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "turkc_token.h"
+#include "turkc_tokstream.h"
+
+/* ---- Writer ---- */
+
+struct turkc_tokstream_writer *turkc_tokstream_writer_open(FILE *out)
+{
+    return turkc_tokstream_writer_open_flags(out, 0);
+}
+
+struct turkc_tokstream_writer *turkc_tokstream_writer_open_flags(FILE *out, uint32_t flags)
+{
+    struct turkc_tokstream_writer *w;
+    struct turkc_tokstream_header h;
+
+    w = malloc(sizeof(*w));
+    if (!w)
+        return NULL;
+    w->out = out;
+    w->error = 0;
+    w->used = 0;
+
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, TURKC_TOKSTREAM_MAGIC, 4);
+    h.version = flags ? TURKC_TOKSTREAM_VERSION_FLAGS : TURKC_TOKSTREAM_VERSION;
+    h.record_size = sizeof(struct turkc_token_record);
+    h.flags = flags;
+    if (fwrite(&h, sizeof(h), 1, out) != 1)
+        w->error = 1;
+    return w;
+}
+
+void turkc_tokstream_flush(struct turkc_tokstream_writer *w)
+{
+    if (w->used && fwrite(w->buf, sizeof(w->buf[0]), w->used, w->out) != w->used)
+        w->error = 1;
+    w->used = 0;
+}
+
+int turkc_tokstream_writer_close(struct turkc_tokstream_writer *w)
+{
+    int err;
+
+    turkc_tokstream_flush(w);
+    if (fflush(w->out) != 0)
+        w->error = 1;
+    err = w->error;
+    free(w);
+    return err ? -1 : 0;
+}
+
+/* ---- Reader ---- */
+
+struct turkc_tokstream_reader {
+    FILE *in;
+    int error, done;
+    uint32_t flags;
+    char *symtab;               /* interned: sembol metinleri */
+    uint32_t *sym_off;          /* sembol i: symtab + sym_off[i] */
+    uint32_t nsyms;
+    size_t pos, count;
+    struct turkc_token_record buf[TURKC_TOKSTREAM_BATCH];
+};
+
+turkc_tokstream_reader *turkc_tokstream_open(FILE *in)
+{
+    turkc_tokstream_reader *r;
+    struct turkc_tokstream_header h;
+
+    if (fread(&h, sizeof(h), 1, in) != 1)
+        return NULL;
+    if (memcmp(h.magic, TURKC_TOKSTREAM_MAGIC, 4) != 0 ||
+        h.record_size != sizeof(struct turkc_token_record))
+        return NULL;
+    if (h.version == TURKC_TOKSTREAM_VERSION)
+        h.flags = 0;
+    else if (h.version != TURKC_TOKSTREAM_VERSION_FLAGS ||
+             (h.flags & ~TURKC_TOKSTREAM_INTERNED) != 0)
+        return NULL;
+
+    r = malloc(sizeof(*r));
+    if (!r)
+        return NULL;
+    r->in = in;
+    r->error = r->done = 0;
+    r->flags = h.flags;
+    r->symtab = NULL;
+    r->sym_off = NULL;
+    r->nsyms = 0;
+    r->pos = r->count = 0;
+    return r;
+}
+
+/* Kesik son kayıt varsa (dosya boyu kayıt boyunun katı değil) hata sayılır */
+static size_t read_records(turkc_tokstream_reader *r,
+                           struct turkc_token_record *out, size_t max)
+{
+    size_t bytes = fread(out, 1, max * sizeof(*out), r->in);
+
+    if (bytes % sizeof(*out) != 0 || ferror(r->in))
+        r->error = 1;
+    return bytes / sizeof(*out);
+}
+
+/* Sonlandırıcı kayıttan sonraki sembol tablosunu okur. Tablonun başı
+ * kayıt buffer'ına okunmuş olabilir.
+ */
+static int load_symbols(turkc_tokstream_reader *r, const struct turkc_token_record *end)
+{
+    size_t size = (size_t)end->length * sizeof(struct turkc_token_record);
+    size_t have = (r->count - r->pos) * sizeof(struct turkc_token_record);
+    size_t pos = 0;
+    uint32_t i, len;
+
+    r->nsyms = end->offset;
+    r->symtab = malloc(size + 1);
+    r->sym_off = malloc(((size_t)r->nsyms + 1) * sizeof(*r->sym_off));
+    if (!r->symtab || !r->sym_off || have > size)
+        return -1;
+    memcpy(r->symtab, r->buf + r->pos, have);
+    r->pos = r->count;
+    if (fread(r->symtab + have, 1, size - have, r->in) != size - have)
+        return -1;
+
+    /* uzunluk + metin, art arda */
+    for (i = 0; i < r->nsyms; i++) {
+        if (size - pos < 4)
+            return -1;
+        memcpy(&len, r->symtab + pos, 4);
+        if (len > size - pos - 4)
+            return -1;
+        r->sym_off[i] = (uint32_t)pos;
+        pos += 4 + len;
+    }
+    r->sym_off[r->nsyms] = (uint32_t)pos;
+
+    /* Metinleri NUL ile kapat: NUL, okunmuş olan sonraki uzunluğun üstüne gelir */
+    for (i = 1; i <= r->nsyms; i++)
+        r->symtab[r->sym_off[i]] = '\0';
+    return 0;
+}
+
+int turkc_tokstream_next(turkc_tokstream_reader *r, struct turkc_token_record *rec)
+{
+    if (r->done)
+        return r->error ? -1 : 0;
+    if (r->pos == r->count) {
+        if (r->error)
+            return -1;
+        r->pos = 0;
+        r->count = read_records(r, r->buf, TURKC_TOKSTREAM_BATCH);
+        if (r->count == 0) {
+            /* interned akış sonlandırıcı kayıtla biter */
+            if (r->flags & TURKC_TOKSTREAM_INTERNED)
+                r->error = 1;
+            return r->error ? -1 : 0;
+        }
+    }
+    *rec = r->buf[r->pos++];
+    if ((r->flags & TURKC_TOKSTREAM_INTERNED) && rec->kind == TK_EOF) {
+        r->done = 1;
+        if (load_symbols(r, rec) != 0) {
+            r->error = 1;
+            return -1;
+        }
+        return 0;
+    }
+    return 1;
+}
+
+size_t turkc_tokstream_read(turkc_tokstream_reader *r,
+                            struct turkc_token_record *out, size_t max)
+{
+    struct turkc_token_record rec;
+    size_t n = 0;
+
+    /* Interned akışta sonlandırıcı kayıt aranmalı */
+    if (r->flags & TURKC_TOKSTREAM_INTERNED) {
+        while (n < max && turkc_tokstream_next(r, &rec) == 1)
+            out[n++] = rec;
+        return n;
+    }
+
+    /* Önce iç buffer'da kalanlar */
+    while (n < max && r->pos < r->count)
+        out[n++] = r->buf[r->pos++];
+    if (n < max && !r->error)
+        n += read_records(r, out + n, max - n);
+    return n;
+}
+
+int turkc_tokstream_error(const turkc_tokstream_reader *r)
+{
+    return r->error;
+}
+
+uint32_t turkc_tokstream_flags(const turkc_tokstream_reader *r)
+{
+    return r->flags;
+}
+
+uint32_t turkc_tokstream_symbol_count(const turkc_tokstream_reader *r)
+{
+    return r->nsyms;
+}
+
+const char *turkc_tokstream_symbol(const turkc_tokstream_reader *r, uint32_t id,
+                                   uint32_t *len)
+{
+    if (id >= r->nsyms || !r->symtab)
+        return NULL;
+    if (len)
+        *len = r->sym_off[id + 1] - r->sym_off[id] - 4;
+    return r->symtab + r->sym_off[id] + 4;
+}
+
+void turkc_tokstream_close(turkc_tokstream_reader *r)
+{
+    free(r->symtab);
+    free(r->sym_off);
+    free(r);
+}
@@ -0,0 +1,118 @@
+#ifndef TURKC_TOKSTREAM_H
+#define TURKC_TOKSTREAM_H
+
+/* Binary token akışı (scanner --format=binary).
+ *
+ * Dosya düzeni: bir header, ardından sabit boyutlu kayıtlar, EOF'a kadar.
+ * Tüm alanlar little-endian (x86/ARM için native). Ofsetler 32 bit olduğu
+ * için tek bir kaynak dosyası en fazla 4 GiB olabilir; ötesindeki token'ı
+ * turkc_tokstream_put yazmaz.
+ *
+ * Interned akış (version 2, flags'te TURKC_TOKSTREAM_INTERNED): IDENTIFIER
+ * ve STRING kayıtlarında length yerine sembol ID'si yazılır (uzunluk
+ * sembolün uzunluğudur). Son token'dan sonra kind = TK_EOF olan bir kayıt
+ * gelir: offset sembol sayısı, length tablonun kayıt (16 byte) cinsinden
+ * boyu. Ardından ID sırasıyla her sembol için uint32 uzunluk ve metin,
+ * 16 byte'ın katına sıfırla tamamlanmış olarak (bkz. turkc_intern.h).
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TURKC_TOKSTREAM_MAGIC   "TKCB"
+#define TURKC_TOKSTREAM_VERSION 1
+#define TURKC_TOKSTREAM_VERSION_FLAGS 2     /* flags alanı kullanılıyor */
+
+#define TURKC_TOKSTREAM_INTERNED 0x1u
+
+struct turkc_tokstream_header {
+    char     magic[4];      /* "TKCB" */
+    uint16_t version;
+    uint16_t record_size;   /* sizeof(struct turkc_token_record) */
+    uint32_t flags;         /* version 1'de 0 */
+    uint32_t reserved;
+};
+
+struct turkc_token_record {
+    uint32_t kind;          /* enum turkc_token_kind */
+    uint32_t offset;        /* girişteki byte ofseti */
+    uint32_t length;        /* lexeme uzunluğu (byte) */
+    uint32_t line;          /* 1'den başlar */
+};
+
+/* Her fwrite'ta yazılan kayıt sayısı (16 byte * 64K = 1 MiB) */
+#define TURKC_TOKSTREAM_BATCH 65536
+
+/* ---- Writer ---- */
+
+struct turkc_tokstream_writer {
+    FILE *out;
+    int error;
+    size_t used;
+    struct turkc_token_record buf[TURKC_TOKSTREAM_BATCH];
+};
+
+/* Header'ı yazar. Buffer büyük olduğu için writer heap'te tutulmalı. */
+struct turkc_tokstream_writer *turkc_tokstream_writer_open(FILE *out);
+/* flags != 0 ise version 2 header yazılır */
+struct turkc_tokstream_writer *turkc_tokstream_writer_open_flags(FILE *out, uint32_t flags);
+void turkc_tokstream_flush(struct turkc_tokstream_writer *w);
+/* Flush edip kapatır; yazma hatası olduysa -1 döner */
+int turkc_tokstream_writer_close(struct turkc_tokstream_writer *w);
+
+/* Kaydı tampona ekler. offset, length veya line 32 bite sığmazsa (4 GiB'tan
+ * büyük giriş) kayıt yazılmaz ve -1 döner.
+ */
+static inline int turkc_tokstream_put(struct turkc_tokstream_writer *w,
+                                      uint32_t kind, unsigned long offset,
+                                      unsigned long length, unsigned long line)
+{
+    struct turkc_token_record *r;
+
+    if ((offset | length | line) > UINT32_MAX)
+        return -1;
+    if (w->used == TURKC_TOKSTREAM_BATCH)
+        turkc_tokstream_flush(w);
+    r = &w->buf[w->used++];
+    r->kind = kind;
+    r->offset = offset;
+    r->length = length;
+    r->line = line;
+    return 0;
+}
+
+/* ---- Reader ---- */
+
+typedef struct turkc_tokstream_reader turkc_tokstream_reader;
+
+/* Header'ı okuyup doğrular; geçersiz akışta NULL döner */
+turkc_tokstream_reader *turkc_tokstream_open(FILE *in);
+
+/* Sonraki kaydı okur: 1 = kayıt var, 0 = akış bitti, -1 = bozuk/kesik akış */
+int turkc_tokstream_next(turkc_tokstream_reader *r, struct turkc_token_record *rec);
+
+/* En fazla max kaydı doğrudan out'a kopyalar; okunan sayıyı döner (0 = bitti) */
+size_t turkc_tokstream_read(turkc_tokstream_reader *r,
+                            struct turkc_token_record *out, size_t max);
+
+int turkc_tokstream_error(const turkc_tokstream_reader *r);
+
+uint32_t turkc_tokstream_flags(const turkc_tokstream_reader *r);
+
+/* Interned akış: turkc_tokstream_next 0 döndükten sonra sembol tablosu.
+ * Olmayan ID için NULL; metin NUL ile biter.
+ */
+uint32_t turkc_tokstream_symbol_count(const turkc_tokstream_reader *r);
+const char *turkc_tokstream_symbol(const turkc_tokstream_reader *r, uint32_t id,
+                                   uint32_t *len);
+void turkc_tokstream_close(turkc_tokstream_reader *r);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,919 @@
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "turkc_jit.h"
+#include "turkc_stack.h"
+#include "turkc_token.h"
+#include "turkc_vm.h"
+
+/* GCC/Clang: computed goto ile doğrudan threading; TURKC_VM_SWITCH ile
+ * karşılaştırma için switch'e zorlanabilir
+ */
+#if defined(__GNUC__) && !defined(TURKC_VM_SWITCH)
+#define THREADED 1
+#endif
+
+#define NONE    (-1)
+#define MAX_REG 0xffff
+
+struct frame {
+    const struct turkc_insn *pc;        /* CALL komutu */
+    const struct turkc_vm_func *fn;
+    int32_t *base;
+};
+
+struct turkc_vm {
+    struct turkc_jit_ctx ctx;           /* ilk alan: JIT yardımcıları ctx'ten vm'e döner */
+    const struct turkc_program *prog;
+    struct turkc_vm_func *funcs;
+    int32_t *globals;
+    int32_t *stack, *end;
+    struct frame *frames;
+    uint32_t frame_cap;
+    FILE *out;
+    int threaded;
+    uint32_t jit;                       /* çağrı eşiği, 0: JIT kapalı */
+    uint32_t nframes;                   /* derlenmiş koda girerken kullanılan çerçeveler */
+    struct turkc_parse_error *err;
+    jmp_buf fail;                       /* derlenmiş koddaki hatalar buraya döner */
+};
+
+static const char *const opcode_names[OP_COUNT] = {
+    [OP_MOVE] = "MOVE",   [OP_LOADK] = "LOADK", [OP_GGET] = "GGET",  [OP_GSET] = "GSET",
+    [OP_ADD] = "ADD",     [OP_SUB] = "SUB",     [OP_MUL] = "MUL",    [OP_DIV] = "DIV",
+    [OP_MOD] = "MOD",     [OP_EQ] = "EQ",       [OP_NE] = "NE",      [OP_LT] = "LT",
+    [OP_GT] = "GT",       [OP_LE] = "LE",       [OP_GE] = "GE",      [OP_NEG] = "NEG",
+    [OP_ADDK] = "ADDK",   [OP_JMP] = "JMP",     [OP_JZ] = "JZ",      [OP_JNZ] = "JNZ",
+    [OP_JEQ] = "JEQ",     [OP_JNE] = "JNE",     [OP_JLT] = "JLT",    [OP_JGT] = "JGT",
+    [OP_JLE] = "JLE",     [OP_JGE] = "JGE",     [OP_JEQK] = "JEQK",  [OP_JNEK] = "JNEK",
+    [OP_JLTK] = "JLTK",   [OP_JGTK] = "JGTK",   [OP_JLEK] = "JLEK",  [OP_JGEK] = "JGEK",
+    [OP_CALL] = "CALL",   [OP_YAZ] = "YAZ",     [OP_YAZS] = "YAZS",  [OP_RET] = "RET",
+    [OP_RET0] = "RET0",
+};
+
+const char *turkc_opcode_name(int op)
+{
+    if (op < 0 || op >= OP_COUNT)
+        return "?";
+    return opcode_names[op];
+}
+
+/* ---- Derleyici ---- */
+
+struct compiler {
+    const struct turkc_program *prog;
+    const struct turkc_node *nodes;
+    struct turkc_vm_func *fn;
+    size_t cap;
+    uint32_t nslots;            /* yerel değişkenler; ara değerler bunların üstünde */
+    uint32_t top;               /* ilk boş ara yazmaç */
+    uint32_t max;
+    struct turkc_parse_error *err;
+    jmp_buf fail;
+};
+
+static void fail(struct compiler *c, uint32_t node, const char *fmt, ...)
+{
+    va_list ap;
+
+    if (c->err) {
+        va_start(ap, fmt);
+        vsnprintf(c->err->message, sizeof(c->err->message), fmt, ap);
+        va_end(ap);
+        c->err->offset = c->nodes[node].offset;
+        c->err->line = 0;
+        c->err->column = 0;
+    }
+    longjmp(c->fail, 1);
+}
+
+static uint32_t emit(struct compiler *c, uint32_t node, int op, uint32_t a, uint32_t b, int32_t k)
+{
+    struct turkc_vm_func *fn = c->fn;
+    struct turkc_insn *in;
+    void *p;
+
+    if (fn->ncode == c->cap) {
+        c->cap = c->cap ? c->cap * 2 : 64;
+        p = realloc(fn->code, c->cap * sizeof(*fn->code));
+        if (!p)
+            fail(c, node, "bellek yetersiz");
+        fn->code = p;
+        p = realloc(fn->offsets, c->cap * sizeof(*fn->offsets));
+        if (!p)
+            fail(c, node, "bellek yetersiz");
+        fn->offsets = p;
+    }
+    in = &fn->code[fn->ncode];
+    memset(in, 0, sizeof(*in));
+    in->op = (uint8_t)op;
+    in->a = (uint16_t)a;
+    in->b = (uint16_t)b;
+    in->k = k;
+    fn->offsets[fn->ncode] = c->nodes[node].offset;
+    return fn->ncode++;
+}
+
+static uint32_t emit3(struct compiler *c, uint32_t node, int op, uint32_t a, uint32_t b, uint32_t r)
+{
+    uint32_t i = emit(c, node, op, a, b, 0);
+
+    c->fn->code[i].c = (uint16_t)r;
+    return i;
+}
+
+static uint32_t temp(struct compiler *c, uint32_t node)
+{
+    if (c->top >= MAX_REG)
+        fail(c, node, "fonksiyon cok buyuk (%u yazmac)", MAX_REG);
+    if (++c->top > c->max)
+        c->max = c->top;
+    return c->top - 1;
+}
+
+/* want < 0 ise herhangi bir yazmaç */
+static uint32_t target(struct compiler *c, uint32_t node, int want)
+{
+    return want >= 0 ? (uint32_t)want : temp(c, node);
+}
+
+/* Atlama hedefini sonradan yazar */
+static void patch(struct compiler *c, uint32_t at, uint32_t to)
+{
+    struct turkc_insn *in = &c->fn->code[at];
+
+    if (in->op >= OP_JEQK && in->op <= OP_JGEK) {
+        in->b = (uint16_t)(to & 0xffff);
+        in->c = (uint16_t)(to >> 16);
+    } else {
+        in->k = (int32_t)to;
+    }
+}
+
+static int binary_op(int tk)
+{
+    switch (tk) {
+    case TK_PLUS:    return OP_ADD;
+    case TK_MINUS:   return OP_SUB;
+    case TK_STAR:    return OP_MUL;
+    case TK_SLASH:   return OP_DIV;
+    case TK_PERCENT: return OP_MOD;
+    case TK_EQ:      return OP_EQ;
+    case TK_NE:      return OP_NE;
+    case TK_LT:      return OP_LT;
+    case TK_GT:      return OP_GT;
+    case TK_LE:      return OP_LE;
+    case TK_GE:      return OP_GE;
+    }
+    return OP_ADD;
+}
+
+static int is_compare(int tk)
+{
+    return tk >= TK_EQ && tk <= TK_GE;
+}
+
+/* a op b'nin tersi (!(a < b) = a >= b) ve aynası (a < b = b > a) */
+static int negate(int tk)
+{
+    switch (tk) {
+    case TK_EQ: return TK_NE;
+    case TK_NE: return TK_EQ;
+    case TK_LT: return TK_GE;
+    case TK_GT: return TK_LE;
+    case TK_LE: return TK_GT;
+    default:    return TK_LT;
+    }
+}
+
+static int mirror(int tk)
+{
+    switch (tk) {
+    case TK_LT: return TK_GT;
+    case TK_GT: return TK_LT;
+    case TK_LE: return TK_GE;
+    case TK_GE: return TK_LE;
+    default:    return tk;
+    }
+}
+
+static uint32_t expr(struct compiler *c, uint32_t i, int want);
+
+/* Sol işlenen: değişkenin yazmacı sağ taraftaki bir atamayla değişecekse
+ * önce kopyalanır (soldan sağa hesaplama)
+ */
+static uint32_t left(struct compiler *c, uint32_t a, uint32_t b)
+{
+    uint32_t r = expr(c, a, NONE), t;
+
+    if (r < c->nslots && (c->nodes[b].flags & TURKC_NF_ASSIGNS)) {
+        t = temp(c, a);
+        emit(c, a, OP_MOVE, t, r, 0);
+        r = t;
+    }
+    return r;
+}
+
+static uint32_t call(struct compiler *c, uint32_t i, int want)
+{
+    const struct turkc_node *n = &c->nodes[i];
+    uint32_t save = c->top, base = c->top, arg, r;
+
+    if (n->aux == TURKC_FUNC_YAZ) {
+        if (c->nodes[n->b].kind == ND_STRING) {
+            emit(c, i, OP_YAZS, 0, 0, (int32_t)c->nodes[n->b].a);
+        } else {
+            r = expr(c, n->b, NONE);
+            emit(c, i, OP_YAZ, r, 0, 0);
+        }
+        c->top = save;
+        return target(c, i, want);
+    }
+    /* argümanlar ardışık yazmaçlara: çağrılanın parametreleri */
+    for (arg = n->b; arg; arg = c->nodes[arg].next) {
+        r = temp(c, arg);
+        expr(c, arg, (int)r);
+        c->top = r + 1;
+    }
+    c->top = save;
+    r = target(c, i, want);
+    emit(c, i, OP_CALL, r, base, (int32_t)n->aux);
+    return r;
+}
+
+static uint32_t expr(struct compiler *c, uint32_t i, int want)
+{
+    const struct turkc_node *n = &c->nodes[i], *t;
+    uint32_t save = c->top, l, r, dst, j;
+    int32_t k;
+
+    switch (n->kind) {
+    case ND_NUMBER:
+        dst = target(c, i, want);
+        emit(c, i, OP_LOADK, dst, 0, (int32_t)n->a);
+        return dst;
+    case ND_NAME:
+        if (n->flags & TURKC_NF_GLOBAL) {
+            dst = target(c, i, want);
+            emit(c, i, OP_GGET, dst, 0, (int32_t)n->aux);
+            return dst;
+        }
+        if (want < 0 || (uint32_t)want == n->aux)
+            return n->aux;
+        emit(c, i, OP_MOVE, (uint32_t)want, n->aux, 0);
+        return (uint32_t)want;
+    case ND_ASSIGN:
+        t = &c->nodes[n->a];
+        if (t->flags & TURKC_NF_GLOBAL) {
+            r = expr(c, n->b, want);
+            emit(c, i, OP_GSET, r, 0, (int32_t)t->aux);
+            return r;
+        }
+        expr(c, n->b, (int)t->aux);
+        if (want < 0 || (uint32_t)want == t->aux)
+            return t->aux;
+        emit(c, i, OP_MOVE, (uint32_t)want, t->aux, 0);
+        return (uint32_t)want;
+    case ND_BINARY:
+        /* Sola bağlı zincir döngüyle: dipteki düğümün sol işleneni, sonra aux
+         * ile i'ye çıkılırken her düğüm. Ara sonuçlar geçicidir, sadece
+         * i'nin sonucu want'a yazılır.
+         */
+        j = turkc_chain_bottom(c->nodes, i);
+        n = &c->nodes[j];
+        if (n->op == TK_PLUS && c->nodes[n->a].kind == ND_NUMBER &&
+            c->nodes[n->b].kind != ND_NUMBER) {
+            /* süper komut: k + x */
+            r = expr(c, n->b, NONE);
+            c->top = save;
+            dst = target(c, j, j == i ? want : NONE);
+            emit(c, j, OP_ADDK, dst, r, (int32_t)c->nodes[n->a].a);
+            if (j == i)
+                return dst;
+            l = dst;
+            j = n->aux;
+        } else if ((n->op == TK_PLUS || n->op == TK_MINUS) && c->nodes[n->b].kind == ND_NUMBER) {
+            l = expr(c, n->a, NONE);
+        } else {
+            l = left(c, n->a, n->b);
+        }
+        for (;;) {
+            n = &c->nodes[j];
+            if ((n->op == TK_PLUS || n->op == TK_MINUS) && c->nodes[n->b].kind == ND_NUMBER) {
+                /* süper komut: x + k, x - k */
+                k = (int32_t)c->nodes[n->b].a;
+                c->top = save;
+                dst = target(c, j, j == i ? want : NONE);
+                emit(c, j, OP_ADDK, dst, l, n->op == TK_PLUS ? k : (int32_t)(0u - (uint32_t)k));
+            } else {
+                r = expr(c, n->b, NONE);
+                c->top = save;
+                dst = target(c, j, j == i ? want : NONE);
+                emit3(c, j, binary_op(n->op), dst, l, r);
+            }
+            if (j == i)
+                return dst;
+            l = dst;
+            j = n->aux;
+        }
+    case ND_NEG:
+        r = expr(c, n->a, NONE);
+        c->top = save;
+        dst = target(c, i, want);
+        emit(c, i, OP_NEG, dst, r, 0);
+        return dst;
+    case ND_CALL:
+        return call(c, i, want);
+    }
+    fail(c, i, "beklenmeyen dugum %s", turkc_node_name(n->kind));
+    return 0;
+}
+
+/* Koşul doğruysa (when = 1) veya yanlışsa (when = 0) atlayan komut;
+ * hedefi patch ile yazılır. Karşılaştırmalar tek komuttur.
+ */
+static uint32_t branch(struct compiler *c, uint32_t i, int when)
+{
+    const struct turkc_node *n = &c->nodes[i];
+    uint32_t save = c->top, l, r, at;
+    int tk;
+
+    if (n->kind == ND_BINARY && is_compare(n->op)) {
+        tk = when ? n->op : negate(n->op);
+        if (c->nodes[n->b].kind == ND_NUMBER) {
+            l = expr(c, n->a, NONE);
+            at = emit(c, i, OP_JEQK + (tk - TK_EQ), l, 0, (int32_t)c->nodes[n->b].a);
+        } else if (c->nodes[n->a].kind == ND_NUMBER) {
+            r = expr(c, n->b, NONE);
+            at = emit(c, i, OP_JEQK + (mirror(tk) - TK_EQ), r, 0, (int32_t)c->nodes[n->a].a);
+        } else {
+            l = left(c, n->a, n->b);
+            r = expr(c, n->b, NONE);
+            at = emit(c, i, OP_JEQ + (tk - TK_EQ), l, r, 0);
+        }
+    } else {
+        r = expr(c, i, NONE);
+        at = emit(c, i, when ? OP_JNZ : OP_JZ, r, 0, 0);
+    }
+    c->top = save;
+    return at;
+}
+
+static void statement(struct compiler *c, uint32_t i)
+{
+    const struct turkc_node *n = &c->nodes[i];
+    uint32_t s, at, body, end, save = c->top;
+
+    switch (n->kind) {
+    case ND_NONE:
+        break;
+    case ND_BLOCK:
+        for (s = n->a; s; s = c->nodes[s].next)
+            statement(c, s);
+        break;
+    case ND_VAR:
+        if (n->a)
+            expr(c, n->a, (int)n->aux);
+        else
+            emit(c, i, OP_LOADK, n->aux, 0, 0);
+        break;
+    case ND_IF:
+        at = branch(c, n->a, 0);
+        statement(c, n->b);
+        if (n->c) {
+            end = emit(c, i, OP_JMP, 0, 0, 0);
+            patch(c, at, c->fn->ncode);
+            statement(c, n->c);
+            patch(c, end, c->fn->ncode);
+        } else {
+            patch(c, at, c->fn->ncode);
+        }
+        break;
+    case ND_WHILE:
+        /* koşul sonda: tur başına tek atlama */
+        at = emit(c, i, OP_JMP, 0, 0, 0);
+        body = c->fn->ncode;
+        statement(c, n->b);
+        patch(c, at, c->fn->ncode);
+        patch(c, branch(c, n->a, 1), body);
+        break;
+    case ND_FOR:
+        if (n->a)
+            statement(c, n->a);
+        at = emit(c, i, OP_JMP, 0, 0, 0);
+        body = c->fn->ncode;
+        statement(c, n->d);
+        if (n->c)
+            expr(c, n->c, NONE);
+        c->top = save;
+        patch(c, at, c->fn->ncode);
+        if (n->b)
+            patch(c, branch(c, n->b, 1), body);
+        else
+            emit(c, i, OP_JMP, 0, 0, (int32_t)body);
+        break;
+    case ND_RETURN:
+        if (n->a)
+            emit(c, i, OP_RET, expr(c, n->a, NONE), 0, 0);
+        else
+            emit(c, i, OP_RET0, 0, 0, 0);
+        break;
+    case ND_EXPR:
+        expr(c, n->a, NONE);
+        break;
+    default:
+        fail(c, i, "beklenmeyen dugum %s", turkc_node_name(n->kind));
+    }
+    c->top = save;
+}
+
+static int compile(struct compiler *c, uint32_t func)
+{
+    const struct turkc_function *f = &c->prog->funcs[func];
+
+    if (setjmp(c->fail))
+        return -1;
+    c->cap = 0;
+    c->nslots = c->top = c->max = f->nslots;
+    if (f->nslots > MAX_REG)
+        fail(c, f->node, "fonksiyon cok buyuk (%u yazmac)", MAX_REG);
+    statement(c, c->nodes[f->node].b);
+    emit(c, f->node, OP_RET0, 0, 0, 0);
+    c->fn->nregs = c->max ? c->max : 1;
+    return 0;
+}
+
+/* ---- Makine ---- */
+
+struct turkc_vm *turkc_vm_new(const struct turkc_program *prog, FILE *out,
+                              struct turkc_parse_error *err)
+{
+    struct turkc_vm *vm = calloc(1, sizeof(*vm));
+    struct compiler c;
+    uint32_t i;
+
+    if (!vm)
+        goto nomem;
+    vm->prog = prog;
+    vm->out = out;
+    vm->funcs = calloc(prog->nfuncs ? prog->nfuncs : 1, sizeof(*vm->funcs));
+    vm->globals = malloc((prog->nglobals ? prog->nglobals : 1) * sizeof(int32_t));
+    vm->stack = malloc(TURKC_VM_STACK_SLOTS * sizeof(int32_t));
+    if (!vm->funcs || !vm->globals || !vm->stack)
+        goto nomem;
+    memcpy(vm->globals, prog->globals, prog->nglobals * sizeof(int32_t));
+    vm->end = vm->stack + TURKC_VM_STACK_SLOTS;
+    vm->ctx.globals = vm->globals;
+    vm->ctx.end = vm->end;
+
+    memset(&c, 0, sizeof(c));
+    c.prog = prog;
+    c.nodes = prog->ast->nodes;
+    c.err = err;
+    for (i = 0; i < prog->nfuncs; i++) {
+        c.fn = &vm->funcs[i];
+        if (compile(&c, i) != 0) {
+            turkc_vm_free(vm);
+            return NULL;
+        }
+    }
+    return vm;
+
+nomem:
+    if (err) {
+        snprintf(err->message, sizeof(err->message), "bellek yetersiz");
+        err->offset = err->line = err->column = 0;
+    }
+    turkc_vm_free(vm);
+    return NULL;
+}
+
+void turkc_vm_free(struct turkc_vm *vm)
+{
+    uint32_t i;
+
+    if (!vm)
+        return;
+    for (i = 0; vm->funcs && i < vm->prog->nfuncs; i++) {
+        turkc_jit_release(&vm->funcs[i]);
+        free(vm->funcs[i].code);
+        free(vm->funcs[i].offsets);
+    }
+    free(vm->funcs);
+    free(vm->globals);
+    free(vm->stack);
+    free(vm->frames);
+    free(vm);
+}
+
+const struct turkc_vm_func *turkc_vm_function(const struct turkc_vm *vm, uint32_t func)
+{
+    return &vm->funcs[func];
+}
+
+static int runtime_error(struct turkc_vm *vm, const struct turkc_vm_func *fn,
+                         const struct turkc_insn *pc, const char *msg,
+                         struct turkc_parse_error *err)
+{
+    if (err) {
+        snprintf(err->message, sizeof(err->message), "%s", msg);
+        err->offset = fn->offsets[pc - fn->code];
+        err->line = err->column = 0;
+    }
+    (void)vm;
+    return -1;
+}
+
+static int push_frame(struct turkc_vm *vm, uint32_t n)
+{
+    struct frame *f;
+    uint32_t cap;
+
+    if (n < vm->frame_cap)
+        return 0;
+    cap = vm->frame_cap ? vm->frame_cap * 2 : 256;
+    f = realloc(vm->frames, cap * sizeof(*f));
+    if (!f)
+        return -1;
+    vm->frames = f;
+    vm->frame_cap = cap;
+    return 0;
+}
+
+#define R(x)    base[pc->x]
+#define U(x)    ((uint32_t)base[pc->x])
+
+#ifdef THREADED
+#define OP(name)    op_##name:
+#define NEXT()      goto *(&&op_MOVE + pc->h)
+#else
+#define OP(name)    case OP_##name:
+#define NEXT()      goto dispatch
+#endif
+
+#define JUMP_IF(cond, to)   do { pc = (cond) ? code + (to) : pc + 1; NEXT(); } while (0)
+#define KTARGET             ((uint32_t)pc->b | (uint32_t)pc->c << 16)
+
+static int32_t jit_call(struct turkc_jit_ctx *ctx, uint32_t func, int32_t *regs);
+static void jit_yaz(struct turkc_jit_ctx *ctx, int32_t value);
+static void jit_yazs(struct turkc_jit_ctx *ctx, uint32_t sym);
+static void jit_fail(struct turkc_jit_ctx *ctx, uint32_t func, uint32_t insn, uint32_t error);
+
+static const struct turkc_jit_helpers helpers = { jit_call, jit_yaz, jit_yazs, jit_fail };
+
+/* Eşiğe ulaşan fonksiyonu derler; derlenmiş kodu veya NULL döner */
+static turkc_jit_fn hot(struct turkc_vm *vm, uint32_t func)
+{
+    struct turkc_vm_func *fn = &vm->funcs[func];
+
+    if (!fn->native && !fn->jit_failed && ++fn->calls >= vm->jit)
+        turkc_jit_compile(vm->funcs, func, &helpers);
+    return (turkc_jit_fn)fn->native;
+}
+
+/* funcs[func]'ı base çerçevesinde yorumlar; frame0 dış çalıştırmaların
+ * kullandığı çerçeve sayısıdır (derlenmiş koddan tekrar girildiğinde)
+ */
+static int run(struct turkc_vm *vm, uint32_t func, int32_t *base, uint32_t frame0,
+               int32_t *result, struct turkc_parse_error *err)
+{
+#ifdef THREADED
+    static const int32_t handlers[OP_COUNT] = {
+        [OP_MOVE] = &&op_MOVE - &&op_MOVE,     [OP_LOADK] = &&op_LOADK - &&op_MOVE,
+        [OP_GGET] = &&op_GGET - &&op_MOVE,     [OP_GSET] = &&op_GSET - &&op_MOVE,
+        [OP_ADD] = &&op_ADD - &&op_MOVE,       [OP_SUB] = &&op_SUB - &&op_MOVE,
+        [OP_MUL] = &&op_MUL - &&op_MOVE,       [OP_DIV] = &&op_DIV - &&op_MOVE,
+        [OP_MOD] = &&op_MOD - &&op_MOVE,       [OP_EQ] = &&op_EQ - &&op_MOVE,
+        [OP_NE] = &&op_NE - &&op_MOVE,         [OP_LT] = &&op_LT - &&op_MOVE,
+        [OP_GT] = &&op_GT - &&op_MOVE,         [OP_LE] = &&op_LE - &&op_MOVE,
+        [OP_GE] = &&op_GE - &&op_MOVE,         [OP_NEG] = &&op_NEG - &&op_MOVE,
+        [OP_ADDK] = &&op_ADDK - &&op_MOVE,     [OP_JMP] = &&op_JMP - &&op_MOVE,
+        [OP_JZ] = &&op_JZ - &&op_MOVE,         [OP_JNZ] = &&op_JNZ - &&op_MOVE,
+        [OP_JEQ] = &&op_JEQ - &&op_MOVE,       [OP_JNE] = &&op_JNE - &&op_MOVE,
+        [OP_JLT] = &&op_JLT - &&op_MOVE,       [OP_JGT] = &&op_JGT - &&op_MOVE,
+        [OP_JLE] = &&op_JLE - &&op_MOVE,       [OP_JGE] = &&op_JGE - &&op_MOVE,
+        [OP_JEQK] = &&op_JEQK - &&op_MOVE,     [OP_JNEK] = &&op_JNEK - &&op_MOVE,
+        [OP_JLTK] = &&op_JLTK - &&op_MOVE,     [OP_JGTK] = &&op_JGTK - &&op_MOVE,
+        [OP_JLEK] = &&op_JLEK - &&op_MOVE,     [OP_JGEK] = &&op_JGEK - &&op_MOVE,
+        [OP_CALL] = &&op_CALL - &&op_MOVE,     [OP_YAZ] = &&op_YAZ - &&op_MOVE,
+        [OP_YAZS] = &&op_YAZS - &&op_MOVE,     [OP_RET] = &&op_RET - &&op_MOVE,
+        [OP_RET0] = &&op_RET0 - &&op_MOVE,
+    };
+#endif
+    const struct turkc_vm_func *fn = &vm->funcs[func], *callee;
+    const struct turkc_insn *pc, *code;
+    int32_t *globals = vm->globals, v;
+    uint32_t nframes = frame0, i, j;
+    turkc_jit_fn native;
+    const char *text;
+    size_t len;
+    char mark;                          /* C yığınının buradaki adresi */
+
+#ifdef THREADED
+    /* ilk çağrıda her komuta işleyicisinin ofseti yazılır */
+    if (!vm->threaded) {
+        for (i = 0; i < vm->prog->nfuncs; i++) {
+            for (j = 0; j < vm->funcs[i].ncode; j++)
+                vm->funcs[i].code[j].h = handlers[vm->funcs[i].code[j].op];
+        }
+        vm->threaded = 1;
+    }
+#else
+    (void)i;
+    (void)j;
+#endif
+    code = pc = fn->code;
+
+#ifdef THREADED
+    NEXT();
+#else
+dispatch:
+    switch (pc->op) {
+#endif
+    OP(MOVE)  R(a) = R(b); pc++; NEXT();
+    OP(LOADK) R(a) = pc->k; pc++; NEXT();
+    OP(GGET)  R(a) = globals[pc->k]; pc++; NEXT();
+    OP(GSET)  globals[pc->k] = R(a); pc++; NEXT();
+    OP(ADD)   R(a) = (int32_t)(U(b) + U(c)); pc++; NEXT();
+    OP(SUB)   R(a) = (int32_t)(U(b) - U(c)); pc++; NEXT();
+    OP(MUL)   R(a) = (int32_t)(U(b) * U(c)); pc++; NEXT();
+    OP(DIV)
+        if (R(c) == 0)
+            return runtime_error(vm, fn, pc, "sifira bolme", err);
+        R(a) = turkc_binop(TK_SLASH, R(b), R(c));
+        pc++;
+        NEXT();
+    OP(MOD)
+        if (R(c) == 0)
+            return runtime_error(vm, fn, pc, "sifira bolme", err);
+        R(a) = turkc_binop(TK_PERCENT, R(b), R(c));
+        pc++;
+        NEXT();
+    OP(EQ)    R(a) = R(b) == R(c); pc++; NEXT();
+    OP(NE)    R(a) = R(b) != R(c); pc++; NEXT();
+    OP(LT)    R(a) = R(b) < R(c); pc++; NEXT();
+    OP(GT)    R(a) = R(b) > R(c); pc++; NEXT();
+    OP(LE)    R(a) = R(b) <= R(c); pc++; NEXT();
+    OP(GE)    R(a) = R(b) >= R(c); pc++; NEXT();
+    OP(NEG)   R(a) = (int32_t)(0u - U(b)); pc++; NEXT();
+    OP(ADDK)  R(a) = (int32_t)(U(b) + (uint32_t)pc->k); pc++; NEXT();
+    OP(JMP)   pc = code + pc->k; NEXT();
+    OP(JZ)    JUMP_IF(R(a) == 0, pc->k);
+    OP(JNZ)   JUMP_IF(R(a) != 0, pc->k);
+    OP(JEQ)   JUMP_IF(R(a) == R(b), pc->k);
+    OP(JNE)   JUMP_IF(R(a) != R(b), pc->k);
+    OP(JLT)   JUMP_IF(R(a) < R(b), pc->k);
+    OP(JGT)   JUMP_IF(R(a) > R(b), pc->k);
+    OP(JLE)   JUMP_IF(R(a) <= R(b), pc->k);
+    OP(JGE)   JUMP_IF(R(a) >= R(b), pc->k);
+    OP(JEQK)  JUMP_IF(R(a) == pc->k, KTARGET);
+    OP(JNEK)  JUMP_IF(R(a) != pc->k, KTARGET);
+    OP(JLTK)  JUMP_IF(R(a) < pc->k, KTARGET);
+    OP(JGTK)  JUMP_IF(R(a) > pc->k, KTARGET);
+    OP(JLEK)  JUMP_IF(R(a) <= pc->k, KTARGET);
+    OP(JGEK)  JUMP_IF(R(a) >= pc->k, KTARGET);
+    OP(CALL)
+        callee = &vm->funcs[pc->k];
+        if ((uint32_t)(vm->end - (base + pc->b)) < callee->nregs)
+            return runtime_error(vm, fn, pc, "yigin tasmasi", err);
+        /* derlenmiş koddaki çağrılar da aynı sayaçtan düşer */
+        if (vm->ctx.calls_left == 0)
+            return runtime_error(vm, fn, pc, "cok derin ozyineleme", err);
+        if (vm->jit && (native = hot(vm, (uint32_t)pc->k)) != NULL) {
+            /* derlenmiş kod ile yorumlanan arasındaki her geçiş C yığınında */
+            if ((uintptr_t)&mark < vm->ctx.stack_limit)
+                return runtime_error(vm, fn, pc, "cok derin ozyineleme", err);
+            vm->nframes = nframes;
+            vm->ctx.calls_left--;
+            R(a) = native(base + pc->b, &vm->ctx);
+            vm->ctx.calls_left++;
+            pc++;
+            NEXT();
+        }
+        if (push_frame(vm, nframes) != 0)
+            return runtime_error(vm, fn, pc, "bellek yetersiz", err);
+        vm->ctx.calls_left--;
+        vm->frames[nframes].pc = pc;
+        vm->frames[nframes].fn = fn;
+        vm->frames[nframes].base = base;
+        nframes++;
+        base += pc->b;
+        fn = callee;
+        code = pc = fn->code;
+        NEXT();
+    OP(YAZ)
+        fprintf(vm->out, "%ld\n", (long)R(a));
+        pc++;
+        NEXT();
+    OP(YAZS)
+        text = turkc_intern_text(vm->prog->ast->syms, (uint32_t)pc->k, &len);
+        fwrite(text + 1, 1, len - 2, vm->out);      /* tırnaklar hariç */
+        fputc('\n', vm->out);
+        pc++;
+        NEXT();
+    OP(RET)
+        v = R(a);
+        goto ret;
+    OP(RET0)
+        v = 0;
+    ret:
+        if (nframes == frame0) {
+            if (result)
+                *result = v;
+            return 0;
+        }
+        nframes--;
+        vm->ctx.calls_left++;
+        pc = vm->frames[nframes].pc;
+        fn = vm->frames[nframes].fn;
+        base = vm->frames[nframes].base;
+        code = fn->code;
+        R(a) = v;
+        pc++;
+        NEXT();
+#ifndef THREADED
+    }
+    return runtime_error(vm, fn, pc, "gecersiz komut", err);
+#endif
+}
+
+/* ---- JIT yardımcıları: derlenmiş koddan çağrılır ---- */
+
+static int32_t jit_call(struct turkc_jit_ctx *ctx, uint32_t func, int32_t *regs)
+{
+    struct turkc_vm *vm = (struct turkc_vm *)ctx;
+    const struct turkc_vm_func *fn = &vm->funcs[func];
+    turkc_jit_fn native;
+    int32_t v = 0;
+
+    if ((uint32_t)(vm->end - regs) < fn->nregs) {
+        runtime_error(vm, fn, fn->code, "yigin tasmasi", vm->err);
+        longjmp(vm->fail, 1);
+    }
+    /* çağrı sayısı çağrı yerinde denetlendi; bu C yığını yedeği */
+    if ((uintptr_t)&v < ctx->stack_limit) {
+        runtime_error(vm, fn, fn->code, "cok derin ozyineleme", vm->err);
+        longjmp(vm->fail, 1);
+    }
+    if ((native = hot(vm, func)) != NULL)
+        return native(regs, ctx);
+    if (run(vm, func, regs, vm->nframes, &v, vm->err) != 0)
+        longjmp(vm->fail, 1);
+    return v;
+}
+
+static void jit_yaz(struct turkc_jit_ctx *ctx, int32_t value)
+{
+    fprintf(((struct turkc_vm *)ctx)->out, "%ld\n", (long)value);
+}
+
+static void jit_yazs(struct turkc_jit_ctx *ctx, uint32_t sym)
+{
+    struct turkc_vm *vm = (struct turkc_vm *)ctx;
+    const char *text;
+    size_t len;
+
+    text = turkc_intern_text(vm->prog->ast->syms, sym, &len);
+    fwrite(text + 1, 1, len - 2, vm->out);
+    fputc('\n', vm->out);
+}
+
+static void jit_fail(struct turkc_jit_ctx *ctx, uint32_t func, uint32_t insn, uint32_t error)
+{
+    static const char *const messages[] = {
+        [TURKC_JIT_DIV0] = "sifira bolme",
+        [TURKC_JIT_DEEP] = "cok derin ozyineleme",
+        [TURKC_JIT_STACK] = "yigin tasmasi",
+    };
+    struct turkc_vm *vm = (struct turkc_vm *)ctx;
+    struct turkc_parse_error *err = vm->err;
+
+    runtime_error(vm, &vm->funcs[func], &vm->funcs[func].code[insn], messages[error], err);
+    longjmp(vm->fail, 1);
+}
+
+void turkc_vm_set_jit(struct turkc_vm *vm, uint32_t threshold)
+{
+    vm->jit = turkc_jit_supported() ? threshold : 0;
+}
+
+struct vm_call {
+    struct turkc_vm *vm;
+    uint32_t func;
+    int32_t *result;
+    struct turkc_parse_error *err;
+    int rc;
+};
+
+/* JIT açıkken turkc_stack_run'ın açtığı yığında */
+static void vm_main(void *arg, size_t limit)
+{
+    struct vm_call *c = arg;
+    struct turkc_vm *vm = c->vm;
+    turkc_jit_fn native;
+    int32_t v;
+
+    /* derlenmiş koddaki hatalar longjmp ile döner */
+    vm->err = c->err;
+    vm->nframes = 0;
+    vm->ctx.stack_limit = (uintptr_t)&v - limit;
+    c->rc = -1;
+    if (setjmp(vm->fail))
+        return;
+    if ((native = hot(vm, c->func)) == NULL) {
+        c->rc = run(vm, c->func, vm->stack, 0, c->result, c->err);
+        return;
+    }
+    v = native(vm->stack, &vm->ctx);
+    if (c->result)
+        *c->result = v;
+    c->rc = 0;
+}
+
+int turkc_vm_call(struct turkc_vm *vm, uint32_t func, const int32_t *args,
+                  int32_t *result, struct turkc_parse_error *err)
+{
+    const struct turkc_vm_func *fn = &vm->funcs[func];
+    struct vm_call c;
+
+    if ((uint32_t)(vm->end - vm->stack) < fn->nregs)
+        return runtime_error(vm, fn, fn->code, "yigin tasmasi", err);
+    if (vm->prog->funcs[func].nparams)
+        memcpy(vm->stack, args, vm->prog->funcs[func].nparams * sizeof(int32_t));
+    vm->ctx.calls_left = TURKC_MAX_CALL_DEPTH - 1;     /* ana etkin */
+    if (!vm->jit)
+        return run(vm, func, vm->stack, 0, result, err);
+
+    /* derlenmiş kod C yığınında özyineler */
+    c.vm = vm;
+    c.func = func;
+    c.result = result;
+    c.err = err;
+    turkc_stack_run(vm_main, &c);
+    return c.rc;
+}
+
+void turkc_vm_dump(const struct turkc_vm *vm, FILE *out)
+{
+    const struct turkc_vm_func *fn;
+    const struct turkc_insn *in;
+    uint32_t i, j;
+
+    for (i = 0; i < vm->prog->nfuncs; i++) {
+        fn = &vm->funcs[i];
+        fprintf(out, "%s: %lu yazmac, %lu komut\n",
+                turkc_ast_symbol(vm->prog->ast, vm->prog->funcs[i].name),
+                (unsigned long)fn->nregs, (unsigned long)fn->ncode);
+        for (j = 0; j < fn->ncode; j++) {
+            in = &fn->code[j];
+            fprintf(out, "  %4lu  %-6s", (unsigned long)j, turkc_opcode_name(in->op));
+            switch (in->op) {
+            case OP_MOVE:
+            case OP_NEG:
+                fprintf(out, " r%u, r%u", in->a, in->b);
+                break;
+            case OP_LOADK:
+            case OP_GGET:
+                fprintf(out, " r%u, %ld", in->a, (long)in->k);
+                break;
+            case OP_GSET:
+                fprintf(out, " g%ld, r%u", (long)in->k, in->a);
+                break;
+            case OP_ADDK:
+                fprintf(out, " r%u, r%u, %ld", in->a, in->b, (long)in->k);
+                break;
+            case OP_JMP:
+                fprintf(out, " %ld", (long)in->k);
+                break;
+            case OP_JZ:
+            case OP_JNZ:
+                fprintf(out, " r%u, %ld", in->a, (long)in->k);
+                break;
+            case OP_CALL:
+                fprintf(out, " r%u, %s(r%u...)", in->a,
+                        turkc_ast_symbol(vm->prog->ast, vm->prog->funcs[in->k].name), in->b);
+                break;
+            case OP_YAZ:
+            case OP_RET:
+                fprintf(out, " r%u", in->a);
+                break;
+            case OP_YAZS:
+                fprintf(out, " %s", turkc_ast_symbol(vm->prog->ast, (uint32_t)in->k));
+                break;
+            case OP_RET0:
+                break;
+            default:
+                if (in->op >= OP_JEQ && in->op <= OP_JGE)
+                    fprintf(out, " r%u, r%u, %ld", in->a, in->b, (long)in->k);
+                else if (in->op >= OP_JEQK && in->op <= OP_JGEK)
+                    fprintf(out, " r%u, %ld, %lu", in->a, (long)in->k,
+                            (unsigned long)((uint32_t)in->b | (uint32_t)in->c << 16));
+                else
+                    fprintf(out, " r%u, r%u, r%u", in->a, in->b, in->c);
+            }
+            fputc('\n', out);
+        }
+    }
+}
@@ -0,0 +1,116 @@
+#ifndef TURKC_VM_H
+#define TURKC_VM_H
+
+/* Yazmaç tabanlı bytecode ve sanal makine.
+ *
+ * turkc_vm_new çözümlenmiş programın (turkc_resolve.h) her fonksiyonunu
+ * bytecode'a derler. Yazmaçlar fonksiyonun çerçevesidir: önce yerel
+ * değişken slotları (parametreler dahil), sonra ifade ara değerleri.
+ * Değişken okuyan işlem doğrudan değişkenin yazmacını kullanır, atama
+ * sonucu doğrudan değişkenin yazmacına yazar; MOVE sadece gerektiğinde
+ * üretilir.
+ *
+ * Çağrılar C yığınını kullanmaz: argümanlar çağıranın en üst yazmaçlarına
+ * yazılır ve çağrılanın çerçevesi orada başlar (parametreler = argümanlar).
+ * Derinlik TURKC_MAX_CALL_DEPTH çağrıyla sınırlıdır (turkc_stack.h).
+ *
+ * GCC/Clang'da dağıtım doğrudan threading'dir (computed goto): her komut
+ * işleyicisinin adresini (bir etikete göre ofset) taşır ve bir sonraki
+ * komuta tablo araması olmadan atlanır. Diğer derleyicilerde switch.
+ *
+ * turkc_vm_set_jit ile eşiği aşan fonksiyonlar makine koduna derlenir
+ * (turkc_jit.h); derlenemeyenler yorumlanmaya devam eder.
+ *
+ * Anlam turkc_interp ile aynıdır (bkz. spesifikasyon.md).
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "turkc_parse.h"
+#include "turkc_resolve.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TURKC_VM_STACK_SLOTS    (1u << 20)      /* yazmaç yığını, 4 MB */
+
+/* Komutlar. r: yazmaç, k: 32 bit sabit, L: komut indeksi (fonksiyon içi).
+ * "(süper)" olanlar sık görülen iki komutun birleşimidir.
+ */
+enum turkc_opcode {
+    OP_MOVE,        /* ra = rb */
+    OP_LOADK,       /* ra = k */
+    OP_GGET,        /* ra = global[k] */
+    OP_GSET,        /* global[k] = ra */
+    OP_ADD, OP_SUB, OP_MUL, OP_DIV, OP_MOD,     /* ra = rb op rc */
+    OP_EQ, OP_NE, OP_LT, OP_GT, OP_LE, OP_GE,   /* ra = rb op rc (0/1) */
+    OP_NEG,         /* ra = -rb */
+    OP_ADDK,        /* ra = rb + k (süper: i = i + 1, i - 1 de buna) */
+    OP_JMP,         /* L = k */
+    OP_JZ,          /* ra == 0 ise L = k */
+    OP_JNZ,         /* ra != 0 ise L = k */
+    OP_JEQ, OP_JNE, OP_JLT, OP_JGT, OP_JLE, OP_JGE,         /* ra op rb ise L = k (süper) */
+    OP_JEQK, OP_JNEK, OP_JLTK, OP_JGTK, OP_JLEK, OP_JGEK,   /* ra op k ise L = b | c << 16 (süper) */
+    OP_CALL,        /* ra = funcs[k](rb, rb+1, ...) */
+    OP_YAZ,         /* yaz(ra) */
+    OP_YAZS,        /* yaz(string sembolü k) */
+    OP_RET,         /* ra'yı döndür */
+    OP_RET0,        /* 0 döndür */
+
+    OP_COUNT
+};
+
+/* 16 byte */
+struct turkc_insn {
+    int32_t h;              /* doğrudan threading: işleyici ofseti (VM doldurur) */
+    uint8_t op;
+    uint8_t pad;
+    uint16_t a, b, c;
+    int32_t k;
+};
+
+struct turkc_vm_func {
+    struct turkc_insn *code;
+    uint32_t *offsets;      /* komut başına kaynak ofseti (hata konumu için) */
+    uint32_t ncode;
+    uint32_t nregs;         /* en az 1 */
+
+    /* JIT: native NULL ise yorumlanır */
+    void *native;
+    uint32_t native_size;   /* makine kodu, byte */
+    uint32_t calls;         /* eşiğe kadar sayılan çağrılar */
+    int jit_failed;         /* derlenemedi, tekrar denenmez */
+    double jit_seconds;     /* derleme süresi */
+};
+
+struct turkc_vm;
+
+/* Programı derler. Hata (bellek, çok büyük fonksiyon) olursa NULL ve err. */
+struct turkc_vm *turkc_vm_new(const struct turkc_program *prog, FILE *out,
+                              struct turkc_parse_error *err);
+void turkc_vm_free(struct turkc_vm *vm);
+
+/* Bir fonksiyon threshold kez çağrılınca makine koduna derlenir; 0 JIT'i
+ * kapatır (varsayılan). Platform desteklemiyorsa etkisizdir.
+ */
+void turkc_vm_set_jit(struct turkc_vm *vm, uint32_t threshold);
+
+/* turkc_interp_call gibi */
+int turkc_vm_call(struct turkc_vm *vm, uint32_t func, const int32_t *args,
+                  int32_t *result, struct turkc_parse_error *err);
+
+/* Derlenmiş fonksiyon; dökme ve istatistik için */
+const struct turkc_vm_func *turkc_vm_function(const struct turkc_vm *vm, uint32_t func);
+
+const char *turkc_opcode_name(int op);
+
+/* Tüm fonksiyonların bytecode dökümü */
+void turkc_vm_dump(const struct turkc_vm *vm, FILE *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,1306 @@
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "turkc_regalloc.h"
+#include "turkc_stack.h"
+#include "turkc_token.h"
+#include "turkc_x86.h"
+
+/* Çalışma hatası: fonksiyon sonunda üretilen ve tc_fail'e atlayan kod */
+struct stub {
+    unsigned label;
+    unsigned long line, column;
+    const char *msg;            /* .rodata etiketi */
+};
+
+/* Paralel atamanın bir elemanı: işlenen metinleri */
+struct move {
+    char dst[32], src[32];
+};
+
+/* Phi atamaları gereken dal kenarı: fonksiyon sonunda üretilir */
+struct edge {
+    unsigned label;
+    uint32_t from, to;
+};
+
+struct gen {
+    const struct turkc_program *prog;
+    const struct turkc_node *nodes;
+    FILE *out;
+    const char *buf;
+    size_t len;
+    size_t pos;                 /* locate: son ofset ve satır/sütun */
+    unsigned long line, line_start;
+    unsigned label;             /* sonraki .L etiketi */
+    unsigned depth;             /* çerçevenin üstüne itilmiş 8 byte'lık değerler */
+    long left;                  /* kalan çağrı sayısının yeri, rbp'ye göre */
+    struct stub *stubs;
+    size_t nstubs, cap;
+    struct turkc_parse_error *err;
+    jmp_buf fail;
+
+    /* IR'dan üretim */
+    struct turkc_ir *ir;
+    struct turkc_ir_func *f;
+    struct turkc_ra ra;
+    int nregs;
+    unsigned blocks;            /* b bloğunun etiketi blocks + b */
+    unsigned ret;
+    unsigned saved;             /* itilen çağrıda korunan yazmaçlar */
+    struct move *moves;
+    size_t nmoves, mcap;
+    struct edge *edges;
+    size_t nedges, ecap;
+    struct turkc_x86_stats stats;
+};
+
+static const char *const arg_regs[6] = { "edi", "esi", "edx", "ecx", "r8d", "r9d" };
+static const char *const arg_regs64[6] = { "rdi", "rsi", "rdx", "rcx", "r8", "r9" };
+
+/* turkc_regalloc.h'taki sırayla */
+static const char *const ra_regs[TURKC_RA_REGS] = {
+    "ebx", "r12d", "r13d", "r14d", "r15d", "esi", "edi", "r8d", "r9d", "r10d", "r11d"
+};
+static const char *const ra_regs64[TURKC_RA_REGS] = {
+    "rbx", "r12", "r13", "r14", "r15", "rsi", "rdi", "r8", "r9", "r10", "r11"
+};
+
+static void fail(struct gen *g, uint32_t node, const char *fmt, ...)
+{
+    va_list ap;
+
+    if (g->err) {
+        va_start(ap, fmt);
+        vsnprintf(g->err->message, sizeof(g->err->message), fmt, ap);
+        va_end(ap);
+        g->err->offset = g->nodes[node].offset;
+        g->err->line = 0;
+        g->err->column = 0;
+    }
+    longjmp(g->fail, 1);
+}
+
+/* Girintili bir komut satırı */
+static void put(struct gen *g, const char *fmt, ...)
+{
+    va_list ap;
+
+    fputs("    ", g->out);
+    va_start(ap, fmt);
+    vfprintf(g->out, fmt, ap);
+    va_end(ap);
+    fputc('\n', g->out);
+}
+
+static unsigned new_label(struct gen *g)
+{
+    return g->label++;
+}
+
+static void place(struct gen *g, unsigned label)
+{
+    fprintf(g->out, ".L%u:\n", label);
+}
+
+/* Düğümün satır ve sütunu (turkc_parse_locate gibi). Ofsetler çoğunlukla
+ * artarak geldiği için tarama son konumdan devam eder.
+ */
+static void locate(struct gen *g, uint32_t node, unsigned long *line, unsigned long *column)
+{
+    size_t end = g->nodes[node].offset < g->len ? g->nodes[node].offset : g->len;
+
+    if (end < g->pos) {
+        g->pos = 0;
+        g->line = 1;
+        g->line_start = 0;
+    }
+    for (; g->pos < end; g->pos++) {
+        if (g->buf[g->pos] == '\n') {
+            g->line++;
+            g->line_start = g->pos + 1;
+        }
+    }
+    *line = g->line;
+    *column = (unsigned long)(end - g->line_start + 1);
+}
+
+/* Dizinin en az n elemanlık yeri olsun */
+static void *grow(struct gen *g, void *p, size_t *cap, size_t n, size_t size)
+{
+    size_t c = *cap ? *cap : 16;
+
+    if (n <= *cap)
+        return p;
+    while (c < n)
+        c *= 2;
+    if (!(p = realloc(p, c * size)))
+        fail(g, 0, "bellek yetersiz");
+    *cap = c;
+    return p;
+}
+
+/* node'da msg hatasına giden etiket */
+static unsigned stub(struct gen *g, uint32_t node, const char *msg)
+{
+    struct stub *s;
+
+    g->stubs = grow(g, g->stubs, &g->cap, g->nstubs + 1, sizeof(*g->stubs));
+    s = &g->stubs[g->nstubs++];
+    s->label = new_label(g);
+    s->msg = msg;
+    locate(g, node, &s->line, &s->column);
+    return s->label;
+}
+
+static void push(struct gen *g)
+{
+    put(g, "pushq %%rax");
+    g->depth++;
+}
+
+static void pop(struct gen *g, const char *reg)
+{
+    put(g, "popq %%%s", reg);
+    g->depth--;
+}
+
+/* Sabit veya değişken ise komut işleneni ("$5", "-8(%rbp)"), değilse NULL */
+static const char *operand(struct gen *g, uint32_t i, char *buf, size_t size)
+{
+    const struct turkc_node *n = &g->nodes[i];
+
+    if (n->kind == ND_NUMBER)
+        snprintf(buf, size, "$%ld", (long)(int32_t)n->a);
+    else if (n->kind == ND_NAME && (n->flags & TURKC_NF_GLOBAL))
+        snprintf(buf, size, "tc_g%lu(%%rip)", (unsigned long)n->aux);
+    else if (n->kind == ND_NAME)
+        snprintf(buf, size, "%ld(%%rbp)", -4L * ((long)n->aux + 1));
+    else
+        return NULL;
+    return buf;
+}
+
+/* Sol işlenen sağdan sonra okunabilir mi: sabit veya sağda atanmayan yerel */
+static int reorderable(struct gen *g, uint32_t a, uint32_t b)
+{
+    const struct turkc_node *n = &g->nodes[a];
+
+    if (n->kind == ND_NUMBER)
+        return 1;
+    return n->kind == ND_NAME && !(n->flags & TURKC_NF_GLOBAL) &&
+           !(g->nodes[b].flags & TURKC_NF_ASSIGNS);
+}
+
+static int is_compare(int tk)
+{
+    return tk >= TK_EQ && tk <= TK_GE;
+}
+
+static int negate(int tk)
+{
+    switch (tk) {
+    case TK_EQ: return TK_NE;
+    case TK_NE: return TK_EQ;
+    case TK_LT: return TK_GE;
+    case TK_GT: return TK_LE;
+    case TK_LE: return TK_GT;
+    default:    return TK_LT;
+    }
+}
+
+static int mirror(int tk)
+{
+    switch (tk) {
+    case TK_LT: return TK_GT;
+    case TK_GT: return TK_LT;
+    case TK_LE: return TK_GE;
+    case TK_GE: return TK_LE;
+    default:    return tk;
+    }
+}
+
+/* İşaretli karşılaştırmanın koşul kodu: jl, setge, ... */
+static const char *cc(int tk)
+{
+    switch (tk) {
+    case TK_EQ: return "e";
+    case TK_NE: return "ne";
+    case TK_LT: return "l";
+    case TK_GT: return "g";
+    case TK_LE: return "le";
+    default:    return "ge";
+    }
+}
+
+static void expr(struct gen *g, uint32_t i);
+
+/* İkili işlemin işlenenleri: sol eax'te; sağ *rhs'de işlenen olarak ya da
+ * ecx'te. Sıra değiştiyse (sağ eax'te, sol *rhs'de) 1 döner. ready ise sol
+ * zaten eax'tedir (sola bağlı zincirin üst düğümleri, bkz. expr).
+ */
+static int operands(struct gen *g, uint32_t i, const char **rhs, char *buf, size_t size,
+                    int swap, int ready)
+{
+    const struct turkc_node *n = &g->nodes[i];
+
+    if ((*rhs = operand(g, n->b, buf, size)) != NULL) {
+        if (!ready)
+            expr(g, n->a);
+        return 0;
+    }
+    if (swap && !ready && reorderable(g, n->a, n->b)) {
+        expr(g, n->b);
+        *rhs = operand(g, n->a, buf, size);
+        return 1;
+    }
+    if (!ready)
+        expr(g, n->a);
+    push(g);
+    expr(g, n->b);
+    put(g, "movl %%eax, %%ecx");
+    pop(g, "rax");
+    *rhs = "%ecx";
+    return 0;
+}
+
+/* cmp'yi üretir, bayraklar için geçerli operatörü döner */
+static int compare(struct gen *g, uint32_t i, int ready)
+{
+    const char *rhs;
+    char buf[32];
+    int tk = g->nodes[i].op;
+
+    if (operands(g, i, &rhs, buf, sizeof(buf), 1, ready))
+        tk = mirror(tk);
+    put(g, "cmpl %s, %%eax", rhs);
+    return tk;
+}
+
+/* eax = eax / rhs veya eax % rhs; INT32_MIN / -1 sarar (turkc_binop) */
+static void divide(struct gen *g, uint32_t i, int ready)
+{
+    const struct turkc_node *n = &g->nodes[i], *b = &g->nodes[n->b];
+    int mod = n->op == TK_PERCENT;
+    unsigned zero, minus, done;
+    const char *rhs;
+    char buf[32];
+
+    operands(g, i, &rhs, buf, sizeof(buf), 0, ready);
+    if (b->kind == ND_NUMBER) {
+        if ((int32_t)b->a == 0) {
+            put(g, "jmp .L%u", stub(g, i, "tc_div0"));
+        } else if ((int32_t)b->a == -1) {
+            put(g, mod ? "xorl %%eax, %%eax" : "negl %%eax");
+        } else {
+            put(g, "movl %s, %%ecx", rhs);
+            put(g, "cltd");
+            put(g, "idivl %%ecx");
+            if (mod)
+                put(g, "movl %%edx, %%eax");
+        }
+        return;
+    }
+    if (strcmp(rhs, "%ecx") != 0)
+        put(g, "movl %s, %%ecx", rhs);
+    zero = stub(g, i, "tc_div0");
+    minus = new_label(g);
+    done = new_label(g);
+    put(g, "testl %%ecx, %%ecx");
+    put(g, "je .L%u", zero);
+    put(g, "cmpl $-1, %%ecx");
+    put(g, "je .L%u", minus);
+    put(g, "cltd");
+    put(g, "idivl %%ecx");
+    if (mod)
+        put(g, "movl %%edx, %%eax");
+    put(g, "jmp .L%u", done);
+    place(g, minus);
+    put(g, mod ? "xorl %%eax, %%eax" : "negl %%eax");
+    place(g, done);
+}
+
+static void binary(struct gen *g, uint32_t i, int ready)
+{
+    const struct turkc_node *n = &g->nodes[i];
+    const char *rhs;
+    char buf[32];
+    int swapped;
+
+    if (is_compare(n->op)) {
+        put(g, "set%s %%al", cc(compare(g, i, ready)));
+        put(g, "movzbl %%al, %%eax");
+        return;
+    }
+    switch (n->op) {
+    case TK_SLASH:
+    case TK_PERCENT:
+        divide(g, i, ready);
+        return;
+    case TK_PLUS:
+        operands(g, i, &rhs, buf, sizeof(buf), 1, ready);
+        put(g, "addl %s, %%eax", rhs);
+        return;
+    case TK_STAR:
+        operands(g, i, &rhs, buf, sizeof(buf), 1, ready);
+        put(g, "imull %s, %%eax", rhs);
+        return;
+    case TK_MINUS:
+        swapped = operands(g, i, &rhs, buf, sizeof(buf), 1, ready);
+        if (swapped) {
+            put(g, "negl %%eax");
+            put(g, "addl %s, %%eax", rhs);
+        } else {
+            put(g, "subl %s, %%eax", rhs);
+        }
+        return;
+    }
+    fail(g, i, "beklenmeyen operator");
+}
+
+/* Argümanlar yerindeyken çağrı. Kalan çağrı sayısı bir düşürülüp r11d'de
+ * geçer, çağrılan onu çerçevesine yazar; sayı biterse veya yığın
+ * tc_stack_limit'e inerse hata bu çağrının konumundadır.
+ */
+static void emit_call(struct gen *g, uint32_t node, const char *name)
+{
+    unsigned deep = stub(g, node, "tc_deep");
+
+    put(g, "movl %ld(%%rbp), %%r11d", g->left);
+    put(g, "subl $1, %%r11d");
+    put(g, "jb .L%u", deep);
+    put(g, "cmpq tc_stack_limit(%%rip), %%rsp");
+    put(g, "jb .L%u", deep);
+    put(g, "call tc_%s", name);
+}
+
+/* call'dan önce yığını 16 byte'a hizalar; eklenen byte sayısını döner */
+static unsigned align_call(struct gen *g)
+{
+    if (g->depth % 2 == 0)
+        return 0;
+    put(g, "subq $8, %%rsp");
+    return 8;
+}
+
+static void yaz(struct gen *g, uint32_t arg)
+{
+    const struct turkc_node *n = &g->nodes[arg];
+    unsigned pad;
+
+    if (n->kind == ND_STRING) {
+        put(g, "leaq tc_s%lu(%%rip), %%rdi", (unsigned long)arg);
+        pad = align_call(g);
+        put(g, "call puts@PLT");
+    } else {
+        expr(g, arg);
+        put(g, "movl %%eax, %%esi");
+        put(g, "leaq tc_fmt(%%rip), %%rdi");
+        put(g, "xorl %%eax, %%eax");
+        pad = align_call(g);
+        put(g, "call printf@PLT");
+    }
+    if (pad)
+        put(g, "addq $%u, %%rsp", pad);
+}
+
+/* Argümanlar soldan sağa hesaplanır. Altıya kadar: sonuncusu dışındakiler
+ * yığına itilir ve çağrıdan önce yazmaçlara alınır. Daha fazlası: hepsi
+ * itilir, fazlası System V sırasıyla yığının tepesine kopyalanır.
+ */
+static void call(struct gen *g, uint32_t i)
+{
+    const struct turkc_node *n = &g->nodes[i];
+    const struct turkc_function *f;
+    const char *name;
+    uint32_t args[6], arg;
+    unsigned k, nargs = 0, leaves = 1, extra, pad, room;
+    char buf[32];
+
+    if (n->aux == TURKC_FUNC_YAZ) {
+        yaz(g, n->b);
+        return;
+    }
+    f = &g->prog->funcs[n->aux];
+    name = turkc_ast_symbol(g->prog->ast, f->name);
+    for (arg = n->b; arg; arg = g->nodes[arg].next) {
+        if (nargs < 6)
+            args[nargs] = arg;
+        nargs++;
+        if (!operand(g, arg, buf, sizeof(buf)))
+            leaves = 0;
+    }
+
+    if (nargs <= 6) {
+        if (leaves) {
+            for (k = 0; k < nargs; k++)
+                put(g, "movl %s, %%%s", operand(g, args[k], buf, sizeof(buf)), arg_regs[k]);
+        } else {
+            for (k = 0; k + 1 < nargs; k++) {
+                expr(g, args[k]);
+                push(g);
+            }
+            expr(g, args[nargs - 1]);
+            put(g, "movl %%eax, %%%s", arg_regs[nargs - 1]);
+            for (k = nargs - 1; k-- > 0;)
+                pop(g, arg_regs64[k]);
+        }
+        pad = align_call(g);
+        emit_call(g, i, name);
+        if (pad)
+            put(g, "addq $%u, %%rsp", pad);
+        return;
+    }
+
+    for (arg = n->b; arg; arg = g->nodes[arg].next) {
+        expr(g, arg);
+        push(g);
+    }
+    /* args[k], rsp + 8 * (nargs - 1 - k)'da; fazlası için yer aç */
+    extra = nargs - 6;
+    pad = (g->depth + extra) % 2;
+    room = 8 * (extra + pad);
+    put(g, "subq $%u, %%rsp", room);
+    for (k = 0; k < extra; k++) {
+        put(g, "movl %u(%%rsp), %%eax", room + 8 * (nargs - 1 - (6 + k)));
+        put(g, "movl %%eax, %u(%%rsp)", 8 * k);
+    }
+    for (k = 0; k < 6; k++)
+        put(g, "movl %u(%%rsp), %%%s", room + 8 * (nargs - 1 - k), arg_regs[k]);
+    emit_call(g, i, name);
+    put(g, "addq $%u, %%rsp", room + 8 * nargs);
+    g->depth -= nargs;
+}
+
+/* Sonuç eax'te */
+static void expr(struct gen *g, uint32_t i)
+{
+    const struct turkc_node *n = &g->nodes[i];
+    uint32_t j;
+    char buf[32];
+
+    switch (n->kind) {
+    case ND_NUMBER:
+        if (n->a == 0)
+            put(g, "xorl %%eax, %%eax");
+        else
+            put(g, "movl %s, %%eax", operand(g, i, buf, sizeof(buf)));
+        return;
+    case ND_NAME:
+        put(g, "movl %s, %%eax", operand(g, i, buf, sizeof(buf)));
+        return;
+    case ND_ASSIGN:
+        expr(g, n->b);
+        put(g, "movl %%eax, %s", operand(g, n->a, buf, sizeof(buf)));
+        return;
+    case ND_BINARY:
+        /* sola bağlı zincir döngüyle: dipteki düğüm solunu kendi hesaplar,
+         * üsttekiler (aux ile i'ye kadar) solu eax'te bulur
+         */
+        j = turkc_chain_bottom(g->nodes, i);
+        binary(g, j, 0);
+        while (j != i) {
+            j = g->nodes[j].aux;
+            binary(g, j, 1);
+        }
+        return;
+    case ND_NEG:
+        expr(g, n->a);
+        put(g, "negl %%eax");
+        return;
+    case ND_CALL:
+        call(g, i);
+        return;
+    }
+    fail(g, i, "beklenmeyen dugum %s", turkc_node_name(n->kind));
+}
+
+/* Koşul doğruysa (when = 1) veya yanlışsa (when = 0) label'a atlar */
+static void branch(struct gen *g, uint32_t i, int when, unsigned label)
+{
+    const struct turkc_node *n = &g->nodes[i];
+    int tk;
+
+    if (n->kind == ND_BINARY && is_compare(n->op)) {
+        tk = compare(g, i, 0);
+        put(g, "j%s .L%u", cc(when ? tk : negate(tk)), label);
+    } else {
+        expr(g, i);
+        put(g, "testl %%eax, %%eax");
+        put(g, "j%s .L%u", when ? "ne" : "e", label);
+    }
+}
+
+static void statement(struct gen *g, uint32_t i, unsigned ret)
+{
+    const struct turkc_node *n = &g->nodes[i];
+    unsigned top, test, end;
+    uint32_t s;
+    char buf[32];
+
+    switch (n->kind) {
+    case ND_NONE:
+        break;
+    case ND_BLOCK:
+        for (s = n->a; s; s = g->nodes[s].next)
+            statement(g, s, ret);
+        break;
+    case ND_VAR:
+        snprintf(buf, sizeof(buf), "%ld(%%rbp)", -4L * ((long)n->aux + 1));
+        if (n->a) {
+            expr(g, n->a);
+            put(g, "movl %%eax, %s", buf);
+        } else {
+            put(g, "movl $0, %s", buf);
+        }
+        break;
+    case ND_IF:
+        end = new_label(g);
+        branch(g, n->a, 0, end);
+        statement(g, n->b, ret);
+        if (n->c) {
+            test = end;
+            end = new_label(g);
+            put(g, "jmp .L%u", end);
+            place(g, test);
+            statement(g, n->c, ret);
+        }
+        place(g, end);
+        break;
+    case ND_WHILE:
+        /* koşul sonda: tur başına tek atlama */
+        top = new_label(g);
+        test = new_label(g);
+        put(g, "jmp .L%u", test);
+        place(g, top);
+        statement(g, n->b, ret);
+        place(g, test);
+        branch(g, n->a, 1, top);
+        break;
+    case ND_FOR:
+        if (n->a)
+            statement(g, n->a, ret);
+        top = new_label(g);
+        test = new_label(g);
+        put(g, "jmp .L%u", test);
+        place(g, top);
+        statement(g, n->d, ret);
+        if (n->c)
+            expr(g, n->c);
+        place(g, test);
+        if (n->b)
+            branch(g, n->b, 1, top);
+        else
+            put(g, "jmp .L%u", top);
+        break;
+    case ND_RETURN:
+        if (n->a)
+            expr(g, n->a);
+        else
+            put(g, "xorl %%eax, %%eax");
+        put(g, "jmp .L%u", ret);
+        break;
+    case ND_EXPR:
+        expr(g, n->a);
+        break;
+    default:
+        fail(g, i, "beklenmeyen dugum %s", turkc_node_name(n->kind));
+    }
+}
+
+/* Fonksiyonun hata etiketleri: satır ecx'e, sütun r8d'ye, mesaj r9'a */
+static void stubs(struct gen *g)
+{
+    size_t s;
+
+    for (s = 0; s < g->nstubs; s++) {
+        place(g, g->stubs[s].label);
+        put(g, "movl $%lu, %%ecx", g->stubs[s].line);
+        put(g, "movl $%lu, %%r8d", g->stubs[s].column);
+        put(g, "leaq %s(%%rip), %%r9", g->stubs[s].msg);
+        put(g, "jmp tc_fail");
+    }
+}
+
+static void function(struct gen *g, uint32_t func)
+{
+    const struct turkc_function *f = &g->prog->funcs[func];
+    unsigned frame = (4 * (f->nslots + 1) + 15) & ~15u, ret, k;
+
+    g->nstubs = 0;
+    g->depth = 0;
+    g->left = -4L * (f->nslots + 1);
+    fprintf(g->out, "\n    .type tc_%s, @function\n", turkc_ast_symbol(g->prog->ast, f->name));
+    fprintf(g->out, "tc_%s:\n", turkc_ast_symbol(g->prog->ast, f->name));
+    put(g, "pushq %%rbp");
+    put(g, "movq %%rsp, %%rbp");
+    put(g, "subq $%u, %%rsp", frame);
+    put(g, "movl %%r11d, %ld(%%rbp)", g->left);
+    for (k = 0; k < f->nparams; k++) {
+        if (k < 6) {
+            put(g, "movl %%%s, %ld(%%rbp)", arg_regs[k], -4L * (k + 1));
+        } else {
+            put(g, "movl %u(%%rbp), %%eax", 16 + 8 * (k - 6));
+            put(g, "movl %%eax, %ld(%%rbp)", -4L * (k + 1));
+        }
+    }
+    ret = new_label(g);
+    statement(g, g->nodes[f->node].b, ret);
+    put(g, "xorl %%eax, %%eax");
+    place(g, ret);
+    put(g, "leave");
+    put(g, "ret");
+    stubs(g);
+}
+
+/* IR'dan üretim. Değerlerin yeri turkc_regalloc'tan gelir: yazmaç, yığın
+ * yuvası ya da (sabitse) komuttaki anlık değer. Yuvalar itilen çağrıda
+ * korunan yazmaçların altındadır. eax, ecx ve edx geçicidir.
+ */
+
+static uint32_t arg(const struct gen *g, uint32_t insn, uint32_t k)
+{
+    return g->f->uses[g->f->insns[insn].args + k].value;
+}
+
+/* Değerin işleneni: "$5", "%ebx", "-12(%rbp)" */
+static const char *val(struct gen *g, uint32_t v, char *buf)
+{
+    const struct turkc_ir_insn *in = &g->f->insns[v];
+    int32_t loc = g->ra.loc[v];
+
+    if (in->op == IR_CONST) {
+        snprintf(buf, 32, "$%ld", (long)in->k);
+    } else if (loc == TURKC_RA_NONE) {
+        fail(g, in->node, "v%lu icin yer yok", (unsigned long)v);
+    } else if (loc >= 0) {
+        snprintf(buf, 32, "%%%s", ra_regs[loc]);
+    } else {
+        snprintf(buf, 32, "%ld(%%rbp)", -8L * g->saved + 4L * loc);
+        g->stats.stack_refs++;
+    }
+    return buf;
+}
+
+static int is_mem(const char *op)
+{
+    return strchr(op, '(') != NULL;
+}
+
+static int is_reg(const char *op)
+{
+    return op[0] == '%';
+}
+
+/* dst = src; ikisi de bellekse ecx üzerinden */
+static void move(struct gen *g, const char *dst, const char *src)
+{
+    if (strcmp(dst, src) == 0)
+        return;
+    if (is_mem(dst) && is_mem(src)) {
+        put(g, "movl %s, %%ecx", src);
+        put(g, "movl %%ecx, %s", dst);
+    } else {
+        put(g, "movl %s, %s", src, dst);
+    }
+}
+
+static void add_move(struct gen *g, const char *dst, const char *src)
+{
+    struct move *m;
+
+    if (strcmp(dst, src) == 0)
+        return;
+    g->moves = grow(g, g->moves, &g->mcap, g->nmoves + 1, sizeof(*g->moves));
+    m = &g->moves[g->nmoves++];
+    snprintf(m->dst, sizeof(m->dst), "%s", dst);
+    snprintf(m->src, sizeof(m->src), "%s", src);
+}
+
+/* Biriken atamaları aynı anda yapılmış gibi üretir: hedefi başka bir
+ * atamanın kaynağı olmayan önce yazılır; kalanlar döngüdür ve biri eax'e
+ * alınarak kırılır. Hedeflerde eax ve ecx olmamalı.
+ */
+static void parallel(struct gen *g)
+{
+    struct move *m = g->moves;
+    size_t n = g->nmoves, i, j;
+    int done;
+
+    while (n) {
+        done = 0;
+        for (i = 0; i < n; i++) {
+            for (j = 0; j < n && (j == i || strcmp(m[j].src, m[i].dst) != 0); j++)
+                ;
+            if (j < n)
+                continue;
+            move(g, m[i].dst, m[i].src);
+            m[i--] = m[--n];
+            done = 1;
+        }
+        if (!done) {
+            put(g, "movl %s, %%eax", m[0].dst);
+            for (j = 0; j < n; j++) {
+                if (strcmp(m[j].src, m[0].dst) == 0)
+                    strcpy(m[j].src, "%eax");
+            }
+        }
+    }
+    g->nmoves = 0;
+}
+
+static int has_phis(const struct gen *g, uint32_t b)
+{
+    uint32_t i = g->f->blocks[b].first;
+
+    return i && g->f->insns[i].op == IR_PHI;
+}
+
+/* from -> to kenarındaki phi atamaları */
+static void edge_moves(struct gen *g, uint32_t from, uint32_t to)
+{
+    const struct turkc_ir_func *f = g->f;
+    char dst[32], src[32];
+    uint32_t i;
+
+    for (i = f->blocks[to].first; i && f->insns[i].op == IR_PHI; i = f->insns[i].next)
+        add_move(g, val(g, i, dst), val(g, turkc_ir_phi_value(f, i, from), src));
+    parallel(g);
+}
+
+/* from'dan to'ya dallanmanın hedefi: phi'si varsa atamaları yapan kenar */
+static unsigned target(struct gen *g, uint32_t from, uint32_t to)
+{
+    struct edge *e;
+
+    if (!has_phis(g, to))
+        return g->blocks + to;
+    g->edges = grow(g, g->edges, &g->ecap, g->nedges + 1, sizeof(*g->edges));
+    e = &g->edges[g->nedges++];
+    e->label = new_label(g);
+    e->from = from;
+    e->to = to;
+    return e->label;
+}
+
+static int ir_token(int op)
+{
+    static const int tk[] = { TK_EQ, TK_NE, TK_LT, TK_GT, TK_LE, TK_GE };
+
+    return tk[op - IR_EQ];
+}
+
+static void ir_arith(struct gen *g, uint32_t i)
+{
+    int op = g->f->insns[i].op;
+    const char *name = op == IR_ADD ? "addl" : op == IR_SUB ? "subl" : "imull", *a, *b, *t;
+    char abuf[32], bbuf[32], d[32];
+
+    a = val(g, arg(g, i, 0), abuf);
+    b = val(g, arg(g, i, 1), bbuf);
+    val(g, i, d);
+    if (op != IR_SUB && strcmp(d, b) == 0) {
+        t = a;
+        a = b;
+        b = t;
+    }
+    if (is_reg(d) && strcmp(d, b) != 0) {
+        move(g, d, a);
+        put(g, "%s %s, %s", name, b, d);
+    } else {
+        move(g, "%eax", a);
+        put(g, "%s %s, %%eax", name, b);
+        move(g, d, "%eax");
+    }
+}
+
+/* divide gibi; bölen sabit değilse sıfır ve -1 denetlenir */
+static void ir_divide(struct gen *g, uint32_t i)
+{
+    const struct turkc_ir_insn *in = &g->f->insns[i], *b = &g->f->insns[arg(g, i, 1)];
+    int mod = in->op == IR_MOD;
+    unsigned zero, minus, done;
+    char abuf[32], bbuf[32], d[32];
+
+    if (b->op == IR_CONST && b->k == 0) {
+        put(g, "jmp .L%u", stub(g, in->node, "tc_div0"));
+        return;
+    }
+    val(g, arg(g, i, 0), abuf);
+    val(g, i, d);
+    if (b->op == IR_CONST) {
+        move(g, "%eax", abuf);
+        if (b->k == -1) {
+            put(g, mod ? "xorl %%eax, %%eax" : "negl %%eax");
+        } else {
+            put(g, "movl $%ld, %%ecx", (long)b->k);
+            put(g, "cltd");
+            put(g, "idivl %%ecx");
+            if (mod)
+                put(g, "movl %%edx, %%eax");
+        }
+        move(g, d, "%eax");
+        return;
+    }
+    move(g, "%ecx", val(g, arg(g, i, 1), bbuf));
+    move(g, "%eax", abuf);
+    zero = stub(g, in->node, "tc_div0");
+    minus = new_label(g);
+    done = new_label(g);
+    put(g, "testl %%ecx, %%ecx");
+    put(g, "je .L%u", zero);
+    put(g, "cmpl $-1, %%ecx");
+    put(g, "je .L%u", minus);
+    put(g, "cltd");
+    put(g, "idivl %%ecx");
+    if (mod)
+        put(g, "movl %%edx, %%eax");
+    put(g, "jmp .L%u", done);
+    place(g, minus);
+    put(g, mod ? "xorl %%eax, %%eax" : "negl %%eax");
+    place(g, done);
+    move(g, d, "%eax");
+}
+
+/* Karşılaştırmanın cmp'sini üretir, bayraklar için geçerli operatörü döner */
+static int ir_compare(struct gen *g, uint32_t i)
+{
+    const char *a, *b, *t;
+    char abuf[32], bbuf[32];
+    int tk = ir_token(g->f->insns[i].op);
+
+    a = val(g, arg(g, i, 0), abuf);
+    b = val(g, arg(g, i, 1), bbuf);
+    if (a[0] == '$') {
+        t = a;
+        a = b;
+        b = t;
+        tk = mirror(tk);
+    }
+    if (a[0] == '$' || (is_mem(a) && is_mem(b))) {
+        move(g, "%eax", a);
+        a = "%eax";
+    }
+    put(g, "cmpl %s, %s", b, a);
+    return tk;
+}
+
+/* Argümanlar call gibi yerleşir; yedinciden sonrakiler yığına itilir */
+static void ir_call(struct gen *g, uint32_t i)
+{
+    const struct turkc_ir_insn *in = &g->f->insns[i];
+    const struct turkc_function *fn = &g->prog->funcs[in->k];
+    unsigned k, extra = in->nargs > 6 ? in->nargs - 6 : 0, pad = extra % 2;
+    char buf[32], reg[8];
+
+    if (pad)
+        put(g, "subq $8, %%rsp");
+    for (k = in->nargs; k-- > 6;) {
+        move(g, "%eax", val(g, arg(g, i, k), buf));
+        put(g, "pushq %%rax");
+    }
+    for (k = 0; k < in->nargs && k < 6; k++) {
+        snprintf(reg, sizeof(reg), "%%%s", arg_regs[k]);
+        add_move(g, reg, val(g, arg(g, i, k), buf));
+    }
+    parallel(g);
+    emit_call(g, in->node, turkc_ast_symbol(g->prog->ast, fn->name));
+    if (extra)
+        put(g, "addq $%u, %%rsp", 8 * (extra + pad));
+    if (g->ra.loc[i] != TURKC_RA_NONE)
+        move(g, val(g, i, buf), "%eax");
+}
+
+static void ir_branch(struct gen *g, uint32_t b, uint32_t i, uint32_t next)
+{
+    const struct turkc_ir_block *bl = &g->f->blocks[b];
+    uint32_t c = arg(g, i, 0), t = bl->succ[0], e = bl->succ[1];
+    const char *a;
+    char buf[32];
+    int tk = TK_NE;
+
+    if (t == e) {
+        edge_moves(g, b, t);
+        if (t != next)
+            put(g, "jmp .L%u", g->blocks + t);
+        return;
+    }
+    if (turkc_ra_fused(g->f, c)) {
+        tk = ir_compare(g, c);
+    } else {
+        a = val(g, c, buf);
+        if (a[0] == '$') {
+            put(g, "movl %s, %%eax", a);
+            put(g, "testl %%eax, %%eax");
+        } else if (is_reg(a)) {
+            put(g, "testl %s, %s", a, a);
+        } else {
+            put(g, "cmpl $0, %s", a);
+        }
+    }
+    if (t == next) {
+        put(g, "j%s .L%u", cc(negate(tk)), target(g, b, e));
+        edge_moves(g, b, t);
+        return;
+    }
+    put(g, "j%s .L%u", cc(tk), target(g, b, t));
+    edge_moves(g, b, e);
+    if (e != next)
+        put(g, "jmp .L%u", g->blocks + e);
+}
+
+static void ir_insn(struct gen *g, uint32_t b, uint32_t i, uint32_t next)
+{
+    const struct turkc_ir_insn *in = &g->f->insns[i];
+    char abuf[32], d[32];
+    const char *a;
+
+    switch (in->op) {
+    case IR_NOP:
+    case IR_CONST:
+    case IR_PARAM:
+    case IR_PHI:
+        return;
+    case IR_ADD:
+    case IR_SUB:
+    case IR_MUL:
+        ir_arith(g, i);
+        return;
+    case IR_DIV:
+    case IR_MOD:
+        ir_divide(g, i);
+        return;
+    case IR_EQ: case IR_NE: case IR_LT: case IR_GT: case IR_LE: case IR_GE:
+        if (turkc_ra_fused(g->f, i))
+            return;
+        put(g, "set%s %%al", cc(ir_compare(g, i)));
+        put(g, "movzbl %%al, %%eax");
+        move(g, val(g, i, d), "%eax");
+        return;
+    case IR_NEG:
+        a = val(g, arg(g, i, 0), abuf);
+        if (is_reg(val(g, i, d))) {
+            move(g, d, a);
+            put(g, "negl %s", d);
+        } else {
+            move(g, "%eax", a);
+            put(g, "negl %%eax");
+            move(g, d, "%eax");
+        }
+        return;
+    case IR_LOADG:
+        snprintf(abuf, sizeof(abuf), "tc_g%ld(%%rip)", (long)in->k);
+        if (is_reg(val(g, i, d))) {
+            put(g, "movl %s, %s", abuf, d);
+        } else {
+            put(g, "movl %s, %%eax", abuf);
+            move(g, d, "%eax");
+        }
+        return;
+    case IR_STOREG:
+        a = val(g, arg(g, i, 0), abuf);
+        if (is_mem(a)) {
+            put(g, "movl %s, %%eax", a);
+            a = "%eax";
+        }
+        put(g, "movl %s, tc_g%ld(%%rip)", a, (long)in->k);
+        return;
+    case IR_CALL:
+        ir_call(g, i);
+        return;
+    case IR_YAZ:
+        move(g, "%esi", val(g, arg(g, i, 0), abuf));
+        put(g, "leaq tc_fmt(%%rip), %%rdi");
+        put(g, "xorl %%eax, %%eax");
+        put(g, "call printf@PLT");
+        return;
+    case IR_YAZS:
+        put(g, "leaq tc_s%lu(%%rip), %%rdi", (unsigned long)g->nodes[in->node].b);
+        put(g, "call puts@PLT");
+        return;
+    case IR_JMP:
+        edge_moves(g, b, g->f->blocks[b].succ[0]);
+        if (g->f->blocks[b].succ[0] != next)
+            put(g, "jmp .L%u", g->blocks + g->f->blocks[b].succ[0]);
+        return;
+    case IR_BR:
+        ir_branch(g, b, i, next);
+        return;
+    case IR_RET:
+        if (in->nargs)
+            move(g, "%eax", val(g, arg(g, i, 0), abuf));
+        else
+            put(g, "xorl %%eax, %%eax");
+        if (next)
+            put(g, "jmp .L%u", g->ret);
+        return;
+    }
+    fail(g, in->node, "beklenmeyen komut %s", turkc_ir_op_name(in->op));
+}
+
+static void ir_function(struct gen *g, uint32_t func)
+{
+    const struct turkc_function *fn = &g->prog->funcs[func];
+    const char *name = turkc_ast_symbol(g->prog->ast, fn->name);
+    struct turkc_ir_func *f = &g->ir->funcs[func];
+    const struct turkc_ir_insn *in;
+    unsigned frame, r, k;
+    uint32_t b, i;
+    size_t s;
+    char d[32], src[32];
+
+    turkc_ra_free(&g->ra);
+    if (turkc_ra_run(f, g->nregs, &g->ra) != 0)
+        fail(g, fn->node, "bellek yetersiz");
+    g->f = f;
+    g->nstubs = 0;
+    g->nedges = 0;
+    g->saved = 0;
+    for (r = 0; r < TURKC_RA_CALLEE; r++)
+        g->saved += (g->ra.used >> r) & 1;
+    /* yuvaların altında kalan çağrı sayısı; itilen yazmaçlarla birlikte 16 byte'a hizalı */
+    g->left = -8L * g->saved - 4L * (g->ra.nslots + 1);
+    frame = ((8 * g->saved + 4 * (g->ra.nslots + 1) + 15) & ~15u) - 8 * g->saved;
+    g->stats.values += g->ra.values;
+    g->stats.spilled += g->ra.spilled;
+    g->stats.slots += g->ra.nslots;
+    g->blocks = g->label;
+    g->label += f->nblocks;
+    g->ret = new_label(g);
+
+    fprintf(g->out, "\n    .type tc_%s, @function\n", name);
+    fprintf(g->out, "tc_%s:\n", name);
+    put(g, "pushq %%rbp");
+    put(g, "movq %%rsp, %%rbp");
+    for (r = 0; r < TURKC_RA_CALLEE; r++) {
+        if ((g->ra.used >> r) & 1)
+            put(g, "pushq %%%s", ra_regs64[r]);
+    }
+    put(g, "subq $%u, %%rsp", frame);
+    put(g, "movl %%r11d, %ld(%%rbp)", g->left);
+    /* parametreler: yazmaçtakiler paralel, yığındakiler sonra */
+    for (i = f->blocks[1].first; i; i = f->insns[i].next) {
+        in = &f->insns[i];
+        if (in->op != IR_PARAM || in->k >= 6)
+            continue;
+        snprintf(src, sizeof(src), "%%%s", arg_regs[in->k]);
+        add_move(g, val(g, i, d), src);
+    }
+    parallel(g);
+    for (i = f->blocks[1].first; i; i = f->insns[i].next) {
+        in = &f->insns[i];
+        if (in->op != IR_PARAM || in->k < 6)
+            continue;
+        snprintf(src, sizeof(src), "%ld(%%rbp)", 16L + 8L * (in->k - 6));
+        if (is_reg(val(g, i, d))) {
+            put(g, "movl %s, %s", src, d);
+        } else {
+            put(g, "movl %s, %%eax", src);
+            move(g, d, "%eax");
+        }
+    }
+
+    for (k = 0; k < g->ra.norder; k++) {
+        b = g->ra.order[k];
+        place(g, g->blocks + b);
+        for (i = f->blocks[b].first; i; i = f->insns[i].next)
+            ir_insn(g, b, i, k + 1 < g->ra.norder ? g->ra.order[k + 1] : 0);
+    }
+    place(g, g->ret);
+    if (g->saved) {
+        put(g, "leaq -%u(%%rbp), %%rsp", 8 * g->saved);
+        for (r = TURKC_RA_CALLEE; r-- > 0;) {
+            if ((g->ra.used >> r) & 1)
+                put(g, "popq %%%s", ra_regs64[r]);
+        }
+        put(g, "popq %%rbp");
+    } else {
+        put(g, "leave");
+    }
+    put(g, "ret");
+    for (s = 0; s < g->nedges; s++) {
+        place(g, g->edges[s].label);
+        edge_moves(g, g->edges[s].from, g->edges[s].to);
+        put(g, "jmp .L%u", g->blocks + g->edges[s].to);
+    }
+    stubs(g);
+}
+
+/* String literal'ler .rodata'ya; etiket düğüm indeksidir (tc_s<düğüm>) */
+static void strings(struct gen *g)
+{
+    const unsigned char *text;
+    uint32_t i;
+    size_t len, k;
+
+    for (i = 1; i < g->prog->ast->count; i++) {
+        if (g->nodes[i].kind != ND_STRING)
+            continue;
+        text = (const unsigned char *)turkc_intern_text(g->prog->ast->syms, g->nodes[i].a, &len);
+        fprintf(g->out, "tc_s%lu:\n    .string \"", (unsigned long)i);
+        for (k = 1; k + 1 < len; k++) {     /* tırnaklar hariç */
+            if (text[k] < 0x20 || text[k] >= 0x7f || text[k] == '"' || text[k] == '\\')
+                fprintf(g->out, "\\%03o", text[k]);
+            else
+                fputc(text[k], g->out);
+        }
+        fputs("\"\n", g->out);
+    }
+}
+
+/* main, tc_fail ve veri bölümleri */
+static void runtime(struct gen *g)
+{
+    const struct turkc_node *n;
+    uint32_t d;
+
+    fprintf(g->out, "\n    .globl main\n    .type main, @function\nmain:\n");
+    put(g, "pushq %%rbp");
+    put(g, "movq %%rsp, %%rbp");
+    put(g, "movq (%%rsi), %%rax");
+    put(g, "movq %%rax, tc_argv0(%%rip)");
+    /* ana ayrı yığında: mmap(NULL, TURKC_C_STACK, PROT_READ | PROT_WRITE,
+     * MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0); alınamazsa ana
+     * yığında TURKC_C_STACK_FALLBACK kadar
+     */
+    put(g, "xorl %%edi, %%edi");
+    put(g, "movl $%u, %%esi", TURKC_C_STACK);
+    put(g, "movl $3, %%edx");
+    put(g, "movl $0x4022, %%ecx");
+    put(g, "movl $-1, %%r8d");
+    put(g, "xorl %%r9d, %%r9d");
+    put(g, "call mmap@PLT");
+    put(g, "cmpq $-1, %%rax");
+    put(g, "je 1f");
+    put(g, "leaq %u(%%rax), %%rdx", TURKC_C_STACK_SPARE);
+    put(g, "movq %%rdx, tc_stack_limit(%%rip)");
+    put(g, "leaq %u(%%rax), %%rsp", TURKC_C_STACK);
+    put(g, "jmp 2f");
+    fprintf(g->out, "1:\n");
+    put(g, "leaq -%u(%%rsp), %%rax", TURKC_C_STACK_FALLBACK);
+    put(g, "movq %%rax, tc_stack_limit(%%rip)");
+    fprintf(g->out, "2:\n");
+    put(g, "movl $%u, %%r11d", TURKC_MAX_CALL_DEPTH - 1);     /* ana etkin */
+    put(g, "call tc_%s", turkc_ast_symbol(g->prog->ast, g->prog->funcs[g->prog->entry].name));
+    put(g, "leave");
+    put(g, "ret");
+
+    /* ecx: satır, r8d: sütun, r9: mesaj; stdout boşaltılır, "program:
+     * satir N, sutun M: mesaj" stderr'e yazılır, çıkış kodu 1
+     */
+    fprintf(g->out, "\ntc_fail:\n");
+    put(g, "andq $-16, %%rsp");
+    put(g, "movl %%ecx, %%ebx");
+    put(g, "movl %%r8d, %%r12d");
+    put(g, "movq %%r9, %%r13");
+    put(g, "xorl %%edi, %%edi");
+    put(g, "call fflush@PLT");
+    put(g, "movq stderr@GOTPCREL(%%rip), %%rax");
+    put(g, "movq (%%rax), %%rdi");
+    put(g, "leaq tc_errfmt(%%rip), %%rsi");
+    put(g, "movq tc_argv0(%%rip), %%rdx");
+    put(g, "movl %%ebx, %%ecx");
+    put(g, "movl %%r12d, %%r8d");
+    put(g, "movq %%r13, %%r9");
+    put(g, "xorl %%eax, %%eax");
+    put(g, "call fprintf@PLT");
+    put(g, "movl $1, %%edi");
+    put(g, "call exit@PLT");
+
+    fprintf(g->out, "\n    .section .rodata\n");
+    fprintf(g->out, "tc_fmt:\n    .string \"%%d\\n\"\n");
+    fprintf(g->out, "tc_errfmt:\n    .string \"%%s: satir %%u, sutun %%u: %%s\\n\"\n");
+    fprintf(g->out, "tc_div0:\n    .string \"sifira bolme\"\n");
+    fprintf(g->out, "tc_deep:\n    .string \"cok derin ozyineleme\"\n");
+    strings(g);
+
+    fprintf(g->out, "\n    .data\n    .align 4\n");
+    for (d = g->nodes[g->prog->ast->root].a; d; d = n->next) {
+        n = &g->nodes[d];
+        if (n->kind != ND_VAR)
+            continue;
+        fprintf(g->out, "tc_g%lu:                         # %s\n    .long %ld\n",
+                (unsigned long)n->aux, turkc_ast_symbol(g->prog->ast, n->c),
+                (long)g->prog->globals[n->aux]);
+    }
+
+    fprintf(g->out, "\n    .bss\n    .align 8\n");
+    fprintf(g->out, "tc_argv0:\n    .zero 8\n");
+    fprintf(g->out, "tc_stack_limit:\n    .zero 8\n");
+    fprintf(g->out, "\n    .section .note.GNU-stack,\"\",@progbits\n");
+}
+
+static void init(struct gen *g, const struct turkc_program *prog, const char *buf, size_t len,
+                 FILE *out, struct turkc_parse_error *err)
+{
+    memset(g, 0, sizeof(*g));
+    g->prog = prog;
+    g->nodes = prog->ast->nodes;
+    g->out = out;
+    g->buf = buf;
+    g->len = len;
+    g->line = 1;
+    g->err = err;
+}
+
+static void release(struct gen *g)
+{
+    free(g->stubs);
+    free(g->moves);
+    free(g->edges);
+    turkc_ra_free(&g->ra);
+}
+
+static int finish(struct gen *g)
+{
+    runtime(g);
+    release(g);
+    if (ferror(g->out)) {
+        if (g->err) {
+            snprintf(g->err->message, sizeof(g->err->message), "yazma hatasi");
+            g->err->offset = g->err->line = g->err->column = 0;
+        }
+        return -1;
+    }
+    return 0;
+}
+
+int turkc_x86_emit(const struct turkc_program *prog, const char *buf, size_t len,
+                   FILE *out, struct turkc_parse_error *err)
+{
+    struct gen g;
+    uint32_t f;
+
+    init(&g, prog, buf, len, out, err);
+    if (setjmp(g.fail)) {
+        release(&g);
+        return -1;
+    }
+    fprintf(out, "# TurkC -> x86-64 (System V, GNU as)\n    .text\n");
+    for (f = 0; f < prog->nfuncs; f++)
+        function(&g, f);
+    return finish(&g);
+}
+
+int turkc_x86_emit_ir(struct turkc_ir *ir, const char *buf, size_t len, int nregs,
+                      FILE *out, struct turkc_x86_stats *stats, struct turkc_parse_error *err)
+{
+    struct gen g;
+    uint32_t f;
+
+    init(&g, ir->prog, buf, len, out, err);
+    g.ir = ir;
+    g.nregs = nregs;
+    if (setjmp(g.fail)) {
+        release(&g);
+        return -1;
+    }
+    fprintf(out, "# TurkC IR -> x86-64 (System V, GNU as)\n    .text\n");
+    for (f = 0; f < ir->nfuncs; f++)
+        ir_function(&g, f);
+    if (stats)
+        *stats = g.stats;
+    return finish(&g);
+}
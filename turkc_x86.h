@@ -0,0 +1,66 @@
+#ifndef TURKC_X86_H
+#define TURKC_X86_H
+
+/* x86-64 kod üretici: çözümlenmiş programı (turkc_resolve.h) GNU
+ * assembler'ın okuduğu AT&T sözdizimli assembly'ye (.s) çevirir.
+ *
+ *   ./tcasm prog.tc -o prog.s && gcc prog.s -o prog && ./prog
+ *
+ * Çağrı kuralı System V AMD64'tür: ilk altı argüman edi, esi, edx, ecx,
+ * r8d, r9d'de, kalanlar yığında; dönüş değeri eax'te. ana() tc_ana olarak
+ * üretilir ve main ondan çağrılır, çıkış kodu ana'nın değeridir. yaz()
+ * libc'nin printf ve puts'unu kullanır.
+ *
+ * Yerel değişkenler çerçevede, globaller .data'dadır. İfadeler eax'te
+ * hesaplanır; sağ işlenen sabit veya değişkense doğrudan komuta girer,
+ * değilse ara değer yığına itilir. Karşılaştırmalar koşulda cmp + jcc'dir.
+ *
+ * Anlam turkc_interp ile aynıdır: sıfıra bölme ve TURKC_MAX_CALL_DEPTH'i
+ * aşan çağrı (turkc_stack.h), stderr'e o işlemin satır ve sütunuyla
+ * yazılıp çıkış kodu 1 ile biter. Kalan çağrı sayısı çağrıda r11d'de
+ * geçer ve çerçevede durur; main ana'yı mmap'lenmiş TURKC_C_STACK
+ * byte'lık bir yığında çağırır.
+ *
+ * turkc_x86_emit_ir aynı çıktıyı geçişleri uygulanmış IR'dan (turkc_ir.h)
+ * üretir. Değerler doğrusal taramayla yazmaçlara atanır (turkc_regalloc.h);
+ * sığmayanlar ve nregs 0 ise hepsi yığın yuvasındadır. Phi'ler gelen
+ * kenarda paralel atamayla çözülür.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "turkc_ir.h"
+#include "turkc_parse.h"
+#include "turkc_resolve.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* prog'u out'a yazar. buf/len kaynak metnidir (çalışma hatalarının satır
+ * ve sütunu için). Başarıda 0; yazma hatasında -1 ve err.
+ */
+int turkc_x86_emit(const struct turkc_program *prog, const char *buf, size_t len,
+                   FILE *out, struct turkc_parse_error *err);
+
+struct turkc_x86_stats {
+    uint64_t values;            /* yer verilen IR değerleri */
+    uint64_t spilled;           /* yığına düşenler */
+    uint64_t slots;             /* yığın yuvaları, fonksiyonların toplamı */
+    uint64_t stack_refs;        /* üretilen kodda yığın yuvası işlenenleri */
+};
+
+/* ir'ı (ir->prog'un IR'ı) nregs yazmaçla (0..TURKC_RA_REGS) out'a yazar;
+ * stats NULL değilse doldurulur. Öncüller yeniden hesaplanır. Başarıda 0;
+ * yazma hatasında veya bellek yetmezse -1 ve err.
+ */
+int turkc_x86_emit_ir(struct turkc_ir *ir, const char *buf, size_t len, int nregs,
+                      FILE *out, struct turkc_x86_stats *stats, struct turkc_parse_error *err);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif